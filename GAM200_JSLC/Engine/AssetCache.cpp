@@ -0,0 +1,685 @@
+//AssetCache.cpp
+
+#include "AssetCache.hpp"
+#include "Logger.hpp"
+#include "CookedTexture.hpp"
+#include "TextureTracker.hpp"
+#include "../OpenGL/GLWrapper.hpp"
+#include <algorithm>
+#include <chrono>
+
+#pragma warning(push, 0)
+#include <stb_image.h>
+#pragma warning(pop)
+
+namespace
+{
+    size_t CookedBytes(const CookedTexture::Image& image)
+    {
+        size_t bytes = 0;
+        for (const CookedTexture::Level& level : image.levels)
+            bytes += level.pixels.size();
+        return bytes;
+    }
+
+    // Uploads every precomputed level into the bound texture (replaces TexImage2D + GenerateMipmap).
+    void UploadCookedLevels(const CookedTexture::Image& image, unsigned int textureID, const char* owner,
+                            const std::source_location& site)
+    {
+        const GLenum format = (image.channels == 4) ? GL_RGBA : GL_RGB;
+        // RGB levels are tightly packed, so odd widths leave rows that aren't 4-byte aligned.
+        if (format == GL_RGB)
+            GL::PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (size_t i = 0; i < image.levels.size(); ++i)
+        {
+            const CookedTexture::Level& level = image.levels[i];
+            GL::TexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), format, level.width, level.height, 0, format,
+                GL_UNSIGNED_BYTE, level.pixels.data());
+            TextureTracker::Instance().Track(textureID, static_cast<int>(i), level.width, level.height, format, owner, site);
+        }
+        if (format == GL_RGB)
+            GL::PixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
+    enum class CookedLoad
+    {
+        Loaded,
+        Missing,
+        Stale
+    };
+
+    // A .ctex stands in for its PNG only while the PNG's size and mtime match the stamp (a stat, not a
+    // read). With no PNG on disk the .ctex is all there is, so it is used as is.
+    CookedLoad LoadCooked(const std::string& pngPath, CookedTexture::Image& out)
+    {
+        const std::string cookedPath = CookedTexture::PathFor(pngPath);
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        CookedTexture::SourceStamp cookedFrom;
+        if (!CookedTexture::ReadInfo(cookedPath, width, height, channels, &cookedFrom))
+            return CookedLoad::Missing;
+        CookedTexture::SourceStamp source;
+        if (CookedTexture::StatSource(pngPath, source) && !source.Matches(cookedFrom))
+            return CookedLoad::Stale;
+        if (CookedTexture::Load(cookedPath, out))
+            return CookedLoad::Loaded;
+        out = {}; // a truncated file leaves levels behind, and Upload treats any level as cooked
+        return CookedLoad::Missing;
+    }
+
+    void LogStaleCooked(const std::string& pngPath)
+    {
+        Logger::Instance().Log(Logger::Severity::Error,
+            "AssetCache: %s is out of date with %s, decoding the PNG (rerun the cook target)",
+            CookedTexture::PathFor(pngPath).c_str(), pngPath.c_str());
+    }
+
+    size_t OutlineFieldStride(int width)
+    {
+        // Two bytes per texel, rows padded to the default GL_UNPACK_ALIGNMENT of 4.
+        return (static_cast<size_t>(width) * 2 + 3) & ~static_cast<size_t>(3);
+    }
+
+    // Same thresholds as outline.frag: opaque is alpha > 0.5, transparent is alpha <= 0.1, and
+    // anything outside the image counts as transparent.
+    std::vector<unsigned char> BuildOutlineField(const unsigned char* pixels, int width, int height, int channels)
+    {
+        struct Offset
+        {
+            int x;
+            int y;
+            int d2;
+        };
+        // Disc of offsets nearest first, so the first hit is the distance.
+        static const std::vector<Offset> offsets = [] {
+            std::vector<Offset> disc;
+            const int r = AssetCache::OUTLINE_FIELD_RADIUS;
+            for (int y = -r; y <= r; ++y)
+                for (int x = -r; x <= r; ++x)
+                    if (x * x + y * y <= r * r)
+                        disc.push_back({ x, y, x * x + y * y });
+            std::stable_sort(disc.begin(), disc.end(), [](const Offset& a, const Offset& b) { return a.d2 < b.d2; });
+            return disc;
+        }();
+
+        const auto alphaAt = [&](int x, int y) -> int {
+            if (x < 0 || y < 0 || x >= width || y >= height)
+                return 0;
+            return channels == 4 ? pixels[(static_cast<size_t>(y) * width + x) * 4 + 3] : 255;
+        };
+
+        const size_t stride = OutlineFieldStride(width);
+        std::vector<unsigned char> field(stride * static_cast<size_t>(height), 255);
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                unsigned char* out = &field[static_cast<size_t>(y) * stride + static_cast<size_t>(x) * 2];
+                bool needOpaque = true;
+                bool needTransparent = true;
+                for (const Offset& o : offsets)
+                {
+                    const int a = alphaAt(x + o.x, y + o.y);
+                    if (needOpaque && a > 127)
+                    {
+                        out[0] = static_cast<unsigned char>(o.d2);
+                        needOpaque = false;
+                    }
+                    if (needTransparent && a <= 25)
+                    {
+                        out[1] = static_cast<unsigned char>(o.d2);
+                        needTransparent = false;
+                    }
+                    if (!needOpaque && !needTransparent)
+                        break;
+                }
+            }
+        }
+        return field;
+    }
+}
+
+AssetCache& AssetCache::Instance()
+{
+    static AssetCache instance;
+    return instance;
+}
+
+AssetCache::~AssetCache()
+{
+    StopLoaderThreads();
+    for (DecodedImage& image : m_decoded)
+        stbi_image_free(image.pixels);
+}
+
+std::string AssetCache::MakeKey(const std::string& path, const TextureOptions& options)
+{
+    // Same file with different sampler state / orientation is a different GL texture.
+    std::string key = path;
+    key += '|';
+    key += static_cast<char>('0' + static_cast<int>(options.filter));
+    key += options.repeat ? 'R' : 'C';
+    key += options.flipVertically ? 'F' : 'N';
+    return key;
+}
+
+void AssetCache::ApplySampler(const TextureOptions& options)
+{
+    const GLint wrap = options.repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE;
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap);
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap);
+    switch (options.filter)
+    {
+    case Filter::Nearest:
+        GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        break;
+    case Filter::Linear:
+        GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        break;
+    case Filter::LinearMipmap:
+        GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        break;
+    }
+}
+
+AssetCache::Texture AssetCache::AcquireTexture(const std::string& path, const TextureOptions& options,
+                                               std::source_location site)
+{
+    const std::string key = MakeKey(path, options);
+
+    auto found = m_keyToID.find(key);
+    if (found != m_keyToID.end())
+    {
+        Entry& entry = m_entries[found->second];
+        if (options.keepPixels && entry.pixels.empty())
+            Logger::Instance().Log(Logger::Severity::Error, "AssetCache: '%s' was first loaded without keepPixels", path.c_str());
+        ++entry.refCount;
+        ++m_stats.references;
+        ++m_stats.hits;
+        return entry.texture;
+    }
+    if (m_missingKeys.count(key))
+        return {};
+
+    ++m_stats.misses;
+
+    // Cooked files store rows bottom-up, so they only stand in for flipped loads.
+    const bool tryCooked = options.flipVertically && !options.keepPixels;
+
+    if (options.async && !options.keepPixels)
+    {
+        // The loader thread decides between PNG and .ctex; the PNG header is right either way,
+        // the .ctex header covers builds that ship without PNGs.
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        if (stbi_info(path.c_str(), &width, &height, &channels)
+            || (tryCooked && CookedTexture::ReadInfo(CookedTexture::PathFor(path), width, height, channels)))
+            return AcquireAsync(path, key, options, width, height, channels, site);
+        // Unreadable header: fall through so the synchronous path logs and applies whiteFallback.
+    }
+
+    CookedTexture::Image cooked;
+    const CookedLoad cookedLoad = tryCooked ? LoadCooked(path, cooked) : CookedLoad::Missing;
+    if (cookedLoad == CookedLoad::Stale)
+        LogStaleCooked(path);
+    if (cookedLoad == CookedLoad::Loaded)
+    {
+        unsigned int textureID = 0;
+        GL::GenTextures(1, &textureID);
+        GL::BindTexture(GL_TEXTURE_2D, textureID);
+        ApplySampler(options);
+        UploadCookedLevels(cooked, textureID, options.owner, site);
+        GL::BindTexture(GL_TEXTURE_2D, 0);
+        return AddEntry(key, textureID, cooked.width, cooked.height, cooked.channels, CookedBytes(cooked),
+                        options.owner, site).texture;
+    }
+
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    stbi_set_flip_vertically_on_load(options.flipVertically);
+    unsigned char* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+
+    static const unsigned char white[] = { 255, 255, 255, 255 };
+    const unsigned char* upload = data;
+    if (!data)
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "AssetCache: failed to load texture: %s", path.c_str());
+        if (!options.whiteFallback)
+        {
+            m_missingKeys.insert(key);
+            return {};
+        }
+        width = height = 1;
+        channels = 4;
+        upload = white;
+    }
+
+    unsigned int textureID = 0;
+    GL::GenTextures(1, &textureID);
+    GL::BindTexture(GL_TEXTURE_2D, textureID);
+    ApplySampler(options);
+
+    const GLenum format = (channels == 4) ? GL_RGBA : GL_RGB;
+    GL::TexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, upload);
+    GL::GenerateMipmap(GL_TEXTURE_2D);
+    GL::BindTexture(GL_TEXTURE_2D, 0);
+    TextureTracker::Instance().Track(textureID, 0, width, height, format, options.owner, site);
+    TextureTracker::Instance().TrackMipChain(textureID);
+
+    // Full mip chain adds roughly a third on top of the base level.
+    Entry& entry = AddEntry(key, textureID, width, height, channels,
+        static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(channels) * 4 / 3,
+        options.owner, site);
+    if (options.keepPixels && data)
+    {
+        entry.pixels.assign(data, data + static_cast<size_t>(width) * height * channels);
+        entry.texture.pixels = &entry.pixels;
+    }
+
+    stbi_image_free(data);
+    return entry.texture;
+}
+
+AssetCache::Entry& AssetCache::AddEntry(const std::string& key, unsigned int textureID, int width, int height,
+                                        int channels, size_t bytes, const char* owner, const std::source_location& site)
+{
+    Entry& entry = m_entries[textureID];
+    entry.key = key;
+    entry.owner = owner;
+    entry.site = site;
+    entry.refCount = 1;
+    entry.bytes = bytes;
+    entry.texture.id = textureID;
+    entry.texture.width = width;
+    entry.texture.height = height;
+    entry.texture.channels = channels;
+
+    m_keyToID[key] = textureID;
+    ++m_stats.textures;
+    ++m_stats.references;
+    m_stats.vramBytes += bytes;
+    return entry;
+}
+
+void AssetCache::ReleaseTexture(unsigned int textureID)
+{
+    if (textureID == 0)
+        return;
+
+    auto it = m_entries.find(textureID);
+    if (it == m_entries.end())
+        return;
+
+    Entry& entry = it->second;
+    --m_stats.references;
+    if (--entry.refCount > 0)
+        return;
+
+    if (entry.pending)
+        --m_stats.pending;
+    if (entry.pending || (entry.outlineFieldRequested && entry.outlineField == 0))
+    {
+        // Still queued: nobody wants it any more. Already-decoded images are dropped by Upload.
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(),
+            [textureID](const DecodeJob& job) { return job.id == textureID; }), m_jobs.end());
+    }
+
+    TextureTracker& tracker = TextureTracker::Instance();
+    if (entry.outlineField != 0)
+    {
+        GL::DeleteTextures(1, &entry.outlineField);
+        tracker.Untrack(entry.outlineField);
+    }
+    GL::DeleteTextures(1, &textureID);
+    tracker.Untrack(textureID);
+    --m_stats.textures;
+    m_stats.vramBytes -= entry.bytes;
+    m_keyToID.erase(entry.key);
+    m_entries.erase(it);
+}
+
+void AssetCache::Clear()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_jobs.clear();
+        for (DecodedImage& image : m_decoded)
+            stbi_image_free(image.pixels);
+        m_decoded.clear();
+    }
+    TextureTracker& tracker = TextureTracker::Instance();
+    for (const auto& [textureID, entry] : m_entries)
+    {
+        tracker.Untrack(entry.outlineField);
+        tracker.Untrack(textureID);
+    }
+    m_keyToID.clear();
+    m_entries.clear();
+    m_missingKeys.clear();
+    m_preloads.clear();
+    m_stats = {};
+}
+
+AssetCache::Texture AssetCache::AcquireAsync(const std::string& path, const std::string& key, const TextureOptions& options,
+                                             int width, int height, int channels, const std::source_location& site)
+{
+    static const unsigned char transparent[] = { 0, 0, 0, 0 };
+
+    unsigned int textureID = 0;
+    GL::GenTextures(1, &textureID);
+    GL::BindTexture(GL_TEXTURE_2D, textureID);
+    ApplySampler(options);
+    GL::TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, transparent);
+    GL::BindTexture(GL_TEXTURE_2D, 0);
+    TextureTracker::Instance().Track(textureID, 0, 1, 1, GL_RGBA, options.owner, site);
+
+    // Counted at full size up front so the budget reflects what is about to land.
+    Entry& entry = AddEntry(key, textureID, width, height, channels,
+        static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(channels) * 4 / 3,
+        options.owner, site);
+    entry.pending = true;
+    entry.whiteFallback = options.whiteFallback;
+    ++m_stats.pending;
+
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_jobs.push_back({ textureID, key, path, options.flipVertically, false });
+    }
+    m_jobReady.notify_one();
+    return entry.texture;
+}
+
+AssetCache::DecodedImage AssetCache::Decode(const DecodeJob& job, bool onLoaderThread)
+{
+    // The global flip flag belongs to the main thread's synchronous loads.
+    if (onLoaderThread)
+        stbi_set_flip_vertically_on_load_thread(job.flipVertically);
+    else
+        stbi_set_flip_vertically_on_load(job.flipVertically);
+
+    DecodedImage image;
+    image.id = job.id;
+    image.key = job.key;
+    image.path = job.path;
+    image.outlineField = job.outlineField;
+    if (job.outlineField)
+    {
+        // Only the full-size level matters; the field lines up with it texel for texel.
+        CookedTexture::Image cooked;
+        const CookedLoad cookedLoad = job.flipVertically ? LoadCooked(job.path, cooked) : CookedLoad::Missing;
+        image.staleCooked = cookedLoad == CookedLoad::Stale;
+        if (cookedLoad == CookedLoad::Loaded)
+        {
+            const CookedTexture::Level& base = cooked.levels[0];
+            image.width = base.width;
+            image.height = base.height;
+            image.fieldTexels = BuildOutlineField(base.pixels.data(), base.width, base.height, cooked.channels);
+        }
+        else if (unsigned char* pixels = stbi_load(job.path.c_str(), &image.width, &image.height, &image.channels, 0))
+        {
+            image.fieldTexels = BuildOutlineField(pixels, image.width, image.height, image.channels);
+            stbi_image_free(pixels);
+        }
+        return image;
+    }
+    const CookedLoad cookedLoad = job.flipVertically ? LoadCooked(job.path, image.cooked) : CookedLoad::Missing;
+    image.staleCooked = cookedLoad == CookedLoad::Stale;
+    if (cookedLoad == CookedLoad::Loaded)
+    {
+        image.width = image.cooked.width;
+        image.height = image.cooked.height;
+        image.channels = image.cooked.channels;
+        return image;
+    }
+    image.pixels = stbi_load(job.path.c_str(), &image.width, &image.height, &image.channels, 0);
+    return image;
+}
+
+void AssetCache::StartLoaderThreads(int count)
+{
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    (void)count;
+#else
+    if (!m_loaders.empty())
+        return;
+    if (count <= 0)
+        count = std::clamp(static_cast<int>(std::thread::hardware_concurrency()) - 1, 1, 4);
+
+    m_stopLoaders = false;
+    for (int i = 0; i < count; ++i)
+        m_loaders.emplace_back(&AssetCache::LoaderThreadMain, this);
+    Logger::Instance().Log(Logger::Severity::Info, "AssetCache: %d loader threads", count);
+#endif
+}
+
+void AssetCache::StopLoaderThreads()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stopLoaders = true;
+    }
+    m_jobReady.notify_all();
+    for (std::thread& loader : m_loaders)
+        loader.join();
+    m_loaders.clear();
+}
+
+void AssetCache::LoaderThreadMain()
+{
+    for (;;)
+    {
+        DecodeJob job;
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_jobReady.wait(lock, [this] { return m_stopLoaders || !m_jobs.empty(); });
+            if (m_stopLoaders)
+                return;
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        DecodedImage image = Decode(job, true);
+
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_decoded.push_back(std::move(image));
+    }
+}
+
+bool AssetCache::TakeDecoded(DecodedImage& out)
+{
+    DecodeJob job;
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        if (!m_decoded.empty())
+        {
+            out = std::move(m_decoded.front());
+            m_decoded.pop_front();
+            return true;
+        }
+        if (!m_loaders.empty() || m_jobs.empty())
+            return false;
+        job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+    }
+    // No loader threads: decode here, one image per call so the caller's budget still applies.
+    out = Decode(job, false);
+    return true;
+}
+
+void AssetCache::Upload(DecodedImage& image)
+{
+    // Logger isn't thread-safe, so the loader thread only flags it.
+    if (image.staleCooked)
+        LogStaleCooked(image.path);
+    if (image.outlineField)
+    {
+        UploadOutlineField(image);
+        return;
+    }
+
+    auto it = m_entries.find(image.id);
+    // Released before it arrived (the GL name may even belong to a newer texture by now).
+    if (it == m_entries.end() || !it->second.pending || it->second.key != image.key)
+    {
+        stbi_image_free(image.pixels);
+        return;
+    }
+
+    Entry& entry = it->second;
+    entry.pending = false;
+    --m_stats.pending;
+
+    const bool cooked = !image.cooked.levels.empty();
+    if (!cooked && !image.pixels)
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "AssetCache: failed to load texture: %s", image.path.c_str());
+        // The placeholder stays (or turns white) and the full-size estimate from AcquireAsync goes.
+        m_stats.vramBytes -= entry.bytes;
+        entry.bytes = 0;
+        if (entry.whiteFallback)
+        {
+            static const unsigned char white[] = { 255, 255, 255, 255 };
+            GL::BindTexture(GL_TEXTURE_2D, image.id);
+            GL::TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
+            GL::BindTexture(GL_TEXTURE_2D, 0);
+            TextureTracker::Instance().Track(image.id, 0, 1, 1, GL_RGBA, entry.owner, entry.site);
+            entry.bytes = 4;
+            m_stats.vramBytes += entry.bytes;
+        }
+        entry.texture.width = 1;
+        entry.texture.height = 1;
+        entry.texture.channels = 4;
+        return;
+    }
+
+    GL::BindTexture(GL_TEXTURE_2D, image.id);
+    if (cooked)
+    {
+        UploadCookedLevels(image.cooked, image.id, entry.owner, entry.site);
+    }
+    else
+    {
+        const GLenum format = (image.channels == 4) ? GL_RGBA : GL_RGB;
+        GL::TexImage2D(GL_TEXTURE_2D, 0, format, image.width, image.height, 0, format, GL_UNSIGNED_BYTE, image.pixels);
+        GL::GenerateMipmap(GL_TEXTURE_2D);
+        TextureTracker::Instance().Track(image.id, 0, image.width, image.height, format, entry.owner, entry.site);
+        TextureTracker::Instance().TrackMipChain(image.id);
+        stbi_image_free(image.pixels);
+        image.pixels = nullptr;
+    }
+    GL::BindTexture(GL_TEXTURE_2D, 0);
+
+    m_stats.vramBytes -= entry.bytes;
+    entry.bytes = cooked ? CookedBytes(image.cooked)
+        : static_cast<size_t>(image.width) * static_cast<size_t>(image.height) * static_cast<size_t>(image.channels) * 4 / 3;
+    m_stats.vramBytes += entry.bytes;
+    entry.texture.width = image.width;
+    entry.texture.height = image.height;
+    entry.texture.channels = image.channels;
+}
+
+void AssetCache::UploadOutlineField(DecodedImage& image)
+{
+    auto it = m_entries.find(image.id);
+    if (it == m_entries.end() || it->second.key != image.key || it->second.outlineField != 0)
+        return;
+
+    Entry& entry = it->second;
+    if (image.fieldTexels.empty())
+    {
+        // outlineFieldRequested stays set, so a broken file is not retried every frame.
+        Logger::Instance().Log(Logger::Severity::Error, "AssetCache: failed to build outline field: %s", image.path.c_str());
+        return;
+    }
+
+    GL::GenTextures(1, &entry.outlineField);
+    GL::BindTexture(GL_TEXTURE_2D, entry.outlineField);
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    GL::TexImage2D(GL_TEXTURE_2D, 0, GL_RG8, image.width, image.height, 0, GL_RG, GL_UNSIGNED_BYTE, image.fieldTexels.data());
+    GL::BindTexture(GL_TEXTURE_2D, 0);
+    TextureTracker::Instance().Track(entry.outlineField, 0, image.width, image.height, GL_RG8, "OutlineField", entry.site);
+
+    const size_t bytes = static_cast<size_t>(image.width) * static_cast<size_t>(image.height) * 2;
+    entry.bytes += bytes;
+    m_stats.vramBytes += bytes;
+}
+
+bool AssetCache::BindOutlineField(unsigned int textureID)
+{
+    auto it = m_entries.find(textureID);
+    if (it == m_entries.end())
+        return false;
+
+    Entry& entry = it->second;
+    if (entry.outlineField == 0)
+    {
+        if (!entry.outlineFieldRequested)
+        {
+            entry.outlineFieldRequested = true;
+            // Keys are "<path>|<filter><wrap><flip>" (MakeKey).
+            DecodeJob job;
+            job.id = textureID;
+            job.key = entry.key;
+            job.path = entry.key.substr(0, entry.key.rfind('|'));
+            job.flipVertically = entry.key.back() == 'F';
+            job.outlineField = true;
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                m_jobs.push_back(std::move(job));
+            }
+            m_jobReady.notify_one();
+        }
+        return false;
+    }
+
+    GL::ActiveTexture(GL_TEXTURE1);
+    GL::BindTexture(GL_TEXTURE_2D, entry.outlineField);
+    GL::ActiveTexture(GL_TEXTURE0);
+    return true;
+}
+
+bool AssetCache::IsPending(unsigned int textureID) const
+{
+    auto it = m_entries.find(textureID);
+    return it != m_entries.end() && it->second.pending;
+}
+
+void AssetCache::PumpUploads(double budgetMs)
+{
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+
+    DecodedImage image;
+    while (TakeDecoded(image))
+    {
+        Upload(image);
+        if (std::chrono::duration<double, std::milli>(Clock::now() - start).count() >= budgetMs)
+            break;
+    }
+}
+
+void AssetCache::PreloadTexture(const std::string& path, const TextureOptions& options, std::source_location site)
+{
+    TextureOptions asyncOptions = options;
+    asyncOptions.async = true;
+    const Texture texture = AcquireTexture(path, asyncOptions, site);
+    if (texture.id != 0)
+        m_preloads.push_back(texture.id);
+}
+
+void AssetCache::ReleasePreloads()
+{
+    for (unsigned int id : m_preloads)
+        ReleaseTexture(id);
+    m_preloads.clear();
+}
@@ -0,0 +1,187 @@
+//AssetCache.hpp
+
+#pragma once
+#include "CookedTexture.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <source_location>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Shared, reference-counted GL textures keyed by file path (and sampler settings).
+ *
+ * The first AcquireTexture for a key decodes the PNG and uploads it; later calls return the
+ * same GL handle and bump the count. Every Acquire must be paired with ReleaseTexture (usually
+ * from the owner's Shutdown); the texture is deleted when the last reference goes away.
+ *
+ * Async loads return at once with the real size (read from the PNG header) and a transparent
+ * 1x1 placeholder; loader threads decode the file and PumpUploads swaps the pixels into the same
+ * GL handle on the main thread, a few per frame, so owners never need to re-fetch the id.
+ *
+ * Flipped loads prefer a cooked "<name>.ctex" next to the PNG (see CookedTexture / the cook target).
+ *
+ * Textures drawn with outline.frag also get an outline field on first use (see BindOutlineField).
+ */
+class AssetCache
+{
+public:
+    static AssetCache& Instance();
+
+    enum class Filter
+    {
+        Nearest,
+        Linear,
+        LinearMipmap // trilinear min filter, linear mag
+    };
+
+    struct TextureOptions
+    {
+        Filter filter = Filter::Linear;
+        bool repeat = false;         // GL_REPEAT instead of GL_CLAMP_TO_EDGE
+        bool flipVertically = true;  // stbi_set_flip_vertically_on_load
+        bool keepPixels = false;     // keep the decoded image on the CPU (Font parses its atlas)
+        bool whiteFallback = false;  // upload a 1x1 white texel when the file is missing
+        bool async = false;          // decode on a loader thread (ignored with keepPixels)
+        const char* owner = "AssetCache"; // TextureTracker owner; a shared texture is charged to its first acquirer
+    };
+
+    struct Texture
+    {
+        unsigned int id = 0;
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        /// Only filled when TextureOptions::keepPixels was set on the first load.
+        const std::vector<unsigned char>* pixels = nullptr;
+    };
+
+    struct Stats
+    {
+        int textures = 0;
+        int references = 0;
+        size_t vramBytes = 0;
+        int hits = 0;
+        int misses = 0;
+        int pending = 0;  // async loads still showing their placeholder
+    };
+
+    /// Returns id 0 (and logs) if the file could not be decoded and whiteFallback is off. The failure is
+    /// remembered by key until Clear, so repeat calls return 0 without touching the disk or logging again.
+    /// site is recorded with the texture in TextureTracker.
+    Texture AcquireTexture(const std::string& path, const TextureOptions& options,
+                           std::source_location site = std::source_location::current());
+    /// Linear filtering, clamped, flipped for GL (the Background defaults).
+    Texture AcquireTexture(const std::string& path, std::source_location site = std::source_location::current())
+    {
+        return AcquireTexture(path, TextureOptions{}, site);
+    }
+    /// Safe to call with 0 or an id that was never acquired.
+    void ReleaseTexture(unsigned int textureID);
+
+    /// Drops every entry (and remembered failure) without touching GL (context already gone).
+    void Clear();
+
+    /// count <= 0 picks one per spare core (max 4). Single-threaded web builds start none and
+    /// PumpUploads decodes on the main thread instead, still within its budget.
+    void StartLoaderThreads(int count = 0);
+    void StopLoaderThreads();
+    /// Uploads decoded async textures until budgetMs is spent (at least one). Main thread, once per frame.
+    void PumpUploads(double budgetMs);
+
+    /// Starts an async load and holds a reference until ReleasePreloads, so a later Acquire with
+    /// the same options is a cache hit. Used by the splash screen to warm up gameplay assets.
+    void PreloadTexture(const std::string& path, const TextureOptions& options,
+                        std::source_location site = std::source_location::current());
+    void ReleasePreloads();
+
+    /// Largest outline radius (texels) the outline field can answer.
+    static constexpr int OUTLINE_FIELD_RADIUS = 3;
+    /// Binds the texture's outline field to GL_TEXTURE1 (active unit is left at 0): an RG8 texture holding,
+    /// per texel, the squared distance to the nearest opaque (R) and transparent (G) texel, 255 beyond
+    /// OUTLINE_FIELD_RADIUS. The first call queues it on the loader threads and returns false, as does
+    /// every call until it has been uploaded or for ids AssetCache does not own.
+    bool BindOutlineField(unsigned int textureID);
+
+    /// True while an async texture still shows its placeholder (false for ids AssetCache does not own).
+    bool IsPending(unsigned int textureID) const;
+
+    const Stats& GetStats() const { return m_stats; }
+
+    AssetCache(const AssetCache&) = delete;
+    void operator=(const AssetCache&) = delete;
+
+private:
+    AssetCache() = default;
+    ~AssetCache();
+
+    struct DecodeJob
+    {
+        unsigned int id = 0;
+        std::string key;
+        std::string path;
+        bool flipVertically = true;
+        bool outlineField = false; // build the outline field instead of the texture
+    };
+
+    struct DecodedImage
+    {
+        unsigned int id = 0;
+        std::string key;
+        std::string path;
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        unsigned char* pixels = nullptr; // stbi allocation, freed by Upload
+        CookedTexture::Image cooked;     // used instead of pixels when a .ctex was found
+        bool staleCooked = false;        // a .ctex was skipped because its PNG changed; logged on upload
+        bool outlineField = false;
+        std::vector<unsigned char> fieldTexels; // RG8, rows padded to 4 bytes
+    };
+
+    struct Entry
+    {
+        std::string key;
+        Texture texture;
+        std::vector<unsigned char> pixels;
+        size_t bytes = 0;
+        int refCount = 0;
+        bool pending = false;
+        bool whiteFallback = false;   // what a failed async decode falls back to
+        unsigned int outlineField = 0;
+        bool outlineFieldRequested = false;
+        const char* owner = nullptr;  // TextureTracker attribution for deferred uploads
+        std::source_location site;
+    };
+
+    static std::string MakeKey(const std::string& path, const TextureOptions& options);
+    static void ApplySampler(const TextureOptions& options);
+    static DecodedImage Decode(const DecodeJob& job, bool onLoaderThread);
+
+    Entry& AddEntry(const std::string& key, unsigned int textureID, int width, int height, int channels, size_t bytes,
+                    const char* owner, const std::source_location& site);
+    Texture AcquireAsync(const std::string& path, const std::string& key, const TextureOptions& options,
+                         int width, int height, int channels, const std::source_location& site);
+    bool TakeDecoded(DecodedImage& out);
+    void Upload(DecodedImage& image);
+    void UploadOutlineField(DecodedImage& image);
+    void LoaderThreadMain();
+
+    std::unordered_map<std::string, unsigned int> m_keyToID;
+    std::unordered_map<unsigned int, Entry> m_entries;
+    std::unordered_set<std::string> m_missingKeys; // failed loads without whiteFallback
+    std::vector<unsigned int> m_preloads;
+    Stats m_stats;
+
+    // Loader threads only touch the two queues (under m_queueMutex); entries and GL stay on the main thread.
+    std::vector<std::thread> m_loaders;
+    std::mutex m_queueMutex;
+    std::condition_variable m_jobReady;
+    std::deque<DecodeJob> m_jobs;
+    std::deque<DecodedImage> m_decoded;
+    bool m_stopLoaders = false;
+};
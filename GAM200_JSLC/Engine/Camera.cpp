@@ -1,11 +1,13 @@
 // Camera.cpp
 
 #include "Camera.hpp"
+#include "SimulationClock.hpp"
 #include <algorithm>
 #include <cmath>
 
 Camera::Camera()
     : m_position(0.0f, 0.0f)
+    , m_prevPosition(0.0f, 0.0f)
     , m_viewWidth(1920.0f)
     , m_viewHeight(1080.0f)
     , m_minBounds(0.0f, 0.0f)
@@ -17,6 +19,7 @@ Camera::Camera()
 void Camera::Initialize(Math::Vec2 position, float viewWidth, float viewHeight)
 {
     m_position = position;
+    m_prevPosition = position;
     m_viewWidth = viewWidth;
     m_viewHeight = viewHeight;
 }
@@ -131,6 +134,17 @@ Math::Vec2 Camera::GetScreenShakeOffset() const
     return { sx, sy };
 }
 
+void Camera::StorePreviousPosition()
+{
+    m_prevPosition = m_position;
+    m_prevTickedFrame = SimulationClock::Instance().GetTickedFrame();
+}
+
+Math::Vec2 Camera::GetRenderPosition() const
+{
+    return SimulationClock::Instance().Interpolate(m_prevPosition, m_position, m_prevTickedFrame);
+}
+
 Math::Matrix Camera::GetViewMatrix() const
 {
     const Math::Vec2 sh = GetScreenShakeOffset();
@@ -23,6 +23,11 @@ public:
     Math::Matrix GetViewMatrix() const;
     Math::Vec2 GetPosition() const { return m_position; }
 
+    /// Call at the start of each fixed simulation tick; draw code then uses GetRenderPosition().
+    void StorePreviousPosition();
+    /// Position blended between the last two ticks by SimulationClock's interpolation alpha.
+    Math::Vec2 GetRenderPosition() const;
+
     Math::Vec2 GetScreenShakeOffset() const;
 
     /// 짧은 화면 흔들림 (Train 로봇 착지 등)
@@ -31,6 +36,8 @@ public:
 
 private:
     Math::Vec2 m_position;
+    Math::Vec2 m_prevPosition;
+    long long m_prevTickedFrame = -1; // SimulationClock::GetTickedFrame() when m_prevPosition was stored
     float m_viewWidth;
     float m_viewHeight;
     Math::Vec2 m_minBounds;
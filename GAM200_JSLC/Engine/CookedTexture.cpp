@@ -0,0 +1,244 @@
+//CookedTexture.cpp
+
+#include "CookedTexture.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#pragma warning(push, 0)
+#define QOI_IMPLEMENTATION
+#include <qoi.h>
+#pragma warning(pop)
+
+namespace CookedTexture
+{
+    std::string PathFor(const std::string& pngPath)
+    {
+        const std::string ext = ".png";
+        if (pngPath.size() <= ext.size() || pngPath.compare(pngPath.size() - ext.size(), ext.size(), ext) != 0)
+            return {};
+        return pngPath.substr(0, pngPath.size() - ext.size()) + ".ctex";
+    }
+
+    namespace
+    {
+        bool ReadHeader(std::istream& file, FileHeader& header)
+        {
+            if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+                return false;
+            return std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0
+                && header.version == VERSION
+                && (header.channels == 3 || header.channels == 4)
+                && header.levelCount > 0;
+        }
+    }
+
+    bool StatSource(const std::string& pngPath, SourceStamp& out)
+    {
+        std::error_code ec;
+        const std::uintmax_t size = std::filesystem::file_size(pngPath, ec);
+        if (ec)
+            return false;
+        const std::filesystem::file_time_type mtime = std::filesystem::last_write_time(pngPath, ec);
+        if (ec)
+            return false;
+        out.size = static_cast<uint64_t>(size);
+        out.mtime = static_cast<int64_t>(mtime.time_since_epoch().count());
+        out.hash = 0;
+        return true;
+    }
+
+    bool HashSource(const std::string& pngPath, uint64_t& outHash)
+    {
+        std::ifstream file(pngPath, std::ios::binary);
+        if (!file)
+            return false;
+
+        constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+        constexpr uint64_t FNV_PRIME = 1099511628211ull;
+        uint64_t hash = FNV_OFFSET;
+        char buffer[64 * 1024];
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+        {
+            const std::streamsize count = file.gcount();
+            for (std::streamsize i = 0; i < count; ++i)
+            {
+                hash ^= static_cast<unsigned char>(buffer[i]);
+                hash *= FNV_PRIME;
+            }
+        }
+        outHash = hash;
+        return true;
+    }
+
+    bool ReadInfo(const std::string& path, int& width, int& height, int& channels, SourceStamp* source)
+    {
+        if (path.empty())
+            return false;
+        std::ifstream file(path, std::ios::binary);
+        FileHeader header{};
+        if (!file || !ReadHeader(file, header))
+            return false;
+        width = static_cast<int>(header.width);
+        height = static_cast<int>(header.height);
+        channels = static_cast<int>(header.channels);
+        if (source)
+            *source = { header.sourceSize, header.sourceMtime, header.sourceHash };
+        return true;
+    }
+
+    bool Load(const std::string& path, Image& out)
+    {
+        if (path.empty())
+            return false;
+        std::ifstream file(path, std::ios::binary);
+        FileHeader header{};
+        if (!file || !ReadHeader(file, header))
+            return false;
+
+        out.width = static_cast<int>(header.width);
+        out.height = static_cast<int>(header.height);
+        out.channels = static_cast<int>(header.channels);
+        out.source = { header.sourceSize, header.sourceMtime, header.sourceHash };
+        out.levels.assign(header.levelCount, Level{});
+
+        std::vector<unsigned char> payload;
+        for (Level& level : out.levels)
+        {
+            LevelHeader levelHeader{};
+            if (!file.read(reinterpret_cast<char*>(&levelHeader), sizeof(levelHeader)))
+                return false;
+            level.width = static_cast<int>(levelHeader.width);
+            level.height = static_cast<int>(levelHeader.height);
+            const size_t rawSize = static_cast<size_t>(level.width) * level.height * out.channels;
+
+            if (static_cast<Payload>(header.payload) == Payload::Raw)
+            {
+                if (levelHeader.byteSize != rawSize)
+                    return false;
+                level.pixels.resize(rawSize);
+                if (!file.read(reinterpret_cast<char*>(level.pixels.data()), static_cast<std::streamsize>(rawSize)))
+                    return false;
+                continue;
+            }
+
+            payload.resize(levelHeader.byteSize);
+            if (!file.read(reinterpret_cast<char*>(payload.data()), static_cast<std::streamsize>(payload.size())))
+                return false;
+            qoi_desc desc{};
+            void* decoded = qoi_decode(payload.data(), static_cast<int>(payload.size()), &desc, out.channels);
+            if (!decoded)
+                return false;
+            const bool sizeOk = static_cast<int>(desc.width) == level.width && static_cast<int>(desc.height) == level.height;
+            if (sizeOk)
+                level.pixels.assign(static_cast<unsigned char*>(decoded), static_cast<unsigned char*>(decoded) + rawSize);
+            std::free(decoded);
+            if (!sizeOk)
+                return false;
+        }
+        return true;
+    }
+
+    bool Write(const std::string& path, const Image& image, Payload payload)
+    {
+        if (image.levels.empty() || (image.channels != 3 && image.channels != 4))
+            return false;
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return false;
+
+        FileHeader header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.width = static_cast<uint32_t>(image.width);
+        header.height = static_cast<uint32_t>(image.height);
+        header.channels = static_cast<uint32_t>(image.channels);
+        header.payload = static_cast<uint32_t>(payload);
+        header.levelCount = static_cast<uint32_t>(image.levels.size());
+        header.sourceSize = image.source.size;
+        header.sourceMtime = image.source.mtime;
+        header.sourceHash = image.source.hash;
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        for (const Level& level : image.levels)
+        {
+            const void* bytes = level.pixels.data();
+            int byteSize = static_cast<int>(level.pixels.size());
+            void* encoded = nullptr;
+            if (payload == Payload::Qoi)
+            {
+                qoi_desc desc{};
+                desc.width = static_cast<unsigned int>(level.width);
+                desc.height = static_cast<unsigned int>(level.height);
+                desc.channels = static_cast<unsigned char>(image.channels);
+                desc.colorspace = QOI_SRGB;
+                encoded = qoi_encode(level.pixels.data(), &desc, &byteSize);
+                if (!encoded)
+                    return false;
+                bytes = encoded;
+            }
+
+            LevelHeader levelHeader{};
+            levelHeader.width = static_cast<uint32_t>(level.width);
+            levelHeader.height = static_cast<uint32_t>(level.height);
+            levelHeader.byteSize = static_cast<uint32_t>(byteSize);
+            file.write(reinterpret_cast<const char*>(&levelHeader), sizeof(levelHeader));
+            file.write(static_cast<const char*>(bytes), byteSize);
+            std::free(encoded);
+        }
+        return static_cast<bool>(file);
+    }
+
+    bool Restamp(const std::string& path, const SourceStamp& source)
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        FileHeader header{};
+        if (!file || !ReadHeader(file, header))
+            return false;
+        header.sourceSize = source.size;
+        header.sourceMtime = source.mtime;
+        header.sourceHash = source.hash;
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        return static_cast<bool>(file);
+    }
+
+    void BuildMipChain(Image& image)
+    {
+        if (image.levels.empty())
+            return;
+        image.levels.resize(1);
+
+        const int c = image.channels;
+        while (image.levels.back().width > 1 || image.levels.back().height > 1)
+        {
+            const Level& src = image.levels.back();
+            Level dst;
+            // Same level sizes as glGenerateMipmap: floor(n / 2), at least 1.
+            dst.width = std::max(1, src.width / 2);
+            dst.height = std::max(1, src.height / 2);
+            dst.pixels.resize(static_cast<size_t>(dst.width) * dst.height * c);
+
+            for (int y = 0; y < dst.height; ++y)
+            {
+                const int y0 = std::min(y * 2, src.height - 1);
+                const int y1 = std::min(y * 2 + 1, src.height - 1);
+                for (int x = 0; x < dst.width; ++x)
+                {
+                    const int x0 = std::min(x * 2, src.width - 1);
+                    const int x1 = std::min(x * 2 + 1, src.width - 1);
+                    for (int ch = 0; ch < c; ++ch)
+                    {
+                        const auto at = [&](int px, int py) { return static_cast<int>(src.pixels[(static_cast<size_t>(py) * src.width + px) * c + ch]); };
+                        const int sum = at(x0, y0) + at(x1, y0) + at(x0, y1) + at(x1, y1);
+                        dst.pixels[(static_cast<size_t>(y) * dst.width + x) * c + ch] = static_cast<unsigned char>((sum + 2) / 4);
+                    }
+                }
+            }
+            image.levels.push_back(std::move(dst));
+        }
+    }
+}
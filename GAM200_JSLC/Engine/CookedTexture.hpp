@@ -0,0 +1,99 @@
+//CookedTexture.hpp
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Offline-cooked texture container (.ctex), written by Tools/AssetCooker.
+ *
+ * Rows are stored bottom-up (already in GL order) and every mip level down to 1x1 is
+ * precomputed, so loading is a read (plus an optional QOI decode) followed by one
+ * TexImage2D per level: no PNG inflate, no flip, no glGenerateMipmap.
+ *
+ * The header stamps the PNG it was cooked from. The runtime only uses a .ctex while the PNG's
+ * size and mtime still match (one stat, no read), so an edited PNG shows without a re-cook.
+ * AssetCooker compares the content hash instead and re-stamps files whose PNG was only touched.
+ *
+ * Layout: FileHeader, then levelCount x (LevelHeader + byteSize payload bytes).
+ */
+namespace CookedTexture
+{
+    constexpr char MAGIC[4] = { 'G', 'T', 'E', 'X' };
+    constexpr uint32_t VERSION = 3;
+
+    enum class Payload : uint32_t
+    {
+        Raw = 0,
+        Qoi = 1
+    };
+
+    /// Identifies the source PNG. mtime is std::filesystem's file_time_type tick count.
+    struct SourceStamp
+    {
+        uint64_t size = 0;
+        int64_t mtime = 0;
+        uint64_t hash = 0; // FNV-1a of the bytes; only AssetCooker computes and compares it
+
+        /// The load-time check: same size, same modification time.
+        bool Matches(const SourceStamp& other) const { return size == other.size && mtime == other.mtime; }
+    };
+
+    struct FileHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t width;
+        uint32_t height;
+        uint32_t channels; // 3 or 4
+        uint32_t payload;  // Payload
+        uint32_t levelCount;
+        uint32_t reserved;     // keeps the stamp 8-byte aligned; always 0
+        uint64_t sourceSize;
+        int64_t sourceMtime;
+        uint64_t sourceHash;
+    };
+
+    struct LevelHeader
+    {
+        uint32_t width;
+        uint32_t height;
+        uint32_t byteSize;
+    };
+
+    struct Level
+    {
+        int width = 0;
+        int height = 0;
+        std::vector<unsigned char> pixels;
+    };
+
+    struct Image
+    {
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        SourceStamp source;
+        std::vector<Level> levels; // [0] is the full-size image
+    };
+
+    /// "Asset/Hallway.png" -> "Asset/Hallway.ctex"; empty if the path is not a .png.
+    std::string PathFor(const std::string& pngPath);
+
+    /// Size and mtime of the PNG (hash left 0). False if it doesn't exist.
+    bool StatSource(const std::string& pngPath, SourceStamp& out);
+    /// Reads the whole PNG for SourceStamp::hash. Cook-time only.
+    bool HashSource(const std::string& pngPath, uint64_t& outHash);
+
+    /// Reads only the header. False if the file is missing, truncated or another version.
+    bool ReadInfo(const std::string& path, int& width, int& height, int& channels, SourceStamp* source = nullptr);
+    /// Reads and decodes every level into out.
+    bool Load(const std::string& path, Image& out);
+    bool Write(const std::string& path, const Image& image, Payload payload);
+    /// Rewrites only the header's stamp (the PNG was touched but its bytes are unchanged).
+    bool Restamp(const std::string& path, const SourceStamp& source);
+
+    /// Rebuilds levels[1..] from levels[0] with a 2x2 box filter.
+    void BuildMipChain(Image& image);
+}
@@ -4,132 +4,138 @@
 #include "../OpenGL/Shader.hpp"
 #include "../Engine/Matrix.hpp"
 #include "../OpenGL/GLWrapper.hpp"
-#include <vector>
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 
 void DebugRenderer::Initialize()
 {
-    // --- Circle VAO ---
-    GL::GenVertexArrays(1, &circleVAO);
-    unsigned int circleVBO;
-    GL::GenBuffers(1, &circleVBO);
-    GL::BindVertexArray(circleVAO);
-    GL::BindBuffer(GL_ARRAY_BUFFER, circleVBO);
-
-    std::vector<float> vertices;
     float angle_step = 2.0f * 3.1415926535f / CIRCLE_SEGMENTS;
     for (int i = 0; i <= CIRCLE_SEGMENTS; ++i)
-    {
-        vertices.push_back(std::cos(angle_step * i));
-        vertices.push_back(std::sin(angle_step * i));
-    }
-
-    GL::BufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-    GL::VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    GL::EnableVertexAttribArray(0);
+        m_unitCircle[i] = { std::cos(angle_step * i), std::sin(angle_step * i) };
 
-    // --- Box VAO ---
-    float box_vertices[] = { -0.5f, 0.5f, 0.5f, 0.5f, 0.5f, -0.5f, -0.5f, -0.5f };
-    unsigned int box_indices[] = { 0, 1, 1, 2, 2, 3, 3, 0 };
-
-    GL::GenVertexArrays(1, &boxVAO);
+    // One stream buffer for both primitive types: triangles first, lines after.
+    GL::GenVertexArrays(1, &VAO);
     GL::GenBuffers(1, &VBO);
-    GL::GenBuffers(1, &EBO);
-    GL::BindVertexArray(boxVAO);
+    GL::BindVertexArray(VAO);
     GL::BindBuffer(GL_ARRAY_BUFFER, VBO);
-    GL::BufferData(GL_ARRAY_BUFFER, sizeof(box_vertices), box_vertices, GL_STATIC_DRAW);
-    GL::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    GL::BufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(box_indices), box_indices, GL_STATIC_DRAW);
-    GL::VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    GL::EnableVertexAttribArray(0);
-
-    // --- Line VAO (filled quad — 두께 scale Y로 제어) ---
-    float line_vertices[] = {
-        -0.5f, -0.5f,
-         0.5f, -0.5f,
-         0.5f,  0.5f,
-        -0.5f,  0.5f
-    };
-    unsigned int line_indices[] = { 0, 1, 2, 0, 2, 3 };
-
-    GL::GenVertexArrays(1, &lineVAO);
-    GL::GenBuffers(1, &lineVBO);
-    GL::GenBuffers(1, &lineEBO);
-    GL::BindVertexArray(lineVAO);
-    GL::BindBuffer(GL_ARRAY_BUFFER, lineVBO);
-    GL::BufferData(GL_ARRAY_BUFFER, sizeof(line_vertices), line_vertices, GL_STATIC_DRAW);
-    GL::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, lineEBO);
-    GL::BufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(line_indices), line_indices, GL_STATIC_DRAW);
-    GL::VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    GL::VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, x));
     GL::EnableVertexAttribArray(0);
-
+    GL::VertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, r));
+    GL::EnableVertexAttribArray(1);
     GL::BindVertexArray(0);
+    m_vboCapacity = 0;
 }
 
-void DebugRenderer::Shutdown() const
+void DebugRenderer::Shutdown()
 {
-    GL::DeleteVertexArrays(1, &circleVAO);
-    GL::DeleteVertexArrays(1, &boxVAO);
-    GL::DeleteVertexArrays(1, &lineVAO);
-    GL::DeleteBuffers(1, &lineVBO);
-    GL::DeleteBuffers(1, &lineEBO);
+    m_triangles.clear();
+    m_lines.clear();
+    m_pendingShader = nullptr;
+
+    GL::DeleteVertexArrays(1, &VAO);
     GL::DeleteBuffers(1, &VBO);
-    GL::DeleteBuffers(1, &EBO);
+    VAO = 0;
+    VBO = 0;
+    m_vboCapacity = 0;
 }
 
-void DebugRenderer::DrawCircle(Shader& shader, Math::Vec2 center, float radius, Math::Vec2 color) const
+void DebugRenderer::Target(const Shader& shader)
 {
-    Math::Matrix model = Math::Matrix::CreateTranslation(center) * Math::Matrix::CreateScale({ radius, radius });
-    shader.setMat4("model", model);
-    shader.setVec3("objectColor", color.x, color.y, 0.8f);
-
-    GL::BindVertexArray(circleVAO);
-    GL::DrawArrays(GL_LINE_LOOP, 0, CIRCLE_SEGMENTS + 1);
-    GL::BindVertexArray(0);
+    if (m_pendingShader != &shader)
+    {
+        if (m_pendingShader)
+            Flush();
+        m_pendingShader = &shader;
+        m_alphaUniform = shader.GetUniform("uAlpha");
+    }
+    m_alpha = shader.getFloat(m_alphaUniform);
 }
 
-void DebugRenderer::DrawBox(Shader& shader, Math::Vec2 pos, Math::Vec2 size, Math::Vec2 color) const
+void DebugRenderer::PushLine(Math::Vec2 a, Math::Vec2 b, float r, float g, float bl)
 {
-    Math::Matrix model = Math::Matrix::CreateTranslation(pos) * Math::Matrix::CreateScale(size);
-    shader.setMat4("model", model);
-    shader.setVec3("objectColor", color.x, color.y, 0.2f);
+    m_lines.push_back({ a.x, a.y, r, g, bl, m_alpha });
+    m_lines.push_back({ b.x, b.y, r, g, bl, m_alpha });
+}
 
-    GL::BindVertexArray(boxVAO);
-    GL::DrawElements(GL_LINES, 8, GL_UNSIGNED_INT, 0);
-    GL::BindVertexArray(0);
+void DebugRenderer::DrawCircle(Shader& shader, Math::Vec2 center, float radius, Math::Vec2 color)
+{
+    Target(shader);
+    for (int i = 0; i < CIRCLE_SEGMENTS; ++i)
+        PushLine(center + m_unitCircle[i] * radius, center + m_unitCircle[i + 1] * radius, color.x, color.y, 0.8f);
 }
 
-void DebugRenderer::DrawBox(Shader& shader, Math::Vec2 pos, Math::Vec2 size, float r, float g, float b) const
+void DebugRenderer::DrawBox(Shader& shader, Math::Vec2 pos, Math::Vec2 size, Math::Vec2 color)
 {
-    Math::Matrix model = Math::Matrix::CreateTranslation(pos) * Math::Matrix::CreateScale(size);
-    shader.setMat4("model", model);
-    shader.setVec3("objectColor", r, g, b);
+    DrawBox(shader, pos, size, color.x, color.y, 0.2f);
+}
 
-    GL::BindVertexArray(boxVAO);
-    GL::DrawElements(GL_LINES, 8, GL_UNSIGNED_INT, 0);
-    GL::BindVertexArray(0);
+void DebugRenderer::DrawBox(Shader& shader, Math::Vec2 pos, Math::Vec2 size, float r, float g, float b)
+{
+    Target(shader);
+    const Math::Vec2 half = size * 0.5f;
+    const Math::Vec2 tl{ pos.x - half.x, pos.y + half.y };
+    const Math::Vec2 tr{ pos.x + half.x, pos.y + half.y };
+    const Math::Vec2 br{ pos.x + half.x, pos.y - half.y };
+    const Math::Vec2 bl{ pos.x - half.x, pos.y - half.y };
+    PushLine(tl, tr, r, g, b);
+    PushLine(tr, br, r, g, b);
+    PushLine(br, bl, r, g, b);
+    PushLine(bl, tl, r, g, b);
 }
 
 void DebugRenderer::DrawLine(const Shader& shader, Math::Vec2 start, Math::Vec2 end, float r, float g, float b,
-                             float thickness) const
+                             float thickness)
 {
     Math::Vec2 direction = end - start;
     float length = direction.Length();
     if (length < 1e-4f)
         return;
-    Math::Vec2 center = (start + end) * 0.5f;
-
-    float angle = std::atan2(direction.y, direction.x) * (180.0f / 3.14159265359f);
 
+    Target(shader);
+    // Filled quad around the segment (same footprint as the old rotated unit quad).
     const float t = std::max(0.15f, thickness);
-    Math::Matrix model = Math::Matrix::CreateTranslation(center) *
-        Math::Matrix::CreateRotation(angle) *
-        Math::Matrix::CreateScale({ length, t });
+    const Math::Vec2 side = direction.Perpendicular() * (t * 0.5f / length);
+    const Vertex v0{ start.x - side.x, start.y - side.y, r, g, b, m_alpha };
+    const Vertex v1{ end.x - side.x, end.y - side.y, r, g, b, m_alpha };
+    const Vertex v2{ end.x + side.x, end.y + side.y, r, g, b, m_alpha };
+    const Vertex v3{ start.x + side.x, start.y + side.y, r, g, b, m_alpha };
+    m_triangles.insert(m_triangles.end(), { v0, v1, v2, v0, v2, v3 });
+}
 
-    shader.setMat4("model", model);
-    shader.setVec3("objectColor", r, g, b);
+void DebugRenderer::Flush()
+{
+    if (!m_pendingShader || (m_triangles.empty() && m_lines.empty()))
+    {
+        m_pendingShader = nullptr;
+        return;
+    }
 
-    GL::BindVertexArray(lineVAO);
-    GL::DrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+    const Shader& shader = *m_pendingShader;
+    shader.use();
+    shader.setMat4("model", Math::Matrix::CreateIdentity());
+    shader.setBool("uVertexColor", true);
+
+    const size_t count = m_triangles.size() + m_lines.size();
+    GL::BindVertexArray(VAO);
+    GL::BindBuffer(GL_ARRAY_BUFFER, VBO);
+    if (count > m_vboCapacity)
+        m_vboCapacity = std::max(count, m_vboCapacity * 2);
+    // Re-specifying the store also orphans the previous batch, so the driver doesn't wait on it.
+    GL::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_vboCapacity * sizeof(Vertex)), nullptr, GL_STREAM_DRAW);
+    GL::BufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(m_triangles.size() * sizeof(Vertex)), m_triangles.data());
+    GL::BufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(m_triangles.size() * sizeof(Vertex)),
+                      static_cast<GLsizeiptr>(m_lines.size() * sizeof(Vertex)), m_lines.data());
+
+    if (!m_triangles.empty())
+        GL::DrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(m_triangles.size()));
+    if (!m_lines.empty())
+        GL::DrawArrays(GL_LINES, static_cast<GLint>(m_triangles.size()), static_cast<GLsizei>(m_lines.size()));
     GL::BindVertexArray(0);
-}
\ No newline at end of file
+
+    shader.setBool("uVertexColor", false);
+
+    m_triangles.clear();
+    m_lines.clear();
+    m_pendingShader = nullptr;
+}
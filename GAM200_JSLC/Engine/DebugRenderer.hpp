@@ -2,29 +2,55 @@
 
 #pragma once
 #include "Vec2.hpp"
+#include "../OpenGL/Shader.hpp"
+#include <array>
+#include <cstddef>
+#include <vector>
 
-class Shader;
-
+/**
+ * Immediate-mode debug shapes, batched: every Draw* call only appends vertices, and Flush() draws
+ * everything queued so far in two draw calls (thick lines as triangles, boxes/circles as GL_LINES)
+ * using the shader's current projection. Each vertex keeps the colour and the shader's uAlpha at
+ * the time of the Draw* call, as the old per-shape draws did. Switching to another shader flushes
+ * the pending batch, but a caller that changes the projection on the same shader must Flush() first.
+ */
 class DebugRenderer
 {
 public:
     void Initialize();
-    void Shutdown() const;
+    void Shutdown();
 
-    void DrawCircle(Shader& shader, Math::Vec2 center, float radius, Math::Vec2 color) const;
-    void DrawBox(Shader& shader, Math::Vec2 pos, Math::Vec2 size, Math::Vec2 color) const;
-    void DrawBox(Shader& shader, Math::Vec2 pos, Math::Vec2 size, float r, float g, float b) const;
+    void DrawCircle(Shader& shader, Math::Vec2 center, float radius, Math::Vec2 color);
+    void DrawBox(Shader& shader, Math::Vec2 pos, Math::Vec2 size, Math::Vec2 color);
+    void DrawBox(Shader& shader, Math::Vec2 pos, Math::Vec2 size, float r, float g, float b);
     /// thickness: 월드 단위 선 폭 (기본 1 — 얇은 디버그 라인)
     void DrawLine(const Shader& shader, Math::Vec2 start, Math::Vec2 end, float r, float g, float b,
-                  float thickness = 0.35f) const;
+                  float thickness = 0.35f);
+
+    /// Draws and clears the pending batch (no-op when empty).
+    void Flush();
 
 private:
-    unsigned int circleVAO = 0;
-    unsigned int boxVAO = 0;
-    unsigned int lineVAO = 0;
-    unsigned int lineVBO = 0;
-    unsigned int lineEBO = 0;
-    unsigned int VBO = 0, EBO = 0;
+    struct Vertex
+    {
+        float x, y;
+        float r, g, b, a;
+    };
+
+    void Target(const Shader& shader);
+    void PushLine(Math::Vec2 a, Math::Vec2 b, float r, float g, float bl);
+
+    unsigned int VAO = 0;
+    unsigned int VBO = 0;
+    size_t m_vboCapacity = 0; // vertices
+
+    const Shader* m_pendingShader = nullptr;
+    UniformHandle m_alphaUniform{};
+    float m_alpha = 1.0f; // pending shader's uAlpha at the last Draw* call
+    std::vector<Vertex> m_triangles; // thick lines
+    std::vector<Vertex> m_lines;     // box and circle outlines
+
     // Enough segments so attack-range / debug circles read as smooth curves, not obvious polygons.
     static constexpr int CIRCLE_SEGMENTS = 96;
-};
\ No newline at end of file
+    std::array<Math::Vec2, CIRCLE_SEGMENTS + 1> m_unitCircle{};
+};
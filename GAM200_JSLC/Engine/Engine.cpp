@@ -6,12 +6,23 @@
 #include "ImguiManager.hpp"
 #include "DroneConfig.hpp"
 #include "RobotConfig.hpp"
+#include "SimulationClock.hpp"
+#include "SpriteBatch.hpp"
+#include "SpriteInstancer.hpp"
+#include "RenderQueue.hpp"
+#include "AssetCache.hpp"
+#include "FrameTimeReport.hpp"
+#include "GpuTimer.hpp"
+#include "OffscreenContext.hpp"
 #include "../Game/SplashState.hpp"
 #include "../Game/MainMenu.hpp"
+#include "../Game/GameplayState.hpp"
 #include "../OpenGL/GLWrapper.hpp"
 #include "../OpenGL/Shader.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <thread>
 
 #ifdef __EMSCRIPTEN__
@@ -64,6 +75,17 @@ unsigned long CreateInvisibleX11Cursor(Display* dpy)
 }
 } // namespace
 #endif
+
+namespace
+{
+    // Main-thread time per frame spent moving decoded async textures into GL.
+    constexpr double TEXTURE_UPLOAD_BUDGET_MS = 2.0;
+
+    // Flythrough order and report section names, indexed by MapZone.
+    constexpr const char* FLYTHROUGH_ZONES[] = { "Room", "Hallway", "Rooftop", "Underground", "Train" };
+    constexpr int FLYTHROUGH_ZONE_COUNT = static_cast<int>(MapZone::Train) + 1;
+    static_assert(std::size(FLYTHROUGH_ZONES) == FLYTHROUGH_ZONE_COUNT);
+}
 //
 Engine::Engine() = default;
 Engine::~Engine() = default;
@@ -149,6 +171,14 @@ bool Engine::Initialize(const std::string& windowTitle)
     m_textureShader->use();
     m_textureShader->setInt("ourTexture", 0);
 
+    m_spriteBatch = std::make_unique<SpriteBatch>();
+    m_spriteBatch->Initialize();
+    m_spriteInstancer = std::make_unique<SpriteInstancer>();
+    m_spriteInstancer->Initialize();
+    m_renderQueue = std::make_unique<RenderQueue>(*m_spriteBatch, *m_spriteInstancer);
+
+    AssetCache::Instance().StartLoaderThreads();
+
     GL::Enable(GL_BLEND);
     GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
@@ -167,6 +197,7 @@ bool Engine::Initialize(const std::string& windowTitle)
     (void)m_imguiManager->Initialize();
     m_imguiManager->SetEngine(this);
     m_imguiManager->SetControlBindings(m_controlBindings.get());
+    GL::InvalidateStateCache();
 
     // Initialize drone config manager
     m_droneConfigManager = std::make_shared<DroneConfigManager>();
@@ -179,6 +210,254 @@ bool Engine::Initialize(const std::string& windowTitle)
     return true;
 }
 
+bool Engine::InitializeHeadless()
+{
+    Logger::Instance().Log(Logger::Severity::Event, "Engine Start (headless)");
+
+    m_headless = true;
+    GL::SetNullBackend(true);
+
+    m_input = std::make_unique<Input::Input>();
+    m_input->Initialize(nullptr);
+
+    m_controlBindings = std::make_unique<ControlBindings>();
+    m_controlBindings->LoadOrDefaults("Config/control_bindings.json");
+
+    // Still constructed so gameplay code that touches them keeps working; every GL call is a no-op.
+    m_textureShader = std::make_unique<Shader>("OpenGL/Shaders/simple.vert", "OpenGL/Shaders/simple.frag");
+    m_spriteBatch = std::make_unique<SpriteBatch>();
+    m_spriteBatch->Initialize();
+    m_spriteInstancer = std::make_unique<SpriteInstancer>();
+    m_spriteInstancer->Initialize();
+    m_renderQueue = std::make_unique<RenderQueue>(*m_spriteBatch, *m_spriteInstancer);
+    m_postProcess = std::make_unique<PostProcessManager>();
+    AssetCache::Instance().StartLoaderThreads();
+    m_postProcess->Initialize(m_width, m_height);
+
+    m_droneConfigManager = std::make_shared<DroneConfigManager>();
+    m_robotConfigManager = std::make_shared<RobotConfigManager>();
+
+    m_gameStateManager = std::make_unique<GameStateManager>(*this);
+    m_gameStateManager->PushState(std::make_unique<GameplayState>(*m_gameStateManager));
+
+    return true;
+}
+
+void Engine::RunHeadless(double simulatedSeconds)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const double fixedDt = SimulationClock::Instance().GetFixedDelta();
+    const long long totalTicks = static_cast<long long>(simulatedSeconds / fixedDt);
+
+    const Clock::time_point runStart = Clock::now();
+    Clock::time_point reportStart = runStart;
+    long long reportTicks = 0;
+    long long ticks = 0;
+
+    while (ticks < totalTicks && m_gameStateManager->HasState())
+    {
+        m_input->Update(fixedDt);
+        Update();
+        // Nothing is drawn, so there is no frame to protect: drain everything.
+        AssetCache::Instance().PumpUploads(1000.0);
+        ++ticks;
+        ++reportTicks;
+
+        // Menus are not part of the headless run; a return request ends it.
+        if (m_returnToSplashRequested || m_returnToMainMenuRequested)
+        {
+            Logger::Instance().Log(Logger::Severity::Event, "Headless: gameplay requested a state change, stopping");
+            break;
+        }
+
+        const double reportElapsed = std::chrono::duration<double>(Clock::now() - reportStart).count();
+        if (reportElapsed >= 1.0)
+        {
+            Logger::Instance().Log(Logger::Severity::Info, "Headless: %.0f ticks/sec (%lld / %lld ticks)",
+                static_cast<double>(reportTicks) / reportElapsed, ticks, totalTicks);
+            reportStart = Clock::now();
+            reportTicks = 0;
+        }
+    }
+
+    const double wall = std::chrono::duration<double>(Clock::now() - runStart).count();
+    Logger::Instance().Log(Logger::Severity::Event,
+        "Headless: %lld ticks (%.1f s simulated at %d Hz) in %.3f s wall, %.0f ticks/sec, %.1fx realtime",
+        ticks, static_cast<double>(ticks) * fixedDt, SimulationClock::Instance().GetTickRate(), wall,
+        wall > 0.0 ? static_cast<double>(ticks) / wall : 0.0,
+        wall > 0.0 ? static_cast<double>(ticks) * fixedDt / wall : 0.0);
+}
+
+bool Engine::InitializeOffscreen()
+{
+    Logger::Instance().Log(Logger::Severity::Event, "Engine Start (offscreen)");
+
+    m_offscreen = std::make_unique<OffscreenContext>();
+    if (!m_offscreen->Create())
+    {
+        m_offscreen.reset();
+        return false;
+    }
+
+#ifdef USE_GLEW
+    // GLEW loads the GL entry points first, then GLX ones; without an X display only the second step fails.
+    glewExperimental = GL_TRUE;
+    const GLenum glewStatus = glewInit();
+    if (glewStatus != GLEW_OK && glewStatus != GLEW_ERROR_NO_GLX_DISPLAY) {
+        Logger::Instance().Log(Logger::Severity::Error, "Failed to initialize GLEW (offscreen): %s",
+            reinterpret_cast<const char*>(glewGetErrorString(glewStatus)));
+        return false;
+    }
+#endif
+    Logger::Instance().Log(Logger::Severity::Debug, "OpenGL Version: %s (%s)",
+        reinterpret_cast<const char*>(GL::GetString(GL_VERSION)), reinterpret_cast<const char*>(GL::GetString(GL_RENDERER)));
+
+    if (!m_offscreen->CreateTarget(m_width, m_height))
+        return false;
+
+    m_input = std::make_unique<Input::Input>();
+    m_input->Initialize(nullptr);
+
+    m_controlBindings = std::make_unique<ControlBindings>();
+    m_controlBindings->LoadOrDefaults("Config/control_bindings.json");
+
+    m_textureShader = std::make_unique<Shader>("OpenGL/Shaders/simple.vert", "OpenGL/Shaders/simple.frag");
+    m_textureShader->use();
+    m_textureShader->setInt("ourTexture", 0);
+
+    m_spriteBatch = std::make_unique<SpriteBatch>();
+    m_spriteBatch->Initialize();
+    m_spriteInstancer = std::make_unique<SpriteInstancer>();
+    m_spriteInstancer->Initialize();
+    m_renderQueue = std::make_unique<RenderQueue>(*m_spriteBatch, *m_spriteInstancer);
+
+    AssetCache::Instance().StartLoaderThreads();
+
+    GL::Enable(GL_BLEND);
+    GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    // The target is exactly the virtual size, so the letterbox is the whole framebuffer.
+    m_postProcess = std::make_unique<PostProcessManager>();
+    m_postProcess->Initialize(m_width, m_height);
+    m_postProcess->SetDisplaySize(m_offscreen->GetWidth(), m_offscreen->GetHeight());
+
+    m_droneConfigManager = std::make_shared<DroneConfigManager>();
+    m_robotConfigManager = std::make_shared<RobotConfigManager>();
+
+    // RunFlythrough pushes GameplayState itself so it can drive the camera.
+    m_gameStateManager = std::make_unique<GameStateManager>(*this);
+    GL::InvalidateStateCache();
+    return true;
+}
+
+void Engine::RunFlythrough(const FlythroughOptions& options)
+{
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    auto gameplayState = std::make_unique<GameplayState>(*m_gameStateManager);
+    GameplayState& gameplay = *gameplayState;
+    m_gameStateManager->PushState(std::move(gameplayState));
+
+    // One tick per frame at the fixed delta: every run renders the same camera positions.
+    SimulationClock& clock = SimulationClock::Instance();
+    clock.Reset();
+    const double fixedDt = clock.GetFixedDelta();
+    // At least one: the first frame on a context pays driver start-up, and llvmpipe times it as the context's age.
+    const int settleFrames = std::max(options.settleFrames, 1);
+    const int measuredFrames = std::max(static_cast<int>(options.secondsPerZone / fixedDt), 1);
+
+    bool writeFrames = false;
+    if (!options.frameDirectory.empty() && options.frameStride > 0)
+    {
+        FrameCaptureSettings captureSettings;
+        captureSettings.directory = options.frameDirectory;
+        captureSettings.stride = options.frameStride;
+        writeFrames = m_postProcess->StartCapture(captureSettings);
+        if (writeFrames)
+        {
+            Logger::Instance().Log(Logger::Severity::Info,
+                "Flythrough: frame capture runs inside the render timings (readback copy, not encoding)");
+        }
+    }
+    FrameCapture& capture = m_postProcess->GetCapture();
+
+    FrameTimeReport report({ std::begin(FLYTHROUGH_ZONES), std::end(FLYTHROUGH_ZONES) });
+    GpuTimer gpuTimer;
+    const bool gpuTiming = gpuTimer.Initialize();
+    std::vector<GpuTimer::Sample> gpuSamples;
+
+    bool stopped = false;
+    for (int zone = 0; zone < FLYTHROUGH_ZONE_COUNT && !stopped; ++zone)
+    {
+        const int zoneFrames = settleFrames + measuredFrames;
+        gameplay.BeginFlythroughZone(static_cast<MapZone>(zone), static_cast<float>(zoneFrames * fixedDt));
+        if (writeFrames)
+            capture.SetNamePrefix(FLYTHROUGH_ZONES[zone]);
+
+        for (int frame = 0; frame < zoneFrames; ++frame)
+        {
+            const Clock::time_point frameStart = Clock::now();
+            const int ticks = clock.BeginFrame(fixedDt);
+            for (int i = 0; i < ticks && m_gameStateManager->HasState(); ++i)
+            {
+                m_input->Update(fixedDt);
+                Update();
+            }
+            const Clock::time_point updateEnd = Clock::now();
+
+            // Death is off, so this only happens if gameplay ends the run some other way.
+            if (!m_gameStateManager->HasState() || m_returnToSplashRequested || m_returnToMainMenuRequested)
+            {
+                Logger::Instance().Log(Logger::Severity::Event, "Flythrough: gameplay requested a state change, stopping");
+                stopped = true;
+                break;
+            }
+
+            const bool measured = frame >= settleFrames;
+            if (writeFrames)
+                capture.SetPaused(!measured);
+            // Outside the CPU timings: Begin may wait for the GPU result from LATENCY frames ago.
+            if (measured && gpuTiming)
+                gpuTimer.Begin(report.GetFrameCount(), gpuSamples);
+            const Clock::time_point renderStart = Clock::now();
+            RenderFrame();
+            if (measured && gpuTiming)
+                gpuTimer.End();
+            const Clock::time_point renderEnd = Clock::now();
+
+            if (!measured)
+                continue;
+            report.AddFrame(zone, Milliseconds(updateEnd - frameStart).count(), Milliseconds(renderEnd - renderStart).count());
+        }
+    }
+
+    if (writeFrames)
+        m_postProcess->StopCapture(); // waits for the writer to finish the queued PNGs
+
+    if (gpuTiming)
+    {
+        gpuTimer.Flush(gpuSamples);
+        gpuTimer.Shutdown();
+    }
+    for (const GpuTimer::Sample& sample : gpuSamples)
+        report.SetGpuTime(sample.frame, sample.ms);
+
+    report.LogSummary();
+
+    FrameTimeReport::RunInfo info;
+    info.renderer = reinterpret_cast<const char*>(GL::GetString(GL_RENDERER));
+    info.width = m_offscreen->GetWidth();
+    info.height = m_offscreen->GetHeight();
+    info.tickRate = clock.GetTickRate();
+    info.settleFrames = settleFrames;
+    if (report.WriteJson(options.reportPath, info))
+        Logger::Instance().Log(Logger::Severity::Event, "Flythrough: report written to %s", options.reportPath.c_str());
+    else
+        Logger::Instance().Log(Logger::Severity::Error, "Flythrough: could not write %s", options.reportPath.c_str());
+}
+
 void Engine::GameLoop()
 {
     m_lastFrameTime = glfwGetTime();
@@ -247,10 +526,19 @@ void Engine::Step()
     m_lastFrameTime = currentFrameTime;
 
     glfwPollEvents();
-    m_input->Update(m_deltaTime);
-    if (m_controlBindings)
-        m_controlBindings->TickRebindCapture(m_window, *m_input);
-    Update();
+
+    // Fixed-step simulation: physics/AI see the same dt at any render rate, so dash distance
+    // and collision no longer depend on the FPS cap. Input is sampled once per tick so
+    // triggered keys fire exactly once even when a frame runs several (or zero) ticks.
+    SimulationClock& clock = SimulationClock::Instance();
+    const int ticks = clock.BeginFrame(m_deltaTime);
+    for (int i = 0; i < ticks && m_gameStateManager->HasState(); ++i)
+    {
+        m_input->Update(clock.GetFixedDelta());
+        if (m_controlBindings)
+            m_controlBindings->TickRebindCapture(m_window, *m_input);
+        Update();
+    }
 
     if (m_returnToSplashRequested)
     {
@@ -265,6 +553,7 @@ void Engine::Step()
             m_gameStateManager->Clear();
             m_gameStateManager->PushState(std::make_unique<SplashState>(*m_gameStateManager));
         }
+        SimulationClock::Instance().Reset();
     }
 
     if (m_returnToMainMenuRequested)
@@ -280,6 +569,7 @@ void Engine::Step()
             m_gameStateManager->Clear();
             m_gameStateManager->PushState(std::make_unique<MainMenu>(*m_gameStateManager));
         }
+        SimulationClock::Instance().Reset();
     }
 
 #ifdef __APPLE__
@@ -295,26 +585,15 @@ void Engine::Step()
 #endif
 
     SyncPostProcessDisplaySize();
-
-    // When the top state bypasses post-processing (e.g. settings UI),
-    // render everything to the FBO normally but present with exposure=1.0
-    // so the UI is not affected by scene darkening effects.
-    const bool bypass = m_gameStateManager->TopBypassesPostProcess();
-    m_postProcess->SetPassthrough(bypass);
-
-    m_postProcess->BeginScene();
-    m_gameStateManager->Draw();
-    m_postProcess->EndScene();
-    m_postProcess->ApplyAndPresent();
-    m_gameStateManager->DrawForegroundAfterPostProcess();
-
-    m_postProcess->SetPassthrough(false);
+    RenderFrame();
 
     if (m_imguiManager && !m_isFullscreen)
     {
         m_imguiManager->BeginFrame(m_deltaTime);
         m_imguiManager->DrawDebugWindow();
         m_imguiManager->EndFrame();
+        // The ImGui backend binds programs/textures/VAOs directly; don't trust the shadowed state.
+        GL::InvalidateStateCache();
     }
 
 #if defined(__linux__) && !defined(__EMSCRIPTEN__)
@@ -327,12 +606,62 @@ void Engine::Step()
     // swap interval 0 so the loop can run uncapped, including fullscreen.
     glfwMakeContextCurrent(m_window);
     glfwSwapInterval(m_vsyncEnabled ? 1 : 0);
+
+    // Dynamic resolution is driven by busy time: the FPS-cap sleep already happens outside Step,
+    // and with VSync the swap mostly waits for the display, so it is left out of the sample.
+    if (m_vsyncEnabled)
+        UpdateDynamicResolution(currentFrameTime);
     glfwSwapBuffers(m_window);
+    if (!m_vsyncEnabled)
+        UpdateDynamicResolution(currentFrameTime);
+}
+
+void Engine::RenderFrame()
+{
+    // When the top state bypasses post-processing (e.g. settings UI),
+    // render everything to the FBO normally but present with exposure=1.0
+    // so the UI is not affected by scene darkening effects.
+    const bool bypass = m_gameStateManager->TopBypassesPostProcess();
+    m_postProcess->SetPassthrough(bypass);
+
+    AssetCache::Instance().PumpUploads(TEXTURE_UPLOAD_BUDGET_MS);
+
+    m_spriteBatch->ResetFrameStats();
+    m_spriteInstancer->ResetFrameStats();
+    m_renderQueue->ResetFrameStats();
+    GL::ResetStateStats();
+    m_postProcess->BeginScene();
+    m_gameStateManager->Draw();
+    m_postProcess->EndScene();
+    m_postProcess->ApplyAndPresent();
+    m_gameStateManager->DrawForegroundAfterPostProcess();
+    m_postProcess->CaptureFrame();
+
+    m_postProcess->SetPassthrough(false);
+}
+
+void Engine::UpdateDynamicResolution(double frameStartTime)
+{
+    double targetHz = 60.0;
+    if (m_vsyncEnabled)
+    {
+        GLFWmonitor* monitor = glfwGetWindowMonitor(m_window);
+        if (!monitor)
+            monitor = glfwGetPrimaryMonitor();
+        const GLFWvidmode* mode = monitor ? glfwGetVideoMode(monitor) : nullptr;
+        if (mode && mode->refreshRate > 0)
+            targetHz = mode->refreshRate;
+    }
+    else if (m_fpsCap > 0)
+    {
+        targetHz = m_fpsCap;
+    }
+    m_postProcess->UpdateDynamicResolution((glfwGetTime() - frameStartTime) * 1000.0, 1000.0 / targetHz);
 }
 
 void Engine::Update()
 {
-    m_gameStateManager->Update(m_deltaTime);
+    m_gameStateManager->Update(SimulationClock::Instance().GetFixedDelta());
 }
 
 Math::ivec2 Engine::GetRecommendedResolution()
@@ -592,6 +921,18 @@ void Engine::SetFpsCap(int cap)
 #endif
 }
 
+void Engine::SetSimulationRate(int hz)
+{
+    SimulationClock::Instance().SetTickRate(hz);
+    Logger::Instance().Log(Logger::Severity::Event, "Simulation rate set to %d Hz",
+        SimulationClock::Instance().GetTickRate());
+}
+
+int Engine::GetSimulationRate() const
+{
+    return SimulationClock::Instance().GetTickRate();
+}
+
 void Engine::RequestReturnToSplash()
 {
     m_returnToSplashRequested = true;
@@ -632,6 +973,9 @@ void Engine::RequestShutdown()
 
 void Engine::Shutdown()
 {
+    // Drains the capture PBOs, which needs the context that is destroyed below.
+    if (m_postProcess)
+        m_postProcess->StopCapture();
     m_gameStateManager->Clear();
 
     if (m_imguiManager)
@@ -640,6 +984,18 @@ void Engine::Shutdown()
         m_imguiManager.reset();
     }
 
+    m_renderQueue.reset();
+    if (m_spriteBatch)
+    {
+        m_spriteBatch->Shutdown();
+        m_spriteBatch.reset();
+    }
+    if (m_spriteInstancer)
+    {
+        m_spriteInstancer->Shutdown();
+        m_spriteInstancer.reset();
+    }
+
     if (m_window) {
 #if defined(__linux__) && defined(GAM200_HAVE_XFIXES)
         if (Display* dpy = glfwGetX11Display())
@@ -672,6 +1028,17 @@ void Engine::Shutdown()
         m_postProcess.reset();
     }
 
-    glfwTerminate();
+    // Anything still referenced here leaked past its owner's Shutdown; the context is gone either way.
+    AssetCache::Instance().StopLoaderThreads();
+    AssetCache::Instance().Clear();
+
+    // Last: every GL object above is deleted on this context.
+    if (m_offscreen)
+    {
+        m_offscreen->Destroy();
+        m_offscreen.reset();
+    }
+    else if (!m_headless)
+        glfwTerminate();
     Logger::Instance().Log(Logger::Severity::Info, "Engine Stopped");
 }
@@ -11,19 +11,42 @@
 
 struct GLFWwindow;
 class Shader;
+class SpriteBatch;
+class SpriteInstancer;
+class RenderQueue;
 class ImguiManager;
 class DroneConfigManager;
 class RobotConfigManager;
+class OffscreenContext;
 
 constexpr int VIRTUAL_WIDTH = 1920;
 constexpr int VIRTUAL_HEIGHT = 1080;
 
+struct FlythroughOptions
+{
+    double secondsPerZone = 5.0;       // measured pan time in each of the five zones
+    int settleFrames = 30;             // rendered first in each zone but not measured (stream-in, shader warm-up)
+    std::string reportPath = "flythrough_report.json";
+    std::string frameDirectory;        // empty: no frames written (PNGs go through the async FrameCapture)
+    int frameStride = 30;              // write every Nth measured frame
+};
+
 class Engine
 {
 public:
     Engine();
     ~Engine();
     bool Initialize(const std::string& windowTitle);
+    // Headless simulation: no window or GL context (GL:: runs on the null backend),
+    // GameplayState is ticked back-to-back at the fixed delta and ticks/sec is logged.
+    bool InitializeHeadless();
+    void RunHeadless(double simulatedSeconds);
+    bool IsHeadless() const { return m_headless; }
+    // Offscreen rendering: real GL on a surfaceless EGL context (software rasterised when there is no GPU),
+    // presenting into an FBO instead of a window. No ImGui, no window input.
+    bool InitializeOffscreen();
+    // Scripted camera pan through all five zones at the fixed delta; logs and writes per-frame CPU/GPU times.
+    void RunFlythrough(const FlythroughOptions& options);
     void GameLoop();
     void Step();
     void Shutdown();
@@ -41,6 +64,9 @@ public:
     ControlBindings& GetControlBindings() const { return *m_controlBindings; }
 
     Shader& GetTextureShader() const { return *m_textureShader; }
+    SpriteBatch& GetSpriteBatch() const { return *m_spriteBatch; }
+    SpriteInstancer& GetSpriteInstancer() const { return *m_spriteInstancer; }
+    RenderQueue& GetRenderQueue() const { return *m_renderQueue; }
 
     ImguiManager* GetImguiManager() const { return m_imguiManager.get(); }
     ImguiManager* GetImguiManager() { return m_imguiManager.get(); }
@@ -61,10 +87,15 @@ public:
     void SetFpsCap(int cap);
     bool IsVSyncEnabled() const { return m_vsyncEnabled; }
     int GetFpsCap() const { return m_fpsCap; }
+    // Fixed simulation tick rate (60 / 120 / 240 Hz), independent of the FPS cap.
+    void SetSimulationRate(int hz);
+    int GetSimulationRate() const;
     void SetSystemCursorVisible(bool visible);
 
 private:
     void Update();
+    // Upload budget, scene, post-process and foreground: everything Step draws before ImGui and the swap.
+    void RenderFrame();
 
     static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
     static void FramebufferSizeCallback(GLFWwindow* window, int width, int height);
@@ -72,9 +103,12 @@ private:
     static void CursorEnterCallback(GLFWwindow* window, int entered);
     void OnFramebufferResize(int newScreenWidth, int newScreenHeight);
     void SyncPostProcessDisplaySize();
+    void UpdateDynamicResolution(double frameStartTime);
     void ApplyCustomCursorHidden();
 
     GLFWwindow* m_window = nullptr;
+    bool m_headless = false;
+    std::unique_ptr<OffscreenContext> m_offscreen;
 
     const int m_width = VIRTUAL_WIDTH;
     const int m_height = VIRTUAL_HEIGHT;
@@ -86,6 +120,9 @@ private:
     std::unique_ptr<ControlBindings> m_controlBindings;
 
     std::unique_ptr<Shader> m_textureShader;
+    std::unique_ptr<SpriteBatch> m_spriteBatch;
+    std::unique_ptr<SpriteInstancer> m_spriteInstancer;
+    std::unique_ptr<RenderQueue> m_renderQueue;
 
     std::unique_ptr<ImguiManager> m_imguiManager;
     std::shared_ptr<DroneConfigManager> m_droneConfigManager;
@@ -0,0 +1,137 @@
+//FrameTimeReport.cpp
+
+#include "FrameTimeReport.hpp"
+#include "Logger.hpp"
+#include "../ThirdParty/json/nlohmann_json.hpp"
+#include <algorithm>
+#include <fstream>
+
+namespace
+{
+    nlohmann::json ToJson(int count, double avg, double p50, double p95, double max)
+    {
+        return { { "frames", count }, { "avgMs", avg }, { "p50Ms", p50 }, { "p95Ms", p95 }, { "maxMs", max } };
+    }
+}
+
+long long FrameTimeReport::AddFrame(int section, double updateMs, double renderMs)
+{
+    m_frames.push_back({ section, updateMs, renderMs });
+    return static_cast<long long>(m_frames.size()) - 1;
+}
+
+void FrameTimeReport::SetGpuTime(long long frame, double ms)
+{
+    if (frame >= 0 && frame < static_cast<long long>(m_frames.size()))
+        m_frames[static_cast<size_t>(frame)].gpuMs = ms;
+}
+
+FrameTimeReport::Summary FrameTimeReport::Summarize(std::vector<double> values)
+{
+    Summary summary;
+    if (values.empty())
+        return summary;
+
+    std::sort(values.begin(), values.end());
+    double total = 0.0;
+    for (double value : values)
+        total += value;
+
+    // Nearest-rank percentiles.
+    const auto percentile = [&values](double p) {
+        const size_t rank = static_cast<size_t>(p * static_cast<double>(values.size() - 1) + 0.5);
+        return values[std::min(rank, values.size() - 1)];
+    };
+    summary.count = static_cast<int>(values.size());
+    summary.avg = total / static_cast<double>(values.size());
+    summary.p50 = percentile(0.50);
+    summary.p95 = percentile(0.95);
+    summary.max = values.back();
+    return summary;
+}
+
+FrameTimeReport::Summary FrameTimeReport::SummarizeSection(int section, Metric metric) const
+{
+    std::vector<double> values;
+    for (const Frame& frame : m_frames)
+    {
+        if (section >= 0 && frame.section != section)
+            continue;
+        switch (metric)
+        {
+        case Metric::Cpu:    values.push_back(frame.updateMs + frame.renderMs); break;
+        case Metric::Render: values.push_back(frame.renderMs); break;
+        case Metric::Gpu:    if (frame.gpuMs >= 0.0) values.push_back(frame.gpuMs); break;
+        }
+    }
+    return Summarize(std::move(values));
+}
+
+void FrameTimeReport::LogSummary() const
+{
+    const int sectionCount = static_cast<int>(m_sectionNames.size());
+    for (int section = -1; section < sectionCount; ++section)
+    {
+        const Summary cpu = SummarizeSection(section, Metric::Cpu);
+        if (cpu.count == 0)
+            continue;
+        const Summary render = SummarizeSection(section, Metric::Render);
+        const Summary gpu = SummarizeSection(section, Metric::Gpu);
+        const char* name = section < 0 ? "All" : m_sectionNames[static_cast<size_t>(section)].c_str();
+        if (gpu.count > 0)
+        {
+            Logger::Instance().Log(Logger::Severity::Event,
+                "Frame times %-11s %4d frames | CPU avg %.2f p95 %.2f max %.2f ms (render %.2f) | GPU avg %.2f p95 %.2f max %.2f ms",
+                name, cpu.count, cpu.avg, cpu.p95, cpu.max, render.avg, gpu.avg, gpu.p95, gpu.max);
+        }
+        else
+        {
+            Logger::Instance().Log(Logger::Severity::Event,
+                "Frame times %-11s %4d frames | CPU avg %.2f p95 %.2f max %.2f ms (render %.2f) | GPU n/a",
+                name, cpu.count, cpu.avg, cpu.p95, cpu.max, render.avg);
+        }
+    }
+}
+
+bool FrameTimeReport::WriteJson(const std::string& path, const RunInfo& info) const
+{
+    nlohmann::json root;
+    root["renderer"] = info.renderer;
+    root["width"] = info.width;
+    root["height"] = info.height;
+    root["tickRate"] = info.tickRate;
+    root["settleFrames"] = info.settleFrames;
+
+    const auto sectionJson = [this](int section) {
+        nlohmann::json entry;
+        for (const auto& [key, metric] : { std::pair{ "cpu", Metric::Cpu }, std::pair{ "render", Metric::Render }, std::pair{ "gpu", Metric::Gpu } })
+        {
+            const Summary summary = SummarizeSection(section, metric);
+            entry[key] = summary.count > 0 ? ToJson(summary.count, summary.avg, summary.p50, summary.p95, summary.max) : nlohmann::json();
+        }
+        return entry;
+    };
+
+    nlohmann::json sections = nlohmann::json::object();
+    for (size_t i = 0; i < m_sectionNames.size(); ++i)
+        sections[m_sectionNames[i]] = sectionJson(static_cast<int>(i));
+    root["sections"] = std::move(sections);
+    root["total"] = sectionJson(-1);
+
+    nlohmann::json frames = nlohmann::json::array();
+    for (const Frame& frame : m_frames)
+    {
+        frames.push_back({
+            { "section", m_sectionNames[static_cast<size_t>(frame.section)] },
+            { "updateMs", frame.updateMs },
+            { "renderMs", frame.renderMs },
+            { "gpuMs", frame.gpuMs >= 0.0 ? nlohmann::json(frame.gpuMs) : nlohmann::json() } });
+    }
+    root["frames"] = std::move(frames);
+
+    std::ofstream file(path);
+    if (!file)
+        return false;
+    file << root.dump(2);
+    return static_cast<bool>(file);
+}
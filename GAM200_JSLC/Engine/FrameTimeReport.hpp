@@ -0,0 +1,63 @@
+//FrameTimeReport.hpp
+
+#pragma once
+#include <string>
+#include <vector>
+
+/**
+ * @brief Per-frame CPU/GPU times of a benchmark run, split into named sections (flythrough zones).
+ *
+ * CPU time is split into simulation (fixed ticks) and render submission; GPU time comes from
+ * GpuTimer and arrives a few frames late, so it is attached by frame index. LogSummary prints
+ * avg / p50 / p95 / max per section, WriteJson stores the same plus every frame for CI diffs.
+ */
+class FrameTimeReport
+{
+public:
+    struct RunInfo
+    {
+        std::string renderer; // GL_RENDERER
+        int width = 0;
+        int height = 0;
+        int tickRate = 0;
+        int settleFrames = 0;
+    };
+
+    explicit FrameTimeReport(std::vector<std::string> sectionNames) : m_sectionNames(std::move(sectionNames)) {}
+
+    /// Returns the frame index GPU time is reported against.
+    long long AddFrame(int section, double updateMs, double renderMs);
+    void SetGpuTime(long long frame, double ms);
+    /// Index the next AddFrame will return.
+    long long GetFrameCount() const { return static_cast<long long>(m_frames.size()); }
+
+    void LogSummary() const;
+    /// Returns false if the file can't be written.
+    bool WriteJson(const std::string& path, const RunInfo& info) const;
+
+private:
+    struct Frame
+    {
+        int section = 0;
+        double updateMs = 0.0;
+        double renderMs = 0.0;
+        double gpuMs = -1.0; // < 0: no timer query result
+    };
+
+    struct Summary
+    {
+        int count = 0;
+        double avg = 0.0;
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double max = 0.0;
+    };
+
+    enum class Metric { Cpu, Render, Gpu }; // Cpu = update + render submission
+
+    static Summary Summarize(std::vector<double> values);
+    Summary SummarizeSection(int section, Metric metric) const;
+
+    std::vector<std::string> m_sectionNames;
+    std::vector<Frame> m_frames;
+};
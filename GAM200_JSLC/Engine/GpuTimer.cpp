@@ -0,0 +1,89 @@
+//GpuTimer.cpp
+
+#include "GpuTimer.hpp"
+#include "../OpenGL/GLWrapper.hpp"
+
+bool GpuTimer::Initialize()
+{
+#if defined(__EMSCRIPTEN__)
+    return false;
+#else
+    if (m_initialized)
+        return true;
+    for (Slot& slot : m_slots)
+        GL::GenQueries(1, &slot.query);
+    m_next = 0;
+    m_initialized = true;
+    return true;
+#endif
+}
+
+void GpuTimer::Shutdown()
+{
+    if (!m_initialized)
+        return;
+    if (m_active)
+        End();
+    for (Slot& slot : m_slots)
+    {
+        GL::DeleteQueries(1, &slot.query);
+        slot = Slot{};
+    }
+    m_initialized = false;
+}
+
+void GpuTimer::Begin(long long frame, std::vector<Sample>& out)
+{
+    if (!m_initialized || m_active)
+        return;
+
+    // Everything older than the slot about to be reused has had at least as long to finish; drain in order.
+    for (int i = 0; i < LATENCY; ++i)
+    {
+        Slot& slot = m_slots[(m_next + i) % LATENCY];
+        if (!slot.pending)
+            continue;
+        GLuint available = GL_FALSE;
+        GL::GetQueryObjectuiv(slot.query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available == GL_FALSE && i != 0)
+            break;
+        Resolve(slot, out); // i == 0 is the slot being reused: wait for it
+    }
+
+    Slot& slot = m_slots[m_next];
+    slot.frame = frame;
+    slot.pending = true;
+    GL::BeginQuery(GL_TIME_ELAPSED, slot.query);
+    m_active = true;
+}
+
+void GpuTimer::End()
+{
+    if (!m_active)
+        return;
+    GL::EndQuery(GL_TIME_ELAPSED);
+    m_active = false;
+    m_next = (m_next + 1) % LATENCY;
+}
+
+void GpuTimer::Flush(std::vector<Sample>& out)
+{
+    if (m_active)
+        End();
+    for (int i = 0; i < LATENCY; ++i)
+    {
+        Slot& slot = m_slots[(m_next + i) % LATENCY];
+        if (slot.pending)
+            Resolve(slot, out);
+    }
+}
+
+void GpuTimer::Resolve(Slot& slot, std::vector<Sample>& out)
+{
+#if !defined(__EMSCRIPTEN__)
+    GLuint64 elapsedNs = 0;
+    GL::GetQueryObjectui64v(slot.query, GL_QUERY_RESULT, &elapsedNs);
+    out.push_back({ slot.frame, static_cast<double>(elapsedNs) / 1.0e6 });
+#endif
+    slot.pending = false;
+}
@@ -0,0 +1,54 @@
+//GpuTimer.hpp
+
+#pragma once
+#include <array>
+#include <vector>
+
+/**
+ * @brief GPU time per frame from a ring of GL_TIME_ELAPSED queries.
+ *
+ * Begin/End bracket the GL work of one frame. Results are read back LATENCY frames later so the CPU
+ * never waits on the GPU while it is still behind; once the ring is full, Begin blocks on the oldest
+ * query, which also keeps the driver from queueing frames without bound. Native GL only.
+ */
+class GpuTimer
+{
+public:
+    struct Sample
+    {
+        long long frame = 0;
+        double ms = 0.0;
+    };
+
+    static constexpr int LATENCY = 4;
+
+    GpuTimer() = default;
+    GpuTimer(const GpuTimer&) = delete;
+    GpuTimer& operator=(const GpuTimer&) = delete;
+    ~GpuTimer() { Shutdown(); }
+
+    /// False on builds without timer queries (web); Begin/End are then no-ops.
+    bool Initialize();
+    void Shutdown();
+
+    /// Finished frames are appended to out, oldest first.
+    void Begin(long long frame, std::vector<Sample>& out);
+    void End();
+    /// Appends every frame still in flight, waiting for the GPU to finish them.
+    void Flush(std::vector<Sample>& out);
+
+private:
+    struct Slot
+    {
+        unsigned int query = 0;
+        long long frame = 0;
+        bool pending = false;
+    };
+
+    void Resolve(Slot& slot, std::vector<Sample>& out);
+
+    std::array<Slot, LATENCY> m_slots{};
+    int m_next = 0;
+    bool m_active = false; // Begin issued, End not yet
+    bool m_initialized = false;
+};
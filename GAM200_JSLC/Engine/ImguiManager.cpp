@@ -4,6 +4,12 @@
 #include "Engine.hpp"
 #include "ControlBindings.hpp"
 #include "Logger.hpp"
+#include "SimulationClock.hpp"
+#include "SpriteBatch.hpp"
+#include "SpriteInstancer.hpp"
+#include "RenderQueue.hpp"
+#include "AssetCache.hpp"
+#include "TextureTracker.hpp"
 
 #include "../include/GLFW/glfw3.h"
 #include "../OpenGL/GLWrapper.hpp"
@@ -11,6 +17,9 @@
 #include "../Game/Drone.hpp"
 #include "../Game/Robot.hpp"
 #include "../Game/Underground.hpp"
+#include "../Game/ZoneStreamer.hpp"
+#include "../Game/Font.hpp"
+#include "../Game/StaticLayerCache.hpp"
 #include "../Engine/Vec2.hpp"
 
 #include "../ThirdParty/imgui/imgui.h"
@@ -221,6 +230,96 @@ void ImguiManager::DrawDebugWindow()
     ImGui::Begin("Performance");
     ImGui::Text("FPS: %d", m_averageFps);
     ImGui::Text("Frame Time: %.3f ms", 1000.0 / m_averageFps);
+    {
+        const SimulationClock& clock = SimulationClock::Instance();
+        ImGui::Text("Sim Ticks: %d / frame @ %d Hz (alpha %.2f)",
+            clock.GetLastFrameSubsteps(), clock.GetTickRate(), clock.GetInterpolationAlpha());
+        ImGui::Text("Dropped Sim Time: %.3f s", clock.GetDroppedTime());
+    }
+    if (m_engine)
+    {
+        const SpriteBatch::FrameStats& batchStats = m_engine->GetSpriteBatch().GetFrameStats();
+        ImGui::Text("Sprite Batch: %d sprites / %d draw calls (%d flushes)",
+            batchStats.sprites, batchStats.drawCalls, batchStats.flushes);
+        ImGui::Text("Culling: %d drawn / %d culled", batchStats.sprites, batchStats.culled);
+        const SpriteInstancer::FrameStats& instStats = m_engine->GetSpriteInstancer().GetFrameStats();
+        ImGui::Text("Instanced: %d sprites / %d draw calls (%d culled)",
+            instStats.instances, instStats.drawCalls, instStats.culled);
+        const RenderQueue::FrameStats& queueStats = m_engine->GetRenderQueue().GetFrameStats();
+        ImGui::Text("Render Queue: %d commands / %d pipeline runs", queueStats.commands, queueStats.runs);
+    }
+    {
+        const GL::StateStats& glState = GL::GetStateStats();
+        ImGui::Text("GL State: %d issued / %d elided", glState.issued, glState.elided);
+    }
+    if (m_engine)
+    {
+        const PostProcessManager& post = m_engine->GetPostProcess();
+        int sceneW = 0, sceneH = 0;
+        post.GetSceneSize(sceneW, sceneH);
+        ImGui::Text("Scene: %dx%d (scale %.2f%s)", sceneW, sceneH, post.GetSceneScale(),
+            post.IsDynamicResolution() ? ", dynamic" : "");
+        if (post.GetLastPassCount() > 0)
+            ImGui::Text("Post: %d pass(es)", post.GetLastPassCount());
+        else
+            ImGui::Text("Post: direct present");
+    }
+    if (m_engine)
+    {
+        PostProcessManager& post = m_engine->GetPostProcess();
+        if (post.IsCapturing())
+        {
+            const FrameCapture::Stats capture = post.GetCapture().GetStats();
+            ImGui::Text("Capture: %d written / %d dropped, main %.2f ms (peak %.2f)",
+                capture.written, capture.dropped, capture.lastMainMs, capture.peakMainMs);
+            if (ImGui::Button("Stop Capture"))
+                post.StopCapture();
+        }
+        else if (ImGui::Button("Capture Frames to captures/"))
+        {
+            post.StartCapture(FrameCaptureSettings{});
+        }
+    }
+    {
+        const AssetCache::Stats& assets = AssetCache::Instance().GetStats();
+        ImGui::Text("Textures: %d (%d refs, %.1f MB) hits %d / misses %d, %d pending",
+            assets.textures, assets.references, static_cast<double>(assets.vramBytes) / (1024.0 * 1024.0),
+            assets.hits, assets.misses, assets.pending);
+        const ZoneStreamer::Stats zones = ZoneStreamer::Instance().GetStats();
+        ImGui::Text("Zones: %d resident, %d/%d sprites (in %d / out %d)",
+            zones.residentZones, zones.residentSprites, zones.sprites, zones.loads, zones.evictions);
+        const TextCacheStats& text = Font::GetTextCacheStats();
+        ImGui::Text("Text Cache: %d strings (%.2f MB) hits %d / misses %d / evicted %d",
+            text.entries, static_cast<double>(text.residentBytes) / (1024.0 * 1024.0),
+            text.hits, text.misses, text.evictions);
+        const StaticLayerStats& layers = StaticLayerCache::GetStats();
+        ImGui::Text("Static Layers: %d tiles (%.1f MB), %d rebuilds",
+            layers.tiles, static_cast<double>(layers.residentBytes) / (1024.0 * 1024.0), layers.rebuilds);
+    }
+    {
+        const TextureTracker& tracker = TextureTracker::Instance();
+        const TextureTracker::Totals& totals = tracker.GetTotals();
+        ImGui::Text("Texture Memory: %.1f MB live / %.1f MB peak, %d allocations",
+            static_cast<double>(totals.bytes) / (1024.0 * 1024.0),
+            static_cast<double>(totals.peakBytes) / (1024.0 * 1024.0), totals.allocations);
+        if (ImGui::TreeNode("Texture Memory by Owner"))
+        {
+            for (const auto& [owner, stats] : tracker.GetOwners())
+            {
+                ImGui::Text("%-16s %4d  %7.2f MB (peak %.2f MB)", owner.c_str(), stats.allocations,
+                    static_cast<double>(stats.bytes) / (1024.0 * 1024.0),
+                    static_cast<double>(stats.peakBytes) / (1024.0 * 1024.0));
+            }
+            if (ImGui::Button("Dump to texture_report.json"))
+            {
+                if (tracker.WriteReport("texture_report.json"))
+                    Logger::Instance().Log(Logger::Severity::Event, "Texture report written to texture_report.json");
+                else
+                    Logger::Instance().Log(Logger::Severity::Error, "Failed to write texture_report.json");
+            }
+            ImGui::TreePop();
+        }
+    }
 
     if (m_hasWarningLevel)
     {
@@ -338,6 +437,36 @@ void ImguiManager::DrawSettingsPanel()
         ImGui::TextDisabled("  FPS Cap is disabled while VSync is ON.");
     }
 
+    // Simulation tick rate (fixed-step physics; rendering interpolates between ticks)
+    static const char* simRateLabels[] = { "60 Hz", "120 Hz", "240 Hz" };
+    static const int   simRateValues[] = { 60, 120, 240 };
+    if (ImGui::Combo("Simulation Rate", &m_simRateIndex, simRateLabels, 3))
+    {
+        if (m_engine)
+            m_engine->SetSimulationRate(simRateValues[m_simRateIndex]);
+    }
+
+    // Scene FBO render scale (the foreground UI pass stays at native resolution)
+    if (m_engine)
+    {
+        PostProcessManager& post = m_engine->GetPostProcess();
+        float renderScale = post.GetRenderScale();
+        if (ImGui::SliderFloat("Render Scale", &renderScale, 0.5f, 1.0f, "%.2f"))
+            post.SetRenderScale(renderScale);
+        bool dynamicResolution = post.IsDynamicResolution();
+        if (ImGui::Checkbox("Dynamic Resolution", &dynamicResolution))
+            post.SetDynamicResolution(dynamicResolution);
+        ImGui::SameLine();
+        ImGui::TextDisabled("(?)");
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::BeginTooltip();
+            ImGui::Text("Lowers the scene resolution while frames miss their budget");
+            ImGui::Text("and raises it back up to Render Scale when there is headroom.");
+            ImGui::EndTooltip();
+        }
+    }
+
     ImGui::Spacing();
     ImGui::SeparatorText("Current Status");
 
@@ -107,6 +107,7 @@ private:
     // Settings tab state
     bool m_vsyncEnabled = false;
     int  m_fpsCapIndex  = 0; // index into s_fpsCapOptions
+    int  m_simRateIndex = 1; // 0 = 60 Hz, 1 = 120 Hz, 2 = 240 Hz
     void DrawSettingsPanel();
 };
 
@@ -116,6 +116,10 @@ namespace Input
         m_mouseButtonStatePrevious = m_mouseButtonState;
         m_gamepadPrev = m_gamepadCurr;
 
+        // Headless runs have no window: keep every key/button released.
+        if (!m_window)
+            return;
+
         for (int key = 0; key <= GLFW_KEY_LAST; ++key)
             m_keyState[static_cast<size_t>(key)] = glfwGetKey(m_window, key);
 
@@ -69,4 +69,10 @@ namespace Math
         mat.m[0][0] = 1.0f; mat.m[1][1] = 1.0f; mat.m[2][2] = 1.0f; mat.m[3][3] = 1.0f;
         return mat;
     }
+
+    Vec2 Matrix::TransformPoint(const Vec2& p) const
+    {
+        return { m[0][0] * p.x + m[1][0] * p.y + m[3][0],
+                 m[0][1] * p.x + m[1][1] * p.y + m[3][1] };
+    }
 }
\ No newline at end of file
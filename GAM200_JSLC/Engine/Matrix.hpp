@@ -17,6 +17,9 @@ namespace Math
         static Matrix CreateRotation(float degrees);
         static Matrix CreateIdentity();
 
+        // Applies the matrix to (p.x, p.y, 0, 1); used to pre-transform batched sprite corners on the CPU.
+        Vec2 TransformPoint(const Vec2& p) const;
+
         const float* const Ptr() const { return &m[0][0]; }
 
     private:
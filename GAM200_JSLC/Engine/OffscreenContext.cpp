@@ -0,0 +1,181 @@
+//OffscreenContext.cpp
+
+#include "OffscreenContext.hpp"
+#include "Logger.hpp"
+#include "TextureTracker.hpp"
+#include "../OpenGL/GLWrapper.hpp"
+#include <cstring>
+
+#if defined(GAM200_HAVE_EGL)
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+#if defined(GAM200_HAVE_EGL)
+namespace
+{
+    bool HasExtension(const char* extensions, const char* name)
+    {
+        if (!extensions)
+            return false;
+        const size_t length = std::strlen(name);
+        for (const char* at = std::strstr(extensions, name); at; at = std::strstr(at + length, name))
+        {
+            const bool startsWord = (at == extensions || at[-1] == ' ');
+            const bool endsWord = (at[length] == ' ' || at[length] == '\0');
+            if (startsWord && endsWord)
+                return true;
+        }
+        return false;
+    }
+
+    EGLDisplay OpenDisplay()
+    {
+        // Surfaceless needs no X11/Wayland server or DRM device; fall back to whatever the default is.
+        const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay && HasExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+        {
+            EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if (display != EGL_NO_DISPLAY)
+                return display;
+        }
+        return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+}
+#endif
+
+bool OffscreenContext::Create()
+{
+#if defined(GAM200_HAVE_EGL)
+    EGLDisplay display = OpenDisplay();
+    EGLint major = 0;
+    EGLint minor = 0;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "Offscreen: no EGL display (0x%04X)", eglGetError());
+        return false;
+    }
+    m_display = display;
+
+    if (!HasExtension(eglQueryString(display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context"))
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "Offscreen: EGL %d.%d has no EGL_KHR_surfaceless_context", major, minor);
+        Destroy();
+        return false;
+    }
+    if (!eglBindAPI(EGL_OPENGL_API))
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "Offscreen: EGL cannot bind desktop OpenGL (0x%04X)", eglGetError());
+        Destroy();
+        return false;
+    }
+
+    const EGLint configAttributes[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+        EGL_NONE
+    };
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount == 0)
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "Offscreen: no RGBA8 OpenGL EGL config");
+        Destroy();
+        return false;
+    }
+
+    // Same version and profile the GLFW window asks for.
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+    if (context == EGL_NO_CONTEXT)
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "Offscreen: GL 3.3 core context creation failed (0x%04X)", eglGetError());
+        Destroy();
+        return false;
+    }
+    m_context = context;
+
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "Offscreen: eglMakeCurrent failed (0x%04X)", eglGetError());
+        Destroy();
+        return false;
+    }
+
+    Logger::Instance().Log(Logger::Severity::Info, "Offscreen: EGL %d.%d surfaceless context (%s)",
+        major, minor, eglQueryString(display, EGL_VENDOR));
+    return true;
+#else
+    Logger::Instance().Log(Logger::Severity::Error, "Offscreen: this build has no EGL support (GAM200_HAVE_EGL)");
+    return false;
+#endif
+}
+
+bool OffscreenContext::CreateTarget(int width, int height)
+{
+    m_width = width;
+    m_height = height;
+
+    GL::GenRenderbuffers(1, &m_colorRenderbuffer);
+    GL::BindRenderbuffer(GL_RENDERBUFFER, m_colorRenderbuffer);
+    GL::RenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    TextureTracker::Instance().TrackRenderbuffer(m_colorRenderbuffer, width, height, GL_RGBA8, "Offscreen");
+
+    // GLFW's default framebuffer has depth/stencil too; keep the same attachments.
+    GL::GenRenderbuffers(1, &m_depthStencilRenderbuffer);
+    GL::BindRenderbuffer(GL_RENDERBUFFER, m_depthStencilRenderbuffer);
+    GL::RenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+    TextureTracker::Instance().TrackRenderbuffer(m_depthStencilRenderbuffer, width, height, GL_DEPTH24_STENCIL8, "Offscreen");
+    GL::BindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    GL::GenFramebuffers(1, &m_framebuffer);
+    GL::SetDefaultFramebuffer(m_framebuffer);
+    GL::BindFramebuffer(GL_FRAMEBUFFER, m_framebuffer);
+    GL::FramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_colorRenderbuffer);
+    GL::FramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_depthStencilRenderbuffer);
+    const GLenum status = GL::CheckFramebufferStatus(GL_FRAMEBUFFER);
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "Offscreen: target %dx%d incomplete (status=%u)", width, height, status);
+        return false;
+    }
+    return true;
+}
+
+void OffscreenContext::Destroy()
+{
+    if (m_framebuffer)
+    {
+        GL::SetDefaultFramebuffer(0);
+        GL::DeleteFramebuffers(1, &m_framebuffer);
+        m_framebuffer = 0;
+    }
+    for (unsigned int* renderbuffer : { &m_colorRenderbuffer, &m_depthStencilRenderbuffer })
+    {
+        if (*renderbuffer == 0)
+            continue;
+        TextureTracker::Instance().UntrackRenderbuffer(*renderbuffer);
+        GL::DeleteRenderbuffers(1, renderbuffer);
+        *renderbuffer = 0;
+    }
+
+#if defined(GAM200_HAVE_EGL)
+    if (m_display)
+    {
+        eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (m_context)
+            eglDestroyContext(m_display, m_context);
+        eglTerminate(m_display);
+    }
+#endif
+    m_context = nullptr;
+    m_display = nullptr;
+}
@@ -0,0 +1,40 @@
+//OffscreenContext.hpp
+
+#pragma once
+
+/**
+ * @brief GL 3.3 core context with no window or display, for frame-time benchmarks on CI machines.
+ *
+ * Created through EGL on Mesa's surfaceless platform. Without a GPU, Mesa runs it on its software
+ * rasteriser (llvmpipe), which is what OSMesa used to provide. Since there is no window-system
+ * framebuffer, an RGBA8 + depth/stencil FBO the size of the virtual screen is registered as
+ * GL's default framebuffer (GL::SetDefaultFramebuffer), so PostProcessManager "presents" into it.
+ *
+ * Linux builds with libEGL only (GAM200_HAVE_EGL); elsewhere Create() logs and fails.
+ */
+class OffscreenContext
+{
+public:
+    OffscreenContext() = default;
+    OffscreenContext(const OffscreenContext&) = delete;
+    OffscreenContext& operator=(const OffscreenContext&) = delete;
+    ~OffscreenContext() { Destroy(); }
+
+    /// Creates the context and makes it current. GL entry points must be loaded before CreateTarget.
+    bool Create();
+    /// Allocates the stand-in window framebuffer and registers it as the default framebuffer.
+    bool CreateTarget(int width, int height);
+    void Destroy();
+
+    int GetWidth() const { return m_width; }
+    int GetHeight() const { return m_height; }
+
+private:
+    void* m_display = nullptr; // EGLDisplay
+    void* m_context = nullptr; // EGLContext
+    unsigned int m_framebuffer = 0;
+    unsigned int m_colorRenderbuffer = 0;
+    unsigned int m_depthStencilRenderbuffer = 0;
+    int m_width = 0;
+    int m_height = 0;
+};
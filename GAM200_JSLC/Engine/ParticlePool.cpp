@@ -0,0 +1,122 @@
+//ParticlePool.cpp
+
+#include "ParticlePool.hpp"
+#include <algorithm>
+
+ParticlePool::ParticlePool(size_t capacity)
+    : posX(capacity), posY(capacity), velX(capacity), velY(capacity), sizeX(capacity), sizeY(capacity),
+      life(capacity), maxLife(capacity), alpha(capacity), auxX(capacity), auxY(capacity), tag(capacity),
+      m_capacity(capacity)
+{
+}
+
+size_t ParticlePool::Emit(const Spawn& spawn)
+{
+    if (m_capacity == 0 || spawn.life <= 0.0f)
+        return 0;
+
+    size_t slot = m_next;
+    if (IsAlive(slot) && m_alive < m_capacity)
+    {
+        // Mixed lifetimes leave dead slots around a live cursor; take one of those before overwriting.
+        for (size_t i = 1; i < m_capacity; ++i)
+        {
+            const size_t candidate = (m_next + i) % m_capacity;
+            if (!IsAlive(candidate))
+            {
+                slot = candidate;
+                break;
+            }
+        }
+    }
+    m_next = (slot + 1) % m_capacity;
+    m_span = std::max(m_span, slot + 1);
+    if (!IsAlive(slot))
+        ++m_alive;
+
+    posX[slot] = spawn.position.x;
+    posY[slot] = spawn.position.y;
+    velX[slot] = spawn.velocity.x;
+    velY[slot] = spawn.velocity.y;
+    sizeX[slot] = spawn.size.x;
+    sizeY[slot] = spawn.size.y;
+    life[slot] = spawn.life;
+    maxLife[slot] = spawn.life;
+    alpha[slot] = spawn.alpha;
+    auxX[slot] = spawn.aux.x;
+    auxY[slot] = spawn.aux.y;
+    tag[slot] = spawn.tag;
+    return slot;
+}
+
+void ParticlePool::Integrate(float dt, float gravityY)
+{
+    if (m_alive == 0)
+        return;
+
+    float* px = posX.data();
+    float* py = posY.data();
+    float* vx = velX.data();
+    float* vy = velY.data();
+    float* lf = life.data();
+    const size_t n = m_span;
+
+    // Dead slots get a zero step instead of a branch, which keeps the loop vectorisable.
+    for (size_t i = 0; i < n; ++i)
+    {
+        const float step = lf[i] > 0.0f ? dt : 0.0f;
+        vy[i] += gravityY * step;
+        px[i] += vx[i] * step;
+        py[i] += vy[i] * step;
+        lf[i] -= step;
+    }
+    CountAlive();
+}
+
+void ParticlePool::Age(float dt)
+{
+    if (m_alive == 0)
+        return;
+
+    float* lf = life.data();
+    const size_t n = m_span;
+    for (size_t i = 0; i < n; ++i)
+        lf[i] -= lf[i] > 0.0f ? dt : 0.0f;
+    CountAlive();
+}
+
+void ParticlePool::Kill(size_t slot)
+{
+    if (slot >= m_span || !IsAlive(slot))
+        return;
+    life[slot] = 0.0f;
+    if (--m_alive == 0)
+        Clear();
+}
+
+void ParticlePool::Clear()
+{
+    std::fill(life.begin(), life.begin() + static_cast<std::ptrdiff_t>(m_span), 0.0f);
+    m_next = 0;
+    m_span = 0;
+    m_alive = 0;
+}
+
+float ParticlePool::LifeT(size_t slot) const
+{
+    if (maxLife[slot] <= 0.0f)
+        return 0.0f;
+    return std::clamp(life[slot] / maxLife[slot], 0.0f, 1.0f);
+}
+
+void ParticlePool::CountAlive()
+{
+    const float* lf = life.data();
+    size_t alive = 0;
+    for (size_t i = 0; i < m_span; ++i)
+        alive += lf[i] > 0.0f ? 1u : 0u;
+    m_alive = alive;
+    // Once everything has expired, restart the ring so the next burst is packed at the front.
+    if (m_alive == 0)
+        Clear();
+}
@@ -0,0 +1,71 @@
+//ParticlePool.hpp
+
+#pragma once
+#include "Vec2.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Fixed-capacity particle storage laid out as structure-of-arrays.
+ *
+ * Emit() writes into a ring of slots, skipping ahead to a dead one when the cursor lands on a
+ * live particle; only once the pool is full is a live (the oldest in ring order) slot reused,
+ * instead of erasing from the front of a vector. Slots in [0, Span()) are either alive
+ * (life > 0) or dead; the update loops run over the whole span without branching so they
+ * vectorise, and callers skip dead slots with IsAlive() when reading.
+ *
+ * Columns are public: emitters read and write them directly for their own effect logic
+ * (splashes, hit tests). aux and tag are free for the emitter, e.g. an arc endpoint or a
+ * packed animation frame.
+ */
+class ParticlePool
+{
+public:
+    struct Spawn
+    {
+        Math::Vec2 position{};
+        Math::Vec2 velocity{};
+        Math::Vec2 size{};
+        float life = 0.0f;
+        float alpha = 1.0f;
+        Math::Vec2 aux{};
+        std::uint32_t tag = 0;
+    };
+
+    explicit ParticlePool(size_t capacity);
+
+    /// Returns the slot written: the first dead slot from the ring cursor on, or the slot under the
+    /// cursor (the oldest write in ring order) when every slot is alive.
+    size_t Emit(const Spawn& spawn);
+    /// Semi-implicit Euler (velocity, then position) plus ageing for every live slot.
+    void Integrate(float dt, float gravityY = 0.0f);
+    /// Ageing only, for particles that never move.
+    void Age(float dt);
+    void Kill(size_t slot);
+    void Clear();
+
+    size_t Capacity() const { return m_capacity; }
+    size_t Span() const { return m_span; }
+    size_t AliveCount() const { return m_alive; }
+    bool Empty() const { return m_alive == 0; }
+    bool IsAlive(size_t slot) const { return life[slot] > 0.0f; }
+    /// Remaining life in [0, 1]: 1 when just emitted, 0 when expired.
+    float LifeT(size_t slot) const;
+
+    std::vector<float> posX, posY;
+    std::vector<float> velX, velY;
+    std::vector<float> sizeX, sizeY;
+    std::vector<float> life, maxLife;
+    std::vector<float> alpha;
+    std::vector<float> auxX, auxY;
+    std::vector<std::uint32_t> tag;
+
+private:
+    void CountAlive();
+
+    size_t m_capacity = 0;
+    size_t m_next = 0;  // ring cursor
+    size_t m_span = 0;  // slots ever written since the pool was last empty
+    size_t m_alive = 0;
+};
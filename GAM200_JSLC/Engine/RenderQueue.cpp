@@ -0,0 +1,208 @@
+//RenderQueue.cpp
+
+#include "RenderQueue.hpp"
+#include "DebugRenderer.hpp"
+#include "Logger.hpp"
+#include "SpriteInstancer.hpp"
+#include "../OpenGL/GLWrapper.hpp"
+#include "../OpenGL/Shader.hpp"
+#include <algorithm>
+
+namespace
+{
+    constexpr int LAYER_SHIFT = 56;
+    constexpr int PIPELINE_SHIFT = 48;
+    constexpr int TEXTURE_SHIFT = 24;
+    constexpr uint64_t FIELD_MASK_24 = 0xFFFFFFu;
+}
+
+RenderQueue::Key RenderQueue::MakeKey(uint8_t layer, Pipeline pipeline, uint32_t texture, uint32_t depth)
+{
+    return (static_cast<Key>(layer) << LAYER_SHIFT)
+        | (static_cast<Key>(pipeline) << PIPELINE_SHIFT)
+        | ((static_cast<Key>(texture) & FIELD_MASK_24) << TEXTURE_SHIFT)
+        | (static_cast<Key>(depth) & FIELD_MASK_24);
+}
+
+RenderQueue::RenderQueue(SpriteBatch& batch, SpriteInstancer& instancer)
+    : m_batch(batch), m_instancer(instancer)
+{
+}
+
+void RenderQueue::Begin(const Math::Matrix& projection, Shader& colorShader, DebugRenderer& debugRenderer)
+{
+    if (m_active)
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "RenderQueue::Begin called twice without End");
+        End();
+    }
+    m_projection = projection;
+    m_colorShader = &colorShader;
+    m_debugRenderer = &debugRenderer;
+    m_active = true;
+    m_cullEnabled = false;
+    m_orderedLayers.reset();
+}
+
+void RenderQueue::SetCullRect(const Math::Rect& worldRect)
+{
+    m_cullRect = worldRect;
+    m_cullEnabled = true;
+}
+
+void RenderQueue::Push(uint8_t layer, Pipeline pipeline, uint32_t texture, uint32_t depth, Kind kind, size_t index)
+{
+    // Ordered layers: pipeline 0 / texture 0 for all, so only depth and the stable sort order them.
+    const Key key = m_orderedLayers.test(layer) ? MakeKey(layer, Pipeline::Custom, 0, depth)
+                                               : MakeKey(layer, pipeline, texture, depth);
+    m_commands.push_back({ key, static_cast<uint32_t>(index), kind, pipeline });
+}
+
+void RenderQueue::SubmitSprite(uint8_t layer, unsigned int textureID, const Math::Matrix& model,
+                               const SpriteUVRect& rect, bool flipX, float alpha, const SpriteTint& tint, uint32_t depth)
+{
+    if (!m_active || textureID == 0)
+        return;
+    Push(layer, Pipeline::Sprite, textureID, depth, Kind::Sprite, m_sprites.size());
+    m_sprites.push_back({ textureID, model, rect, tint, alpha, flipX });
+}
+
+void RenderQueue::SubmitBatch(uint8_t layer, BatchPass pass, uint32_t depth)
+{
+    if (!m_active)
+        return;
+    Push(layer, Pipeline::Sprite, 0, depth, Kind::Batch, m_batchPasses.size());
+    m_batchPasses.push_back(std::move(pass));
+}
+
+void RenderQueue::SubmitInstanced(uint8_t layer, InstancedPass pass, uint32_t depth)
+{
+    if (!m_active)
+        return;
+    Push(layer, Pipeline::Instanced, 0, depth, Kind::Instanced, m_instancedPasses.size());
+    m_instancedPasses.push_back(std::move(pass));
+}
+
+void RenderQueue::SubmitColor(uint8_t layer, ColorPass pass, uint32_t depth)
+{
+    if (!m_active)
+        return;
+    Push(layer, Pipeline::Color, 0, depth, Kind::Color, m_colorPasses.size());
+    m_colorPasses.push_back(std::move(pass));
+}
+
+void RenderQueue::SubmitCustom(uint8_t layer, CustomPass pass, uint32_t depth)
+{
+    if (!m_active)
+        return;
+    Push(layer, Pipeline::Custom, 0, depth, Kind::Custom, m_customPasses.size());
+    m_customPasses.push_back(std::move(pass));
+}
+
+void RenderQueue::OpenRun(Pipeline pipeline)
+{
+    ++m_frameStats.runs;
+    switch (pipeline)
+    {
+    case Pipeline::Sprite:
+        m_batch.Begin(m_projection);
+        if (m_cullEnabled)
+            m_batch.SetCullRect(m_cullRect);
+        break;
+    case Pipeline::Instanced:
+        m_instancer.Begin(m_projection, SpriteInstancer::SortMode::Texture);
+        if (m_cullEnabled)
+            m_instancer.SetCullRect(m_cullRect);
+        break;
+    case Pipeline::Color:
+        m_colorShader->use();
+        m_colorShader->setMat4("projection", m_projection);
+        m_colorShader->setFloat("uAlpha", 1.0f);
+        break;
+    case Pipeline::Custom:
+        break;
+    }
+}
+
+void RenderQueue::CloseRun(Pipeline pipeline)
+{
+    switch (pipeline)
+    {
+    case Pipeline::Sprite:
+        m_batch.End();
+        break;
+    case Pipeline::Instanced:
+        m_instancer.End();
+        break;
+    case Pipeline::Color:
+        m_debugRenderer->Flush();
+        break;
+    case Pipeline::Custom:
+        // Custom passes may change blending; later runs assume the default.
+        GL::Enable(GL_BLEND);
+        GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        break;
+    }
+}
+
+void RenderQueue::End()
+{
+    if (!m_active)
+        return;
+    m_active = false;
+
+    std::stable_sort(m_commands.begin(), m_commands.end(),
+        [](const Command& a, const Command& b) { return a.key < b.key; });
+
+    GL::Enable(GL_BLEND);
+    GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    bool runOpen = false;
+    Pipeline current = Pipeline::Custom;
+    for (const Command& command : m_commands)
+    {
+        const Pipeline pipeline = command.pipeline;
+        if (!runOpen || pipeline != current)
+        {
+            if (runOpen)
+                CloseRun(current);
+            OpenRun(pipeline);
+            current = pipeline;
+            runOpen = true;
+        }
+
+        switch (command.kind)
+        {
+        case Kind::Sprite:
+        {
+            const SpriteCommand& sprite = m_sprites[command.index];
+            m_batch.Draw(sprite.textureID, sprite.model, sprite.rect, sprite.flipX, sprite.alpha, sprite.tint);
+            break;
+        }
+        case Kind::Batch:
+            m_batchPasses[command.index](m_batch);
+            break;
+        case Kind::Instanced:
+            m_instancedPasses[command.index](m_instancer);
+            break;
+        case Kind::Color:
+            m_colorPasses[command.index](*m_colorShader, *m_debugRenderer);
+            break;
+        case Kind::Custom:
+            m_customPasses[command.index](m_projection);
+            break;
+        }
+    }
+    if (runOpen)
+        CloseRun(current);
+
+    m_frameStats.commands += static_cast<int>(m_commands.size());
+    m_commands.clear();
+    m_sprites.clear();
+    m_batchPasses.clear();
+    m_instancedPasses.clear();
+    m_colorPasses.clear();
+    m_customPasses.clear();
+    m_colorShader = nullptr;
+    m_debugRenderer = nullptr;
+}
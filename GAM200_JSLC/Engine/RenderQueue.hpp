@@ -0,0 +1,136 @@
+//RenderQueue.hpp
+
+#pragma once
+#include "Matrix.hpp"
+#include "Rect.hpp"
+#include "SpriteBatch.hpp"
+#include <bitset>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class DebugRenderer;
+class Shader;
+class SpriteInstancer;
+
+/**
+ * @brief One render pass of draw commands, sorted by a 64-bit key before anything reaches GL.
+ *
+ * Key layout, most significant bits first:
+ *   layer (8) | pipeline (8) | texture (24) | depth (24)
+ *
+ * Draw order between layers is explicit. Inside a layer, commands are grouped by pipeline and then by
+ * texture, so overlap order is only kept between commands that share both; anything that must stay on
+ * top of something else needs a higher layer. The sort is stable, so equal keys keep submission order.
+ *
+ * Layers marked with SetOrderedLayer drop pipeline and texture from the key (layer | depth only), so
+ * their commands draw by depth and then in submission order, at the cost of a batch break per switch.
+ *
+ * End() replays the sorted list: each run of one pipeline binds its shader and uploads the projection
+ * once, and consecutive sprite commands, even from different layers, feed one open SpriteBatch.
+ */
+class RenderQueue
+{
+public:
+    using Key = uint64_t;
+
+    enum class Pipeline : uint8_t
+    {
+        Custom,    // callback binds its own shader (sky gradient, outlines)
+        Sprite,    // SpriteBatch
+        Instanced, // SpriteInstancer, texture-sorted
+        Color      // solid_color shader + DebugRenderer
+    };
+
+    /// Draws into the open sprite batch (for systems that emit many sprites of their own).
+    using BatchPass = std::function<void(SpriteBatch& batch)>;
+    using InstancedPass = std::function<void(SpriteInstancer& instancer)>;
+    /// colorShader is bound with the pass projection and uAlpha = 1; debug shapes are flushed after the run.
+    using ColorPass = std::function<void(Shader& colorShader, DebugRenderer& debugRenderer)>;
+    using CustomPass = std::function<void(const Math::Matrix& projection)>;
+
+    struct FrameStats
+    {
+        int commands = 0;
+        int runs = 0; // pipeline switches (shader binds) actually issued
+    };
+
+    static Key MakeKey(uint8_t layer, Pipeline pipeline, uint32_t texture = 0, uint32_t depth = 0);
+
+    RenderQueue(SpriteBatch& batch, SpriteInstancer& instancer);
+
+    void Begin(const Math::Matrix& projection, Shader& colorShader, DebugRenderer& debugRenderer);
+    /// Forwarded to the batch and instancer runs of this pass.
+    void SetCullRect(const Math::Rect& worldRect);
+    /// nullptr when this pass does not cull (for custom passes that cull their own geometry).
+    const Math::Rect* GetCullRect() const { return m_cullEnabled ? &m_cullRect : nullptr; }
+    /// Keeps this pass's commands on layer in depth / submission order instead of grouping them by
+    /// texture (overlapping actors). Cleared by Begin(), since each pass numbers its layers afresh.
+    void SetOrderedLayer(uint8_t layer) { m_orderedLayers.set(layer); }
+
+    void SubmitSprite(uint8_t layer, unsigned int textureID, const Math::Matrix& model, const SpriteUVRect& rect = {},
+                      bool flipX = false, float alpha = 1.0f, const SpriteTint& tint = {}, uint32_t depth = 0);
+    void SubmitBatch(uint8_t layer, BatchPass pass, uint32_t depth = 0);
+    void SubmitInstanced(uint8_t layer, InstancedPass pass, uint32_t depth = 0);
+    void SubmitColor(uint8_t layer, ColorPass pass, uint32_t depth = 0);
+    void SubmitCustom(uint8_t layer, CustomPass pass, uint32_t depth = 0);
+
+    /// Sorts and draws everything submitted since Begin().
+    void End();
+
+    bool IsActive() const { return m_active; }
+
+    void ResetFrameStats() { m_frameStats = {}; }
+    const FrameStats& GetFrameStats() const { return m_frameStats; }
+
+private:
+    enum class Kind : uint8_t
+    {
+        Sprite,
+        Batch,
+        Instanced,
+        Color,
+        Custom
+    };
+
+    struct Command
+    {
+        Key key;
+        uint32_t index; // into the payload vector for kind
+        Kind kind;
+        Pipeline pipeline; // not always in the key (ordered layers)
+    };
+
+    struct SpriteCommand
+    {
+        unsigned int textureID;
+        Math::Matrix model;
+        SpriteUVRect rect;
+        SpriteTint tint;
+        float alpha;
+        bool flipX;
+    };
+
+    void Push(uint8_t layer, Pipeline pipeline, uint32_t texture, uint32_t depth, Kind kind, size_t index);
+    void OpenRun(Pipeline pipeline);
+    void CloseRun(Pipeline pipeline);
+
+    SpriteBatch& m_batch;
+    SpriteInstancer& m_instancer;
+    Shader* m_colorShader = nullptr;
+    DebugRenderer* m_debugRenderer = nullptr;
+
+    Math::Matrix m_projection = Math::Matrix::CreateIdentity();
+    bool m_active = false;
+    bool m_cullEnabled = false;
+    Math::Rect m_cullRect;
+    std::bitset<256> m_orderedLayers;
+
+    std::vector<Command> m_commands;
+    std::vector<SpriteCommand> m_sprites;
+    std::vector<BatchPass> m_batchPasses;
+    std::vector<InstancedPass> m_instancedPasses;
+    std::vector<ColorPass> m_colorPasses;
+    std::vector<CustomPass> m_customPasses;
+    FrameStats m_frameStats;
+};
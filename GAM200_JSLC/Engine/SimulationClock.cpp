@@ -0,0 +1,80 @@
+//SimulationClock.cpp
+
+#include "SimulationClock.hpp"
+#include <algorithm>
+
+namespace
+{
+    // Anything faster than this per tick is a teleport (checkpoint respawn, map transition,
+    // train re-anchor) rather than motion; blending across it would smear the sprite.
+    constexpr float kTeleportDistanceSq = 200.0f * 200.0f;
+}
+
+SimulationClock& SimulationClock::Instance()
+{
+    static SimulationClock instance;
+    return instance;
+}
+
+void SimulationClock::SetTickRate(int hz)
+{
+    if (hz <= 90)
+        m_tickRate = 60;
+    else if (hz <= 180)
+        m_tickRate = 120;
+    else
+        m_tickRate = 240;
+    m_fixedDelta = 1.0 / static_cast<double>(m_tickRate);
+    Reset();
+}
+
+void SimulationClock::SetMaxSubsteps(int maxSubsteps)
+{
+    m_maxSubsteps = std::max(1, maxSubsteps);
+}
+
+int SimulationClock::BeginFrame(double frameDt)
+{
+    if (frameDt < 0.0)
+        frameDt = 0.0;
+
+    m_accumulator += frameDt;
+
+    int steps = static_cast<int>(m_accumulator / m_fixedDelta);
+    if (steps > m_maxSubsteps)
+    {
+        // Hitch (window drag, blocking load): run the cap and drop the rest instead of
+        // trying to catch up, which would make the next frame even slower.
+        m_droppedTime += m_accumulator - m_fixedDelta * m_maxSubsteps;
+        steps = m_maxSubsteps;
+        m_accumulator = 0.0;
+    }
+    else
+    {
+        m_accumulator -= m_fixedDelta * steps;
+    }
+
+    m_alpha = static_cast<float>(std::clamp(m_accumulator / m_fixedDelta, 0.0, 1.0));
+    m_lastFrameSubsteps = steps;
+    if (steps > 0)
+        ++m_tickedFrame;
+    return steps;
+}
+
+void SimulationClock::Reset()
+{
+    m_accumulator = 0.0;
+    m_alpha = 0.0f;
+}
+
+Math::Vec2 SimulationClock::Interpolate(Math::Vec2 prev, Math::Vec2 curr, long long prevTickedFrame) const
+{
+    if (prevTickedFrame != m_tickedFrame || (curr - prev).LengthSq() > kTeleportDistanceSq)
+        return curr;
+    return Math::Lerp(prev, curr, m_alpha);
+}
+
+Math::Vec2 SimulationClock::InterpolationOffset(Math::Vec2 prev, Math::Vec2 curr, long long prevTickedFrame) const
+{
+    return Interpolate(prev, curr, prevTickedFrame) - curr;
+}
@@ -0,0 +1,66 @@
+//SimulationClock.hpp
+
+#pragma once
+#include "Vec2.hpp"
+
+/**
+ * @brief Fixed-timestep accumulator shared by the engine loop and draw code.
+ *
+ * Engine::Step feeds the measured frame time in, runs GameStateManager::Update once per
+ * returned tick with GetFixedDelta(), and draw code blends previous/current positions with
+ * GetInterpolationAlpha() so sprites stay smooth when the render rate exceeds the tick rate.
+ * Whatever stores a previous position also stores GetTickedFrame() with it; an object its owner
+ * didn't tick in the latest ticked frame (pause overlay, fades, inactive zones) draws at curr.
+ */
+class SimulationClock
+{
+public:
+    static SimulationClock& Instance();
+
+    static constexpr int DEFAULT_TICK_RATE = 120;
+    static constexpr int DEFAULT_MAX_SUBSTEPS = 8;
+
+    /// Accepts 60 / 120 / 240 Hz (other values snap to the nearest supported rate).
+    void SetTickRate(int hz);
+    int GetTickRate() const { return m_tickRate; }
+    double GetFixedDelta() const { return m_fixedDelta; }
+
+    /// Upper bound on ticks per frame; leftover time is dropped to avoid the spiral of death.
+    void SetMaxSubsteps(int maxSubsteps);
+    int GetMaxSubsteps() const { return m_maxSubsteps; }
+
+    /// Adds frameDt to the accumulator and returns how many fixed ticks to run this frame.
+    int BeginFrame(double frameDt);
+    /// Clears the accumulator (state changes, long loads) so the next frame starts on a tick boundary.
+    void Reset();
+
+    /// Fraction [0, 1) of a tick left in the accumulator after this frame's ticks ran.
+    float GetInterpolationAlpha() const { return m_alpha; }
+
+    /// Counts frames that ran at least one tick; record it alongside the previous position.
+    long long GetTickedFrame() const { return m_tickedFrame; }
+
+    /// Render position between the last two ticks. Large jumps (teleports, respawns) snap to curr,
+    /// as does a prev recorded before the latest ticked frame (the object wasn't ticked since).
+    Math::Vec2 Interpolate(Math::Vec2 prev, Math::Vec2 curr, long long prevTickedFrame) const;
+    /// Interpolate(prev, curr) - curr, for adding onto a position that has already been adjusted.
+    Math::Vec2 InterpolationOffset(Math::Vec2 prev, Math::Vec2 curr, long long prevTickedFrame) const;
+
+    int GetLastFrameSubsteps() const { return m_lastFrameSubsteps; }
+    double GetDroppedTime() const { return m_droppedTime; }
+
+    SimulationClock(const SimulationClock&) = delete;
+    void operator=(const SimulationClock&) = delete;
+
+private:
+    SimulationClock() = default;
+
+    int m_tickRate = DEFAULT_TICK_RATE;
+    double m_fixedDelta = 1.0 / DEFAULT_TICK_RATE;
+    int m_maxSubsteps = DEFAULT_MAX_SUBSTEPS;
+    double m_accumulator = 0.0;
+    float m_alpha = 0.0f;
+    long long m_tickedFrame = 0;
+    int m_lastFrameSubsteps = 0;
+    double m_droppedTime = 0.0;
+};
@@ -0,0 +1,207 @@
+//SpriteBatch.cpp
+
+#include "SpriteBatch.hpp"
+#include "Logger.hpp"
+#include "../OpenGL/GLWrapper.hpp"
+#include <algorithm>
+#include <cstddef>
+
+namespace
+{
+    // Unit quad shared with Background / Drone / Player VAOs: centred on the origin, UV (0,0) bottom-left.
+    constexpr float kCornerPos[4][2] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+    constexpr float kCornerUV[4][2]  = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+}
+
+SpriteBatch::SpriteBatch() = default;
+SpriteBatch::~SpriteBatch() = default;
+
+void SpriteBatch::Initialize()
+{
+    m_shader = std::make_unique<Shader>("OpenGL/Shaders/sprite_batch.vert", "OpenGL/Shaders/sprite_batch.frag");
+    m_shader->use();
+    m_shader->setInt("ourTexture", 0);
+    m_projectionUniform = m_shader->GetUniform("projection");
+
+    // Index pattern never changes: quad i uses vertices 4i..4i+3.
+    std::vector<unsigned short> indices(static_cast<size_t>(MAX_SPRITES_PER_DRAW) * 6);
+    for (int i = 0; i < MAX_SPRITES_PER_DRAW; ++i)
+    {
+        const unsigned short base = static_cast<unsigned short>(i * 4);
+        unsigned short* idx = &indices[static_cast<size_t>(i) * 6];
+        idx[0] = base;     idx[1] = base + 1; idx[2] = base + 2;
+        idx[3] = base;     idx[4] = base + 2; idx[5] = base + 3;
+    }
+
+    GL::GenVertexArrays(1, &m_VAO);
+    GL::GenBuffers(1, &m_VBO);
+    GL::GenBuffers(1, &m_EBO);
+    GL::BindVertexArray(m_VAO);
+
+    GL::BindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    GL::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(MAX_SPRITES_PER_DRAW) * 4 * sizeof(Vertex), nullptr, GL_STREAM_DRAW);
+
+    GL::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+    GL::BufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(unsigned short)), indices.data(), GL_STATIC_DRAW);
+
+    GL::VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, x));
+    GL::EnableVertexAttribArray(0);
+    GL::VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, u));
+    GL::EnableVertexAttribArray(1);
+    GL::VertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, tintR));
+    GL::EnableVertexAttribArray(2);
+    GL::VertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, alpha));
+    GL::EnableVertexAttribArray(3);
+
+    GL::BindVertexArray(0);
+
+    m_queue.reserve(MAX_SPRITES_PER_DRAW);
+    m_uploadScratch.reserve(static_cast<size_t>(MAX_SPRITES_PER_DRAW) * 4);
+}
+
+void SpriteBatch::Shutdown()
+{
+    GL::DeleteVertexArrays(1, &m_VAO);
+    GL::DeleteBuffers(1, &m_VBO);
+    GL::DeleteBuffers(1, &m_EBO);
+    m_VAO = 0;
+    m_VBO = 0;
+    m_EBO = 0;
+    m_shader.reset();
+    m_queue.clear();
+    m_active = false;
+}
+
+void SpriteBatch::Begin(const Math::Matrix& projection, SortMode sortMode)
+{
+    if (m_active)
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "SpriteBatch::Begin called twice without End");
+        Flush();
+    }
+    m_projection = projection;
+    m_sortMode = sortMode;
+    m_active = true;
+    m_cullEnabled = false;
+}
+
+void SpriteBatch::SetCullRect(const Math::Rect& worldRect)
+{
+    m_cullRect = worldRect;
+    m_cullEnabled = true;
+}
+
+void SpriteBatch::Draw(unsigned int textureID, const Math::Matrix& model, const UVRect& rect,
+                       bool flipX, float alpha, const Tint& tint)
+{
+    if (!m_active || textureID == 0)
+        return;
+
+    Math::Vec2 world[4];
+    for (int i = 0; i < 4; ++i)
+        world[i] = model.TransformPoint({ kCornerPos[i][0], kCornerPos[i][1] });
+
+    if (m_cullEnabled)
+    {
+        float minX = world[0].x, maxX = world[0].x;
+        float minY = world[0].y, maxY = world[0].y;
+        for (int i = 1; i < 4; ++i)
+        {
+            minX = std::min(minX, world[i].x); maxX = std::max(maxX, world[i].x);
+            minY = std::min(minY, world[i].y); maxY = std::max(maxY, world[i].y);
+        }
+        if (maxX < m_cullRect.bottom_left.x || minX > m_cullRect.top_right.x
+            || maxY < m_cullRect.bottom_left.y || minY > m_cullRect.top_right.y)
+        {
+            ++m_frameStats.culled;
+            return;
+        }
+    }
+
+    QueuedSprite sprite;
+    sprite.textureID = textureID;
+    for (int i = 0; i < 4; ++i)
+    {
+        const float u = flipX ? 1.0f - kCornerUV[i][0] : kCornerUV[i][0];
+        const float v = kCornerUV[i][1];
+
+        Vertex& vert = sprite.corners[i];
+        vert.x = world[i].x;
+        vert.y = world[i].y;
+        vert.u = u * rect.w + rect.x;
+        vert.v = v * rect.h + rect.y;
+        vert.tintR = tint.r;
+        vert.tintG = tint.g;
+        vert.tintB = tint.b;
+        vert.tintStrength = tint.strength;
+        vert.alpha = alpha;
+    }
+    m_queue.push_back(sprite);
+}
+
+void SpriteBatch::Flush()
+{
+    if (m_queue.empty())
+        return;
+
+    if (m_sortMode == SortMode::Texture)
+    {
+        std::stable_sort(m_queue.begin(), m_queue.end(),
+            [](const QueuedSprite& a, const QueuedSprite& b) { return a.textureID < b.textureID; });
+    }
+
+    GL::Enable(GL_BLEND);
+    GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    m_shader->use();
+    m_shader->setMat4(m_projectionUniform, m_projection);
+    GL::ActiveTexture(GL_TEXTURE0);
+    GL::BindVertexArray(m_VAO);
+    GL::BindBuffer(GL_ARRAY_BUFFER, m_VBO);
+
+    for (size_t first = 0; first < m_queue.size(); first += MAX_SPRITES_PER_DRAW)
+    {
+        const size_t count = std::min(m_queue.size() - first, static_cast<size_t>(MAX_SPRITES_PER_DRAW));
+        DrawRange(first, count);
+    }
+
+    GL::BindVertexArray(0);
+
+    m_frameStats.sprites += static_cast<int>(m_queue.size());
+    ++m_frameStats.flushes;
+    m_queue.clear();
+}
+
+void SpriteBatch::DrawRange(size_t first, size_t count)
+{
+    m_uploadScratch.clear();
+    for (size_t i = first; i < first + count; ++i)
+        m_uploadScratch.insert(m_uploadScratch.end(), std::begin(m_queue[i].corners), std::end(m_queue[i].corners));
+
+    // Orphan the previous contents so the driver does not stall on last flush's draws.
+    const GLsizeiptr bytes = static_cast<GLsizeiptr>(m_uploadScratch.size() * sizeof(Vertex));
+    GL::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(MAX_SPRITES_PER_DRAW) * 4 * sizeof(Vertex), nullptr, GL_STREAM_DRAW);
+    GL::BufferSubData(GL_ARRAY_BUFFER, 0, bytes, m_uploadScratch.data());
+
+    size_t runStart = 0;
+    while (runStart < count)
+    {
+        const unsigned int texture = m_queue[first + runStart].textureID;
+        size_t runEnd = runStart + 1;
+        while (runEnd < count && m_queue[first + runEnd].textureID == texture)
+            ++runEnd;
+
+        GL::BindTexture(GL_TEXTURE_2D, texture);
+        GL::DrawElements(GL_TRIANGLES, static_cast<GLsizei>((runEnd - runStart) * 6), GL_UNSIGNED_SHORT,
+            (void*)(runStart * 6 * sizeof(unsigned short)));
+        ++m_frameStats.drawCalls;
+
+        runStart = runEnd;
+    }
+}
+
+void SpriteBatch::End()
+{
+    Flush();
+    m_active = false;
+}
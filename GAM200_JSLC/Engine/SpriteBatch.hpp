@@ -0,0 +1,113 @@
+//SpriteBatch.hpp
+
+#pragma once
+#include "Matrix.hpp"
+#include "Rect.hpp"
+#include "../OpenGL/Shader.hpp"
+#include <memory>
+#include <vector>
+
+/// Sub-rectangle of the texture in UV space (same meaning as the simple.vert spriteRect uniform).
+struct SpriteUVRect
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float w = 1.0f;
+    float h = 1.0f;
+};
+
+/// rgb is mixed into the texel colour by strength (simple.frag colorTint / tintStrength).
+struct SpriteTint
+{
+    float r = 1.0f;
+    float g = 1.0f;
+    float b = 1.0f;
+    float strength = 0.0f;
+};
+
+/**
+ * @brief Collects textured quads into one streaming VBO and draws them in as few calls as possible.
+ *
+ * Each submitted sprite has its model matrix applied on the CPU, so UV rect, flip, alpha and tint
+ * travel as vertex attributes instead of uniforms. On Flush() consecutive sprites that share a
+ * texture collapse into a single glDrawElements.
+ *
+ * Anything drawn with another shader (colour quads, outlines, fonts) must be preceded by Flush()
+ * or End() so it still lands on top of the sprites queued before it.
+ */
+class SpriteBatch
+{
+public:
+    enum class SortMode
+    {
+        Deferred, // submission order; adjacent sprites with the same texture merge
+        Texture   // stable sort by texture first — only for sprites whose overlap order does not matter
+    };
+
+    using UVRect = SpriteUVRect;
+    using Tint = SpriteTint;
+
+    struct FrameStats
+    {
+        int sprites = 0;
+        int drawCalls = 0;
+        int flushes = 0;
+        int culled = 0;
+    };
+
+    SpriteBatch();
+    ~SpriteBatch();
+
+    void Initialize();
+    void Shutdown();
+
+    void Begin(const Math::Matrix& projection, SortMode sortMode = SortMode::Deferred);
+    /// World rectangle visible to the camera; Draw() drops sprites whose bounds miss it.
+    /// Only lasts until the next Begin(), so screen-space batches are never culled by accident.
+    void SetCullRect(const Math::Rect& worldRect);
+    void Draw(unsigned int textureID, const Math::Matrix& model, const UVRect& rect = {},
+              bool flipX = false, float alpha = 1.0f, const Tint& tint = {});
+    /// Draws everything queued so far; the batch stays open with the same projection.
+    void Flush();
+    void End();
+
+    bool IsActive() const { return m_active; }
+
+    void ResetFrameStats() { m_frameStats = {}; }
+    const FrameStats& GetFrameStats() const { return m_frameStats; }
+
+    static constexpr int MAX_SPRITES_PER_DRAW = 2048;
+
+private:
+    struct Vertex
+    {
+        float x, y;
+        float u, v;
+        float tintR, tintG, tintB, tintStrength;
+        float alpha;
+    };
+
+    struct QueuedSprite
+    {
+        unsigned int textureID;
+        Vertex corners[4];
+    };
+
+    void DrawRange(size_t first, size_t count);
+
+    std::unique_ptr<Shader> m_shader;
+    UniformHandle m_projectionUniform;
+    unsigned int m_VAO = 0;
+    unsigned int m_VBO = 0;
+    unsigned int m_EBO = 0;
+
+    Math::Matrix m_projection = Math::Matrix::CreateIdentity();
+    SortMode m_sortMode = SortMode::Deferred;
+    bool m_active = false;
+    bool m_cullEnabled = false;
+    Math::Rect m_cullRect;
+
+    std::vector<QueuedSprite> m_queue;
+    std::vector<Vertex> m_uploadScratch;
+    FrameStats m_frameStats;
+};
@@ -0,0 +1,264 @@
+//SpriteInstancer.cpp
+
+#include "SpriteInstancer.hpp"
+#include "Logger.hpp"
+#include "TextureTracker.hpp"
+#include "../OpenGL/GLWrapper.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace
+{
+    // Unit quad as two triangles, same corners as SpriteBatch (UV derived in the shader).
+    constexpr float kQuadVerts[] = {
+        -0.5f, -0.5f,   0.5f, -0.5f,   0.5f,  0.5f,
+        -0.5f, -0.5f,   0.5f,  0.5f,  -0.5f,  0.5f
+    };
+    constexpr size_t INITIAL_INSTANCE_CAPACITY = 256;
+    constexpr float DEG_TO_RAD = 3.1415926535f / 180.0f;
+}
+
+SpriteInstancer::SpriteInstancer() = default;
+SpriteInstancer::~SpriteInstancer() = default;
+
+void SpriteInstancer::Initialize()
+{
+    m_shader = std::make_unique<Shader>("OpenGL/Shaders/sprite_instanced.vert", "OpenGL/Shaders/sprite_instanced.frag");
+    m_shader->use();
+    m_shader->setInt("ourTexture", 0);
+    m_projectionUniform = m_shader->GetUniform("projection");
+
+    // Flat-colour instances sample this and take their colour from the tint.
+    const unsigned char white[4] = { 255, 255, 255, 255 };
+    GL::GenTextures(1, &m_whiteTexture);
+    GL::BindTexture(GL_TEXTURE_2D, m_whiteTexture);
+    GL::TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
+    TextureTracker::Instance().Track(m_whiteTexture, 0, 1, 1, GL_RGBA, "SpriteInstancer");
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    GL::BindTexture(GL_TEXTURE_2D, 0);
+
+    GL::GenVertexArrays(1, &m_VAO);
+    GL::GenBuffers(1, &m_quadVBO);
+    GL::GenBuffers(1, &m_instanceVBO);
+    GL::BindVertexArray(m_VAO);
+
+    GL::BindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
+    GL::BufferData(GL_ARRAY_BUFFER, sizeof(kQuadVerts), kQuadVerts, GL_STATIC_DRAW);
+    GL::VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    GL::EnableVertexAttribArray(0);
+
+    m_instanceCapacity = INITIAL_INSTANCE_CAPACITY;
+    GL::BindBuffer(GL_ARRAY_BUFFER, m_instanceVBO);
+    GL::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_instanceCapacity * sizeof(Instance)), nullptr, GL_STREAM_DRAW);
+    for (GLuint location = 1; location <= 4; ++location)
+    {
+        GL::EnableVertexAttribArray(location);
+        GL::VertexAttribDivisor(location, 1);
+    }
+    BindInstanceAttributes(0);
+
+    GL::BindVertexArray(0);
+    GL::BindBuffer(GL_ARRAY_BUFFER, 0);
+
+    m_queue.reserve(INITIAL_INSTANCE_CAPACITY);
+    m_uploadScratch.reserve(INITIAL_INSTANCE_CAPACITY);
+}
+
+void SpriteInstancer::Shutdown()
+{
+    GL::DeleteVertexArrays(1, &m_VAO);
+    GL::DeleteBuffers(1, &m_quadVBO);
+    GL::DeleteBuffers(1, &m_instanceVBO);
+    GL::DeleteTextures(1, &m_whiteTexture);
+    TextureTracker::Instance().Untrack(m_whiteTexture);
+    m_VAO = 0;
+    m_quadVBO = 0;
+    m_instanceVBO = 0;
+    m_whiteTexture = 0;
+    m_instanceCapacity = 0;
+    m_shader.reset();
+    m_queue.clear();
+    m_active = false;
+}
+
+void SpriteInstancer::BindInstanceAttributes(size_t firstInstance) const
+{
+    // Instance layout as four vec4s: (position, size), (cos, sin, alpha, ring), uv rect, tint.
+    constexpr GLsizei stride = sizeof(Instance);
+    const size_t base = firstInstance * sizeof(Instance);
+    GL::VertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(Instance, position)));
+    GL::VertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(Instance, cosAngle)));
+    GL::VertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(Instance, uv)));
+    GL::VertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(Instance, tint)));
+}
+
+void SpriteInstancer::Begin(const Math::Matrix& projection, SortMode sortMode)
+{
+    if (m_active)
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "SpriteInstancer::Begin called twice without End");
+        End();
+    }
+    m_projection = projection;
+    m_sortMode = sortMode;
+    m_active = true;
+    m_cullEnabled = false;
+}
+
+void SpriteInstancer::SetCullRect(const Math::Rect& worldRect)
+{
+    m_cullRect = worldRect;
+    m_cullEnabled = true;
+}
+
+void SpriteInstancer::Add(unsigned int textureID, const Instance& instance)
+{
+    if (!m_active)
+        return;
+
+    if (m_cullEnabled)
+    {
+        // Half extents of the rotated quad's bounding box.
+        const float hx = std::abs(instance.size.x) * 0.5f;
+        const float hy = std::abs(instance.size.y) * 0.5f;
+        const float c = std::abs(instance.cosAngle);
+        const float s = std::abs(instance.sinAngle);
+        const float ex = c * hx + s * hy;
+        const float ey = s * hx + c * hy;
+        const Math::Vec2 p = instance.position;
+        if (p.x + ex < m_cullRect.bottom_left.x || p.x - ex > m_cullRect.top_right.x
+            || p.y + ey < m_cullRect.bottom_left.y || p.y - ey > m_cullRect.top_right.y)
+        {
+            ++m_frameStats.culled;
+            return;
+        }
+    }
+
+    m_queue.push_back({ textureID != 0 ? textureID : m_whiteTexture, instance });
+}
+
+void SpriteInstancer::Add(unsigned int textureID, Math::Vec2 position, Math::Vec2 size, float rotationDegrees,
+                          bool flipX, float alpha, const SpriteUVRect& rect, const SpriteTint& tint)
+{
+    if (textureID == 0)
+        return;
+
+    Instance inst;
+    inst.position = position;
+    inst.size = size;
+    if (rotationDegrees != 0.0f)
+    {
+        inst.cosAngle = std::cos(rotationDegrees * DEG_TO_RAD);
+        inst.sinAngle = std::sin(rotationDegrees * DEG_TO_RAD);
+    }
+    inst.alpha = alpha;
+    inst.uv = rect;
+    if (flipX)
+    {
+        inst.uv.x = rect.x + rect.w;
+        inst.uv.w = -rect.w;
+    }
+    inst.tint = tint;
+    Add(textureID, inst);
+}
+
+void SpriteInstancer::AddQuad(Math::Vec2 center, Math::Vec2 size, float r, float g, float b, float alpha)
+{
+    Instance inst;
+    inst.position = center;
+    inst.size = size;
+    inst.alpha = alpha;
+    inst.tint = { r, g, b, 1.0f };
+    Add(0, inst);
+}
+
+void SpriteInstancer::AddLine(Math::Vec2 start, Math::Vec2 end, float thickness, float r, float g, float b, float alpha)
+{
+    const Math::Vec2 direction = end - start;
+    const float length = direction.Length();
+    if (length < 1e-4f)
+        return;
+
+    Instance inst;
+    inst.position = (start + end) * 0.5f;
+    inst.size = { length, std::max(0.15f, thickness) };
+    inst.cosAngle = direction.x / length;
+    inst.sinAngle = direction.y / length;
+    inst.alpha = alpha;
+    inst.tint = { r, g, b, 1.0f };
+    Add(0, inst);
+}
+
+void SpriteInstancer::AddRing(Math::Vec2 center, float radius, float width, float r, float g, float b, float alpha)
+{
+    const float outer = radius + width * 0.5f;
+    if (outer <= 0.0f)
+        return;
+
+    Instance inst;
+    inst.position = center;
+    inst.size = { outer * 2.0f, outer * 2.0f };
+    inst.alpha = alpha;
+    inst.ringWidth = std::clamp(width / outer, 0.0f, 1.0f);
+    inst.tint = { r, g, b, 1.0f };
+    Add(0, inst);
+}
+
+void SpriteInstancer::End()
+{
+    m_active = false;
+    if (m_queue.empty())
+        return;
+
+    if (m_sortMode == SortMode::Texture)
+    {
+        std::stable_sort(m_queue.begin(), m_queue.end(),
+            [](const Queued& a, const Queued& b) { return a.textureID < b.textureID; });
+    }
+
+    m_uploadScratch.clear();
+    for (const Queued& q : m_queue)
+        m_uploadScratch.push_back(q.instance);
+
+    GL::BindVertexArray(m_VAO);
+    GL::BindBuffer(GL_ARRAY_BUFFER, m_instanceVBO);
+    if (m_uploadScratch.size() > m_instanceCapacity)
+        m_instanceCapacity = std::max(m_uploadScratch.size(), m_instanceCapacity * 2);
+    // Re-specifying the store orphans last frame's instances instead of waiting on them.
+    GL::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_instanceCapacity * sizeof(Instance)), nullptr, GL_STREAM_DRAW);
+    GL::BufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(m_uploadScratch.size() * sizeof(Instance)),
+                      m_uploadScratch.data());
+
+    GL::Enable(GL_BLEND);
+    GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    m_shader->use();
+    m_shader->setMat4(m_projectionUniform, m_projection);
+    GL::ActiveTexture(GL_TEXTURE0);
+
+    size_t runStart = 0;
+    while (runStart < m_queue.size())
+    {
+        const unsigned int texture = m_queue[runStart].textureID;
+        size_t runEnd = runStart + 1;
+        while (runEnd < m_queue.size() && m_queue[runEnd].textureID == texture)
+            ++runEnd;
+
+        // No base-instance draw in GL 3.3 / WebGL2, so point the per-instance attributes at the run.
+        BindInstanceAttributes(runStart);
+        GL::BindTexture(GL_TEXTURE_2D, texture);
+        GL::DrawArraysInstanced(GL_TRIANGLES, 0, 6, static_cast<GLsizei>(runEnd - runStart));
+        ++m_frameStats.drawCalls;
+
+        runStart = runEnd;
+    }
+
+    BindInstanceAttributes(0);
+    GL::BindVertexArray(0);
+    GL::BindBuffer(GL_ARRAY_BUFFER, 0);
+
+    m_frameStats.instances += static_cast<int>(m_queue.size());
+    m_queue.clear();
+}
@@ -0,0 +1,101 @@
+//SpriteInstancer.hpp
+
+#pragma once
+#include "Matrix.hpp"
+#include "Rect.hpp"
+#include "SpriteBatch.hpp"
+#include "../OpenGL/Shader.hpp"
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Draws many copies of the same unit quad with glDrawArraysInstanced.
+ *
+ * Where SpriteBatch transforms four corners per sprite on the CPU, each entry here is a single
+ * 64-byte instance (centre, size, rotation, UV rect, tint, alpha) and the vertex shader builds
+ * the quad. Used for drones and for particle effects: textureID 0 draws a flat colour quad
+ * (white texel fully tinted), and a non-zero ring width masks the quad to a circle outline.
+ *
+ * Flush the sprite batch before Begin() if anything queued there must stay underneath.
+ */
+class SpriteInstancer
+{
+public:
+    enum class SortMode
+    {
+        Deferred, // submission order; adjacent instances with the same texture merge
+        Texture   // stable sort by texture first — only when overlap order between textures does not matter
+    };
+
+    struct Instance
+    {
+        Math::Vec2 position;   // quad centre in world space
+        Math::Vec2 size;
+        float cosAngle = 1.0f; // rotation about the centre, counter-clockwise
+        float sinAngle = 0.0f;
+        float alpha = 1.0f;
+        float ringWidth = 0.0f; // 0 = filled quad, else outline band as a fraction of the radius
+        SpriteUVRect uv;        // negative w mirrors horizontally
+        SpriteTint tint;
+    };
+
+    struct FrameStats
+    {
+        int instances = 0;
+        int drawCalls = 0;
+        int culled = 0;
+    };
+
+    SpriteInstancer();
+    ~SpriteInstancer();
+
+    void Initialize();
+    void Shutdown();
+
+    void Begin(const Math::Matrix& projection, SortMode sortMode = SortMode::Deferred);
+    /// Same meaning as SpriteBatch::SetCullRect; only lasts until the next Begin().
+    void SetCullRect(const Math::Rect& worldRect);
+
+    void Add(unsigned int textureID, const Instance& instance);
+    /// Whole-texture sprite; rotationDegrees matches Math::Matrix::CreateRotation.
+    void Add(unsigned int textureID, Math::Vec2 position, Math::Vec2 size, float rotationDegrees = 0.0f,
+             bool flipX = false, float alpha = 1.0f, const SpriteUVRect& rect = {}, const SpriteTint& tint = {});
+
+    void AddQuad(Math::Vec2 center, Math::Vec2 size, float r, float g, float b, float alpha = 1.0f);
+    /// Segment drawn as a quad of the given thickness (same footprint as DebugRenderer::DrawLine).
+    void AddLine(Math::Vec2 start, Math::Vec2 end, float thickness, float r, float g, float b, float alpha = 1.0f);
+    /// Circle outline; radius is the centre of the band.
+    void AddRing(Math::Vec2 center, float radius, float width, float r, float g, float b, float alpha = 1.0f);
+
+    void End();
+
+    void ResetFrameStats() { m_frameStats = {}; }
+    const FrameStats& GetFrameStats() const { return m_frameStats; }
+
+private:
+    struct Queued
+    {
+        unsigned int textureID;
+        Instance instance;
+    };
+
+    void BindInstanceAttributes(size_t firstInstance) const;
+
+    std::unique_ptr<Shader> m_shader;
+    UniformHandle m_projectionUniform;
+    unsigned int m_VAO = 0;
+    unsigned int m_quadVBO = 0;
+    unsigned int m_instanceVBO = 0;
+    unsigned int m_whiteTexture = 0;
+    size_t m_instanceCapacity = 0;
+
+    Math::Matrix m_projection = Math::Matrix::CreateIdentity();
+    SortMode m_sortMode = SortMode::Deferred;
+    bool m_active = false;
+    bool m_cullEnabled = false;
+    Math::Rect m_cullRect;
+
+    std::vector<Queued> m_queue;
+    std::vector<Instance> m_uploadScratch;
+    FrameStats m_frameStats;
+};
@@ -0,0 +1,239 @@
+//TextureTracker.cpp
+
+#include "TextureTracker.hpp"
+#include "../OpenGL/GLWrapper.hpp"
+#include "../ThirdParty/json/nlohmann_json.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+    size_t BytesPerTexel(unsigned int format)
+    {
+        switch (format)
+        {
+        case GL_RED:
+        case GL_R8:
+            return 1;
+        case GL_RG:
+        case GL_RG8:
+            return 2;
+        case GL_RGBA16F:
+            return 8;
+        case GL_RGBA32F:
+            return 16;
+        default: // RGBA8, unsized RGB / RGBA (padded to 4), DEPTH24_STENCIL8
+            return 4;
+        }
+    }
+
+    size_t LevelBytes(int width, int height, unsigned int format)
+    {
+        return static_cast<size_t>(std::max(width, 0)) * static_cast<size_t>(std::max(height, 0)) * BytesPerTexel(format);
+    }
+
+    std::string SiteString(const std::source_location& site)
+    {
+        std::string file = site.file_name();
+        const size_t slash = file.find_last_of("/\\");
+        if (slash != std::string::npos)
+            file.erase(0, slash + 1);
+        return file + ":" + std::to_string(site.line());
+    }
+
+    std::string FormatName(unsigned int format)
+    {
+        switch (format)
+        {
+        case GL_RGBA: return "RGBA";
+        case GL_RGBA8: return "RGBA8";
+        case GL_RGB: return "RGB";
+        case GL_RG8: return "RG8";
+        case GL_DEPTH24_STENCIL8: return "DEPTH24_STENCIL8";
+        default:
+        {
+            char hex[16];
+            std::snprintf(hex, sizeof(hex), "0x%04X", format);
+            return hex;
+        }
+        }
+    }
+}
+
+TextureTracker& TextureTracker::Instance()
+{
+    static TextureTracker instance;
+    return instance;
+}
+
+void TextureTracker::Track(unsigned int textureID, int level, int width, int height, unsigned int internalFormat,
+                           const char* owner, std::source_location site)
+{
+    if (textureID == 0)
+        return;
+
+    const uint64_t key = TextureKey(textureID);
+    auto it = m_allocations.find(key);
+    if (level > 0 && it != m_allocations.end())
+    {
+        Allocation& allocation = it->second;
+        allocation.levels = std::max(allocation.levels, level + 1);
+        Grow(allocation, LevelBytes(width, height, internalFormat));
+        return;
+    }
+
+    // Level 0 re-specifies the whole texture (e.g. an async placeholder replaced by the real image).
+    if (it != m_allocations.end())
+        Remove(key);
+
+    Allocation allocation;
+    allocation.owner = owner ? owner : "Unknown";
+    allocation.site = SiteString(site);
+    allocation.width = width;
+    allocation.height = height;
+    allocation.format = internalFormat;
+    allocation.levels = level + 1;
+    allocation.bytes = LevelBytes(width, height, internalFormat);
+    Add(key, std::move(allocation));
+}
+
+void TextureTracker::TrackMipChain(unsigned int textureID)
+{
+    auto it = m_allocations.find(TextureKey(textureID));
+    if (it == m_allocations.end())
+        return;
+
+    Allocation& allocation = it->second;
+    // Same level sizes as glGenerateMipmap: halve (rounding down) until 1x1.
+    int width = allocation.width;
+    int height = allocation.height;
+    int levels = 1;
+    size_t bytes = 0;
+    while (width > 1 || height > 1)
+    {
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+        bytes += LevelBytes(width, height, allocation.format);
+        ++levels;
+    }
+    if (levels <= allocation.levels)
+        return; // chain already specified level by level (cooked textures)
+    allocation.levels = levels;
+    Grow(allocation, bytes);
+}
+
+void TextureTracker::Untrack(unsigned int textureID)
+{
+    if (textureID != 0)
+        Remove(TextureKey(textureID));
+}
+
+void TextureTracker::TrackRenderbuffer(unsigned int renderbufferID, int width, int height, unsigned int internalFormat,
+                                       const char* owner, std::source_location site)
+{
+    if (renderbufferID == 0)
+        return;
+
+    const uint64_t key = RenderbufferKey(renderbufferID);
+    Remove(key);
+
+    Allocation allocation;
+    allocation.owner = owner ? owner : "Unknown";
+    allocation.site = SiteString(site);
+    allocation.width = width;
+    allocation.height = height;
+    allocation.format = internalFormat;
+    allocation.levels = 1;
+    allocation.bytes = LevelBytes(width, height, internalFormat);
+    Add(key, std::move(allocation));
+}
+
+void TextureTracker::UntrackRenderbuffer(unsigned int renderbufferID)
+{
+    if (renderbufferID != 0)
+        Remove(RenderbufferKey(renderbufferID));
+}
+
+void TextureTracker::Add(uint64_t key, Allocation allocation)
+{
+    OwnerStats& owner = m_owners[allocation.owner];
+    ++owner.allocations;
+    ++m_totals.allocations;
+    ++m_totals.created;
+
+    const size_t bytes = allocation.bytes;
+    allocation.bytes = 0;
+    Allocation& stored = m_allocations[key] = std::move(allocation);
+    Grow(stored, bytes);
+}
+
+void TextureTracker::Grow(Allocation& allocation, size_t bytes)
+{
+    allocation.bytes += bytes;
+    OwnerStats& owner = m_owners[allocation.owner];
+    owner.bytes += bytes;
+    owner.peakBytes = std::max(owner.peakBytes, owner.bytes);
+    m_totals.bytes += bytes;
+    m_totals.peakBytes = std::max(m_totals.peakBytes, m_totals.bytes);
+}
+
+void TextureTracker::Remove(uint64_t key)
+{
+    auto it = m_allocations.find(key);
+    if (it == m_allocations.end())
+        return;
+
+    const Allocation& allocation = it->second;
+    OwnerStats& owner = m_owners[allocation.owner];
+    --owner.allocations;
+    owner.bytes -= allocation.bytes;
+    --m_totals.allocations;
+    m_totals.bytes -= allocation.bytes;
+    ++m_totals.deleted;
+    m_allocations.erase(it);
+}
+
+bool TextureTracker::WriteReport(const std::string& path) const
+{
+    nlohmann::json root;
+    root["live"] = { { "allocations", m_totals.allocations }, { "bytes", m_totals.bytes } };
+    root["peakBytes"] = m_totals.peakBytes;
+    root["created"] = m_totals.created;
+    root["deleted"] = m_totals.deleted;
+
+    nlohmann::json owners = nlohmann::json::object();
+    for (const auto& [name, stats] : m_owners)
+        owners[name] = { { "allocations", stats.allocations }, { "bytes", stats.bytes }, { "peakBytes", stats.peakBytes } };
+    root["owners"] = std::move(owners);
+
+    std::vector<std::pair<uint64_t, const Allocation*>> sorted;
+    sorted.reserve(m_allocations.size());
+    for (const auto& [key, allocation] : m_allocations)
+        sorted.emplace_back(key, &allocation);
+    std::sort(sorted.begin(), sorted.end(),
+        [](const auto& a, const auto& b) { return a.second->bytes > b.second->bytes; });
+
+    nlohmann::json allocations = nlohmann::json::array();
+    for (const auto& [key, allocation] : sorted)
+    {
+        allocations.push_back({
+            { "id", static_cast<unsigned int>(key & 0xFFFFFFFFu) },
+            { "kind", (key >> 32) ? "renderbuffer" : "texture" },
+            { "owner", allocation->owner },
+            { "site", allocation->site },
+            { "width", allocation->width },
+            { "height", allocation->height },
+            { "format", FormatName(allocation->format) },
+            { "levels", allocation->levels },
+            { "bytes", allocation->bytes } });
+    }
+    root["allocations"] = std::move(allocations);
+
+    std::ofstream file(path);
+    if (!file)
+        return false;
+    file << root.dump(2);
+    return static_cast<bool>(file);
+}
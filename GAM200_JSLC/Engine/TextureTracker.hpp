@@ -0,0 +1,90 @@
+//TextureTracker.hpp
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <source_location>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief VRAM accounting for every texture and renderbuffer the game allocates.
+ *
+ * Each glTexImage2D site reports the level it just specified (Track), glGenerateMipmap sites add the
+ * chain (TrackMipChain) and each delete site reports the release (Untrack). Sizes are estimated from
+ * the internal format (unsized RGB counts as 4 bytes, as drivers pad it), not queried from the driver.
+ *
+ * owner names the subsystem the memory is charged to (textures shared through AssetCache are charged to
+ * the first acquirer); the creation site is captured automatically. Live and peak totals plus a per-owner
+ * breakdown are shown in the ImGui Performance window, and WriteReport dumps everything as JSON.
+ * Main thread only, like the GL calls it shadows.
+ */
+class TextureTracker
+{
+public:
+    static TextureTracker& Instance();
+
+    struct OwnerStats
+    {
+        int allocations = 0;
+        size_t bytes = 0;
+        size_t peakBytes = 0;
+    };
+
+    struct Totals
+    {
+        int allocations = 0;
+        size_t bytes = 0;
+        size_t peakBytes = 0;
+        int created = 0;
+        int deleted = 0;
+    };
+
+    /// Level 0 (re)specifies the texture and replaces what was recorded for it; higher levels add to it.
+    void Track(unsigned int textureID, int level, int width, int height, unsigned int internalFormat,
+               const char* owner, std::source_location site = std::source_location::current());
+    /// Adds the levels glGenerateMipmap builds below the recorded level 0.
+    void TrackMipChain(unsigned int textureID);
+    /// Safe to call with 0 or an untracked id.
+    void Untrack(unsigned int textureID);
+
+    void TrackRenderbuffer(unsigned int renderbufferID, int width, int height, unsigned int internalFormat,
+                           const char* owner, std::source_location site = std::source_location::current());
+    void UntrackRenderbuffer(unsigned int renderbufferID);
+
+    const Totals& GetTotals() const { return m_totals; }
+    /// Sorted by owner name.
+    const std::map<std::string, OwnerStats>& GetOwners() const { return m_owners; }
+
+    /// Totals, owners and every live allocation (largest first) as JSON. Returns false if the file can't be written.
+    bool WriteReport(const std::string& path) const;
+
+    TextureTracker(const TextureTracker&) = delete;
+    void operator=(const TextureTracker&) = delete;
+
+private:
+    TextureTracker() = default;
+
+    struct Allocation
+    {
+        std::string owner;
+        std::string site; // "File.cpp:123"
+        int width = 0;
+        int height = 0;
+        unsigned int format = 0;
+        int levels = 0;
+        size_t bytes = 0;
+    };
+
+    static uint64_t TextureKey(unsigned int id) { return id; }
+    static uint64_t RenderbufferKey(unsigned int id) { return (uint64_t{ 1 } << 32) | id; }
+
+    void Add(uint64_t key, Allocation allocation);
+    void Remove(uint64_t key);
+    void Grow(Allocation& allocation, size_t bytes);
+
+    std::unordered_map<uint64_t, Allocation> m_allocations;
+    std::map<std::string, OwnerStats> m_owners;
+    Totals m_totals;
+};
@@ -3,40 +3,58 @@
 #include "Background.hpp"
 #include "../OpenGL/GLWrapper.hpp"
 #include "../OpenGL/Shader.hpp"
+#include "../Engine/SpriteBatch.hpp"
+#include "../Engine/RenderQueue.hpp"
+#include "../Engine/AssetCache.hpp"
+#include "../Engine/TextureTracker.hpp"
+#include "../Engine/Logger.hpp"
+#include "ZoneStreamer.hpp"
 #include <iostream>
 
 #pragma warning(push, 0)
 #include <stb_image.h>
 #pragma warning(pop)
 
-void Background::Initialize(const char* texturePath)
+Background::~Background()
 {
-    int width, height, nrChannels;
-    stbi_set_flip_vertically_on_load(true);
-    unsigned char* data = stbi_load(texturePath, &width, &height, &nrChannels, 0);
+    if (m_streamZone >= 0)
+        ZoneStreamer::Instance().Unregister(this, m_streamZone);
+}
 
-    if (!data)
+void Background::Initialize(const char* texturePath, bool repeat)
+{
+    ZoneStreamer& streamer = ZoneStreamer::Instance();
+    if (m_streamZone >= 0)
+        streamer.Unregister(this, m_streamZone);
+    m_texturePath = texturePath;
+    m_repeat = repeat;
+    m_streamZone = streamer.GetCaptureZone();
+    if (m_streamZone >= 0)
+        streamer.Register(this, m_streamZone);
+
+    if (m_streamZone >= 0 && !streamer.IsResident(m_streamZone))
     {
-        std::cout << "Failed to load background texture: " << texturePath << std::endl;
-        return;
+        // Zone is far away: only read the size from the PNG header; the upload happens on stream-in.
+        int channels = 0;
+        if (!stbi_info(texturePath, &m_width, &m_height, &channels))
+            Logger::Instance().Log(Logger::Severity::Error, "Background: failed to read texture header: %s", texturePath);
+        m_cachedTexture = true;
+    }
+    else
+    {
+        AssetCache::TextureOptions options;
+        options.repeat = m_repeat;
+        options.async = true;
+        options.owner = "Background";
+        const AssetCache::Texture texture = AssetCache::Instance().AcquireTexture(texturePath, options);
+        if (texture.id == 0)
+            return;
+
+        m_textureID = texture.id;
+        m_width  = texture.width;
+        m_height = texture.height;
+        m_cachedTexture = true;
     }
-
-    m_width  = width;
-    m_height = height;
-
-    GL::GenTextures(1, &m_textureID);
-    GL::BindTexture(GL_TEXTURE_2D, m_textureID);
-
-    GLenum format = (nrChannels == 4) ? GL_RGBA : GL_RGB;
-    GL::TexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-    GL::GenerateMipmap(GL_TEXTURE_2D);
-
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    stbi_image_free(data);
 
     float vertices[] = {
         -0.5f,  0.5f,   0.0f, 1.0f,
@@ -93,6 +111,8 @@ void Background::InitializeWithBlackKeyTransparency(const char* texturePath, uns
     GL::BindTexture(GL_TEXTURE_2D, m_textureID);
     GL::TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
     GL::GenerateMipmap(GL_TEXTURE_2D);
+    TextureTracker::Instance().Track(m_textureID, 0, width, height, GL_RGBA, "Background");
+    TextureTracker::Instance().TrackMipChain(m_textureID);
 
     GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
@@ -130,7 +150,40 @@ void Background::Shutdown()
 {
     GL::DeleteVertexArrays(1, &VAO);
     GL::DeleteBuffers(1, &VBO);
-    GL::DeleteTextures(1, &m_textureID);
+    // Keyed textures are edited per instance, so only plain loads go through the cache.
+    if (m_cachedTexture)
+        AssetCache::Instance().ReleaseTexture(m_textureID);
+    else
+    {
+        GL::DeleteTextures(1, &m_textureID);
+        TextureTracker::Instance().Untrack(m_textureID);
+    }
+    VAO = 0;
+    VBO = 0;
+    m_textureID = 0;
+    m_cachedTexture = false;
+    if (m_streamZone >= 0)
+        ZoneStreamer::Instance().Unregister(this, m_streamZone);
+    m_streamZone = -1;
+}
+
+void Background::ReleaseStreamedTexture()
+{
+    if (!m_cachedTexture)
+        return;
+    AssetCache::Instance().ReleaseTexture(m_textureID);
+    m_textureID = 0;
+}
+
+void Background::AcquireStreamedTexture()
+{
+    if (!m_cachedTexture || m_textureID != 0 || m_texturePath.empty())
+        return;
+    AssetCache::TextureOptions options;
+    options.repeat = m_repeat;
+    options.async = true;
+    options.owner = "Background";
+    m_textureID = AssetCache::Instance().AcquireTexture(m_texturePath, options).id;
 }
 
 void Background::Draw(Shader& shader, const Math::Matrix& model)
@@ -149,4 +202,22 @@ void Background::Draw(Shader& shader, const Math::Matrix& model)
     GL::DrawArrays(GL_TRIANGLES, 0, 6);
 
     GL::BindVertexArray(0);
+}
+
+void Background::DrawOutline(Shader& outlineShader, const Math::Matrix& model)
+{
+    if (!m_cachedTexture || !AssetCache::Instance().BindOutlineField(m_textureID)) return;
+    Draw(outlineShader, model);
+}
+
+void Background::Draw(SpriteBatch& batch, const Math::Matrix& model, float alpha) const
+{
+    if (!m_textureID) return;
+    batch.Draw(m_textureID, model, {}, false, alpha);
+}
+
+void Background::Draw(RenderQueue& queue, uint8_t layer, const Math::Matrix& model, float alpha) const
+{
+    if (!m_textureID) return;
+    queue.SubmitSprite(layer, m_textureID, model, {}, false, alpha);
 }
\ No newline at end of file
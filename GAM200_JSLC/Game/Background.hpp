@@ -2,29 +2,52 @@
 
 #pragma once
 #include "../Engine/Matrix.hpp"
+#include <cstdint>
+#include <string>
 
 class Shader;
+class SpriteBatch;
+class RenderQueue;
 
 class Background
 {
 public:
     Background() = default;
+    ~Background();
+    // ZoneStreamer keeps raw pointers to registered sprites.
+    Background(const Background&) = delete;
+    Background& operator=(const Background&) = delete;
 
-    void Initialize(const char* texturePath);
+    /// repeat: GL_REPEAT wrap, for sprites drawn with UVs beyond [0,1] (tiling strips).
+    void Initialize(const char* texturePath, bool repeat = false);
     /// Load as RGBA; pixels darker than threshold become fully transparent (for UI cursors on black mats).
     void InitializeWithBlackKeyTransparency(const char* texturePath, unsigned char rgbMaxTransparent = 40);
     void Shutdown();
     void Draw(Shader& shader, const Math::Matrix& model);
+    /// Queues the texture on the batch instead of drawing immediately.
+    void Draw(SpriteBatch& batch, const Math::Matrix& model, float alpha = 1.0f) const;
+    /// Submits the texture to a render queue pass on the given layer.
+    void Draw(RenderQueue& queue, uint8_t layer, const Math::Matrix& model, float alpha = 1.0f) const;
+    /// Draw with outline.frag; skipped until AssetCache has this texture's outline field.
+    void DrawOutline(Shader& outlineShader, const Math::Matrix& model);
 
     int GetWidth()  const { return m_width; }
     int GetHeight() const { return m_height; }
 
     unsigned int GetTextureID() const { return m_textureID; }
 
+    /// ZoneStreamer hooks: drop / re-upload the texture, keeping size and quad.
+    void ReleaseStreamedTexture();
+    void AcquireStreamedTexture();
+
 private:
     unsigned int VAO = 0;
     unsigned int VBO = 0;
     unsigned int m_textureID = 0;
     int m_width  = 0;
     int m_height = 0;
+    bool m_cachedTexture = false;
+    bool m_repeat = false;
+    std::string m_texturePath;
+    int m_streamZone = -1;
 };
\ No newline at end of file
@@ -6,18 +6,17 @@
 #include "Rooftop.hpp"
 #include "Train.hpp"
 #include "../OpenGL/Shader.hpp"
+#include "../Engine/SpriteInstancer.hpp"
 #include "../Engine/Matrix.hpp"
 #include "../Engine/Logger.hpp"
+#include "../Engine/AssetCache.hpp"
 #include "../Engine/DebugRenderer.hpp"
+#include "../Engine/SimulationClock.hpp"
 #include "../OpenGL/GLWrapper.hpp"
 #include <cmath>
 #include <random>
 #include <algorithm>
 
-#pragma warning(push, 0)
-#include <stb_image.h>
-#pragma warning(pop)
-
 constexpr float PI = 3.14159265359f;
 constexpr float GROUND_LEVEL = 180.0f;
 constexpr float ROOFTOP_MIN_Y = 1080.0f;
@@ -33,6 +32,7 @@ void Drone::Init(Math::Vec2 startPos, const char* texturePath, bool isTracer)
 {
     m_spawnPos = startPos;
     m_position = startPos;
+    m_prevPosition = startPos;
     m_baseY = startPos.y;
     m_velocity = { 0.0f, 0.0f };
     m_direction = { 1.0f, 0.0f };
@@ -92,35 +92,21 @@ void Drone::Init(Math::Vec2 startPos, const char* texturePath, bool isTracer)
     GL::VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
     GL::EnableVertexAttribArray(1);
 
-    GL::GenTextures(1, &textureID);
-    GL::BindTexture(GL_TEXTURE_2D, textureID);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    int width, height, nrChannels;
-    stbi_set_flip_vertically_on_load(true);
-    unsigned char* data = stbi_load(texturePath, &width, &height, &nrChannels, 0);
+    // Shared across every drone with the same sprite; reinforcement waves no longer hit the disk.
+    AssetCache::TextureOptions texOptions;
+    texOptions.filter = AssetCache::Filter::LinearMipmap;
+    texOptions.repeat = true;
+    texOptions.async = true;
+    texOptions.owner = "Drone";
+    const AssetCache::Texture texture = AssetCache::Instance().AcquireTexture(m_texturePath, texOptions);
+    textureID = texture.id;
 
-    if (data)
+    if (textureID != 0)
     {
-        GLenum format = (nrChannels == 4) ? GL_RGBA : GL_RGB;
-        GL::TexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        GL::GenerateMipmap(GL_TEXTURE_2D);
-
         float desiredWidth = 120.0f;
-        float aspectRatio = static_cast<float>(height) / static_cast<float>(width);
+        float aspectRatio = static_cast<float>(texture.height) / static_cast<float>(texture.width);
         m_size = { desiredWidth, desiredWidth * aspectRatio };
-
-        Logger::Instance().Log(Logger::Severity::Info, "Drone texture loaded: %s", texturePath);
-    }
-    else
-    {
-        Logger::Instance().Log(Logger::Severity::Error, "Failed to load drone texture: %s", texturePath);
     }
-
-    stbi_image_free(data);
 }
 
 void Drone::SetBaseSpeed(float speed)
@@ -153,6 +139,8 @@ void Drone::Update(double dt, const Player& player, Math::Vec2 playerHitboxSize,
                     bool sirenTracerJamEvade, float sirenTracerSpeedMul, float sirenTracerTrainAssistMul)
 {
     const float fdt = static_cast<float>(dt);
+    m_prevPosition = m_position;
+    m_prevTickedFrame = SimulationClock::Instance().GetTickedFrame();
 
     if (m_isDead)
     {
@@ -699,12 +687,12 @@ void Drone::Update(double dt, const Player& player, Math::Vec2 playerHitboxSize,
     }
 }
 
-void Drone::Draw(const Shader& shader) const
+void Drone::Draw(SpriteInstancer& instancer) const
 {
     // 즉사(시체 페이드 없음)는 표시 안 함. 착지 시체는 알파로 페이드.
     if (m_isDead && m_corpseFadeAlpha <= 0.f && !m_isHit) return;
 
-    Math::Matrix rotationMatrix = Math::Matrix::CreateIdentity();
+    float rotation = 0.0f;
     bool flipX = false;
 
     if (m_isHit || m_isDead)
@@ -714,12 +702,12 @@ void Drone::Draw(const Shader& shader) const
         {
             wobble = std::sin(m_hitTimer * 20.0f) * 45.0f;
         }
-        rotationMatrix = Math::Matrix::CreateRotation(m_hitRotation + wobble);
+        rotation = m_hitRotation + wobble;
     }
     else if (m_isAttacking)
     {
         float tiltAngle = m_attackAngle + 90.0f * m_attackDirection;
-        rotationMatrix = Math::Matrix::CreateRotation(tiltAngle);
+        rotation = tiltAngle;
     }
     else if (m_isTracer)
     {
@@ -735,7 +723,7 @@ void Drone::Draw(const Shader& shader) const
                 baseAngle = std::atan2(m_direction.y, m_direction.x) * (180.0f / PI);
             }
 
-            rotationMatrix = Math::Matrix::CreateRotation(baseAngle + m_searchRotation);
+            rotation = baseAngle + m_searchRotation;
         }
         else if (m_velocity.LengthSq() > 0.01f)
         {
@@ -743,13 +731,13 @@ void Drone::Draw(const Shader& shader) const
             {
                 flipX = true;
                 float angle = std::atan2(m_velocity.y, -m_velocity.x) * (180.0f / PI);
-                rotationMatrix = Math::Matrix::CreateRotation(angle);
+                rotation = angle;
             }
             else
             {
                 flipX = false;
                 float angle = std::atan2(m_velocity.y, m_velocity.x) * (180.0f / PI);
-                rotationMatrix = Math::Matrix::CreateRotation(angle);
+                rotation = angle;
             }
         }
         else
@@ -762,7 +750,7 @@ void Drone::Draw(const Shader& shader) const
             else {
                 angle = std::atan2(m_direction.y, m_direction.x) * (180.0f / PI);
             }
-            rotationMatrix = Math::Matrix::CreateRotation(angle);
+            rotation = angle;
         }
     }
     else
@@ -770,8 +758,7 @@ void Drone::Draw(const Shader& shader) const
         flipX = (m_direction.x < 0.0f);
     }
 
-    Math::Matrix scaleMatrix = Math::Matrix::CreateScale(m_size);
-    Math::Vec2 drawPos       = m_position;
+    Math::Vec2 drawPos       = SimulationClock::Instance().Interpolate(m_prevPosition, m_position, m_prevTickedFrame);
     if (!m_isHit && m_stunTimer > 0.f)
     {
         // 감전: 고주파 sine 제거 — 저주파 + 약한 배음 + 스턴 남은 시간에 따른 감쇠
@@ -786,25 +773,11 @@ void Drone::Draw(const Shader& shader) const
         drawPos.y += shakeY;
     }
 
-    Math::Matrix transMatrix = Math::Matrix::CreateTranslation(drawPos);
-    Math::Matrix model       = transMatrix * rotationMatrix * scaleMatrix;
-
-    shader.use();
-    shader.setMat4("model", model);
-    shader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-    shader.setBool("flipX", flipX);
-    {
-        float drawAlpha = 1.f;
-        if (m_isDead && m_corpseFadeAlpha > 0.f)
-            drawAlpha = m_corpseFadeAlpha;
-        shader.setFloat("alpha", drawAlpha);
-    }
+    float drawAlpha = 1.f;
+    if (m_isDead && m_corpseFadeAlpha > 0.f)
+        drawAlpha = m_corpseFadeAlpha;
 
-    GL::ActiveTexture(GL_TEXTURE0);
-    GL::BindTexture(GL_TEXTURE_2D, textureID);
-    GL::BindVertexArray(VAO);
-    GL::DrawArrays(GL_TRIANGLES, 0, 6);
-    GL::BindVertexArray(0);
+    instancer.Add(textureID, drawPos, m_size, rotation, flipX, drawAlpha);
 }
 
 void Drone::DrawRadar(const Shader& colorShader, DebugRenderer& debugRenderer) const
@@ -886,7 +859,8 @@ void Drone::Shutdown()
 {
     GL::DeleteVertexArrays(1, &VAO);
     GL::DeleteBuffers(1, &VBO);
-    GL::DeleteTextures(1, &textureID);
+    AssetCache::Instance().ReleaseTexture(textureID);
+    textureID = 0;
     m_moveSound.Stop();
 }
 
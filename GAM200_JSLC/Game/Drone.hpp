@@ -6,6 +6,7 @@
 #include <string>
 
 class Shader;
+class SpriteInstancer;
 class Player;
 class DebugRenderer;
 
@@ -21,7 +22,7 @@ public:
     void Update(double dt, const Player& player, Math::Vec2 playerHitboxSize, bool isPlayerUndetectable,
                 bool sirenTracerJamEvade = false, float sirenTracerSpeedMul = 1.f,
                 float sirenTracerTrainAssistMul = 1.f);
-    void Draw(const Shader& shader) const;
+    void Draw(SpriteInstancer& instancer) const;
     void DrawRadar(const Shader& colorShader, DebugRenderer& debugRenderer) const;
     void DrawGauge(Shader& colorShader, DebugRenderer& debugRenderer) const;
     void Shutdown();
@@ -141,6 +142,8 @@ private:
 
     Math::Vec2 m_spawnPos;
     Math::Vec2 m_position;
+    Math::Vec2 m_prevPosition; // position at the start of the last fixed tick (render interpolation)
+    long long m_prevTickedFrame = -1; // SimulationClock::GetTickedFrame() when m_prevPosition was stored
     Math::Vec2 m_velocity;
     Math::Vec2 m_direction;
     Math::Vec2 m_size;
@@ -24,11 +24,11 @@ void DroneManager::Update(double dt, const Player& player, Math::Vec2 playerHitb
     }
 }
 
-void DroneManager::Draw(const Shader& shader)
+void DroneManager::Draw(SpriteInstancer& instancer) const
 {
     for (const auto& drone : drones)
     {
-        drone.Draw(shader);
+        drone.Draw(instancer);
     }
 }
 
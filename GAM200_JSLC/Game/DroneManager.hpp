@@ -6,6 +6,7 @@
 #include "Drone.hpp"
 
 class Shader;
+class SpriteInstancer;
 class Player;
 class DebugRenderer;
 
@@ -16,7 +17,8 @@ public:
     void Update(double dt, const Player& player, Math::Vec2 playerHitboxSize, bool isPlayerUndetectable,
                  bool sirenTracerJamEvade = false, float sirenTracerSpeedMul = 1.f,
                  float sirenTracerTrainAssistMul = 1.f);
-    void Draw(const Shader& shader);
+    /// One instance per visible drone; the instancer draws each texture with a single call.
+    void Draw(SpriteInstancer& instancer) const;
     void DrawRadars(const Shader& colorShader, DebugRenderer& debugRenderer) const;
     void DrawGauges(Shader& colorShader, DebugRenderer& debugRenderer) const;
     void Shutdown();
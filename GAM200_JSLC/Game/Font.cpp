@@ -4,15 +4,19 @@
 #include "../OpenGL/Shader.hpp"
 #include "../OpenGL/GLWrapper.hpp"
 #include "../Engine/Matrix.hpp"
+#include "../Engine/AssetCache.hpp"
+#include "../Engine/TextureTracker.hpp"
+#include "../Engine/SpriteBatch.hpp"
 #include <vector>
 #include <iostream>
 
-// Suppress warnings for stb_image
-#pragma warning(push, 0)
-#include <stb_image.h>
-#pragma warning(pop)
 
 
+Font::~Font()
+{
+    Shutdown();
+}
+
 unsigned int Font::GetPixel(const unsigned char* data, int x, int y, int width, int channels) const
 {
     // Based on stbi_load(false). (0,0) is Top-Left
@@ -26,25 +30,35 @@ unsigned int Font::GetPixel(const unsigned char* data, int x, int y, int width,
 
 void Font::Initialize(const char* fontAtlasPath)
 {
-    stbi_set_flip_vertically_on_load(false);
-
-    int width, height, nrChannels;
-    unsigned char* data = stbi_load(fontAtlasPath, &width, &height, &nrChannels, 0);
-    if (!data)
+    // Every state with a Font shares one atlas texture; the decoded pixels stay cached for the y=0 scan.
+    AssetCache::TextureOptions options;
+    options.filter = AssetCache::Filter::Nearest;
+    options.flipVertically = false;
+    options.keepPixels = true;
+    options.owner = "Font";
+    const AssetCache::Texture atlas = AssetCache::Instance().AcquireTexture(fontAtlasPath, options);
+    if (atlas.id == 0 || !atlas.pixels || atlas.pixels->empty())
     {
         std::cerr << "Failed to load font texture: " << fontAtlasPath << std::endl;
+        AssetCache::Instance().ReleaseTexture(atlas.id);
         return;
     }
 
+    const unsigned char* data = atlas.pixels->data();
+    const int width = atlas.width;
+    const int height = atlas.height;
+    const int nrChannels = atlas.channels;
+
     m_atlasWidth = width;
     m_atlasHeight = height;
 
     if (GetPixel(data, 0, 0, width, nrChannels) != 0xFFFFFFFF)
     {
         std::cerr << "Font Error: Font image has invalid format. First pixel must be white." << std::endl;
-        stbi_image_free(data);
+        AssetCache::Instance().ReleaseTexture(atlas.id);
         return;
     }
+    m_atlasTextureID = atlas.id;
 
     m_fontHeight = height - 1; // y=0 is for parsing info, font height is from y=1 to height
     size_t current_char_index = 0;
@@ -62,12 +76,9 @@ void Font::Initialize(const char* fontAtlasPath)
                 break;
             }
 
-            char c = m_charSequence[current_char_index];
-            Math::IRect rect;
-            // Coordinate system: y=0 Top, y=height Bottom
-            rect.bottom_left = { last_boundary_x, 1 };                 // (min_x, min_y)
-            rect.top_right = { x, 1 + m_fontHeight };                // (max_x, max_y)
-            m_charToRectMap[c] = rect;
+            const unsigned char c = static_cast<unsigned char>(m_charSequence[current_char_index]);
+            if (c < GLYPH_TABLE_SIZE)
+                m_glyphs[c] = { last_boundary_x, x - last_boundary_x };
 
             current_char_index++;
             last_boundary_x = x;
@@ -77,19 +88,6 @@ void Font::Initialize(const char* fontAtlasPath)
 
     // --- Create OpenGL Texture/VAO/FBO ---
 
-    GL::GenTextures(1, &m_atlasTextureID);
-    GL::BindTexture(GL_TEXTURE_2D, m_atlasTextureID);
-
-    GLenum format = (nrChannels == 4) ? GL_RGBA : GL_RGB;
-    GL::TexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-    stbi_image_free(data);
-
     std::vector<float> vertices = {
         // positions    // texture Coords
         -0.5f,  0.5f,  0.0f, 1.0f, // Top-left
@@ -120,9 +118,15 @@ void Font::Shutdown()
     // Delete all cached textures
     for (auto const& [key, val] : m_textCache)
     {
-        GL::DeleteTextures(1, &val.textureID);
+        GL::DeleteTextures(1, &val.info.textureID);
+        TextureTracker::Instance().Untrack(val.info.textureID);
     }
+    s_textCacheStats.entries -= static_cast<int>(m_textCache.size());
+    s_textCacheStats.residentBytes -= m_textCacheBytes;
     m_textCache.clear();
+    m_textLru.clear();
+    m_textCacheBytes = 0;
+    m_rebakeShader.reset();
 
     // Delete FBO
     if (m_fboID != 0) GL::DeleteFramebuffers(1, &m_fboID);
@@ -132,7 +136,8 @@ void Font::Shutdown()
     if (m_quadVBO != 0) GL::DeleteBuffers(1, &m_quadVBO);
 
     // Delete original atlas texture
-    if (m_atlasTextureID != 0) GL::DeleteTextures(1, &m_atlasTextureID);
+    AssetCache::Instance().ReleaseTexture(m_atlasTextureID);
+    m_atlasTextureID = 0;
 }
 
 CachedTextureInfo Font::PrintToTexture(Shader& atlasShader, const std::string& text)
@@ -146,18 +151,65 @@ CachedTextureInfo Font::PrintToTexture(Shader& atlasShader, const std::string& t
     auto it = m_textCache.find(text);
     if (it != m_textCache.end())
     {
-        return it->second; // Cache hit
+        TouchCacheEntry(it->second);
+        ++s_textCacheStats.hits;
+        return it->second.info; // Cache hit
     }
 
     // Cache miss: Bake new texture
+    ++s_textCacheStats.misses;
     CachedTextureInfo newTextureInfo = BakeTextToTexture(atlasShader, text);
+    if (newTextureInfo.textureID == 0)
+        return newTextureInfo;
     newTextureInfo.text = text; // Store original text in cache info
 
     // Save to cache
-    m_textCache[text] = newTextureInfo;
+    InsertCacheEntry(newTextureInfo);
     return newTextureInfo;
 }
 
+Font::TextCache::iterator Font::InsertCacheEntry(const CachedTextureInfo& info)
+{
+    m_textLru.push_front(info.text);
+    TextCacheEntry entry;
+    entry.info = info;
+    entry.bytes = static_cast<size_t>(info.width) * static_cast<size_t>(info.height) * 4;
+    entry.lruIt = m_textLru.begin();
+
+    m_textCacheBytes += entry.bytes;
+    ++s_textCacheStats.entries;
+    s_textCacheStats.residentBytes += entry.bytes;
+
+    auto it = m_textCache.emplace(info.text, entry).first;
+    EvictToBudget();
+    return it;
+}
+
+void Font::TouchCacheEntry(TextCacheEntry& entry)
+{
+    m_textLru.splice(m_textLru.begin(), m_textLru, entry.lruIt);
+}
+
+void Font::EvictToBudget()
+{
+    // The newest entry always stays, even if it alone is over budget.
+    while (m_textCacheBytes > TEXT_CACHE_BUDGET_BYTES && m_textLru.size() > 1)
+    {
+        auto victim = m_textCache.find(m_textLru.back());
+        m_textLru.pop_back();
+        if (victim == m_textCache.end())
+            continue;
+
+        GL::DeleteTextures(1, &victim->second.info.textureID);
+        TextureTracker::Instance().Untrack(victim->second.info.textureID);
+        m_textCacheBytes -= victim->second.bytes;
+        --s_textCacheStats.entries;
+        s_textCacheStats.residentBytes -= victim->second.bytes;
+        ++s_textCacheStats.evictions;
+        m_textCache.erase(victim);
+    }
+}
+
 CachedTextureInfo Font::CreateTextTexture(Shader& atlasShader, const std::string& text)
 {
     if (text.empty())
@@ -173,10 +225,17 @@ CachedTextureInfo Font::BakeTextToTexture(Shader& atlasShader, const std::string
         return { 0, 0, 0 };
     }
 
+    // May run mid-frame (re-bake after eviction): put the caller's target and viewport back afterwards.
+    GLint previousFramebuffer = 0;
+    GLint previousViewport[4] = { 0, 0, 0, 0 };
+    GL::GetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    GL::GetIntegerv(GL_VIEWPORT, previousViewport);
+
     unsigned int newTexID = 0;
     GL::GenTextures(1, &newTexID);
     GL::BindTexture(GL_TEXTURE_2D, newTexID);
     GL::TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, textSize.x, textSize.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    TextureTracker::Instance().Track(newTexID, 0, textSize.x, textSize.y, GL_RGBA, "Font");
 
     // Use GL_LINEAR for smooth look when scaling FBO texture
     GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -191,7 +250,9 @@ CachedTextureInfo Font::BakeTextToTexture(Shader& atlasShader, const std::string
     if (GL::CheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
     {
         std::cerr << "Framebuffer is not complete!" << std::endl;
-        GL::BindFramebuffer(GL_FRAMEBUFFER, 0);
+        GL::BindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previousFramebuffer));
+        GL::DeleteTextures(1, &newTexID);
+        TextureTracker::Instance().Untrack(newTexID);
         return { 0, 0, 0 };
     }
 
@@ -215,10 +276,13 @@ CachedTextureInfo Font::BakeTextToTexture(Shader& atlasShader, const std::string
     int current_x = 0;
     for (const char c : text)
     {
-        auto it = m_charToRectMap.find(c);
-        if (it == m_charToRectMap.end()) continue;
+        const Glyph* glyph = FindGlyph(c);
+        if (!glyph) continue;
 
-        const auto& char_rect = it->second;
+        // Coordinate system: y=0 Top, y=height Bottom
+        Math::IRect char_rect;
+        char_rect.bottom_left = { glyph->x, 1 };
+        char_rect.top_right = { glyph->x + glyph->width, 1 + m_fontHeight };
 
         const Math::ivec2 char_size = {
             char_rect.top_right.x - char_rect.bottom_left.x,
@@ -254,7 +318,8 @@ CachedTextureInfo Font::BakeTextToTexture(Shader& atlasShader, const std::string
         current_x += char_size.x;
     }
 
-    GL::BindFramebuffer(GL_FRAMEBUFFER, 0);
+    GL::BindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previousFramebuffer));
+    GL::Viewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
 
     return { newTexID, textSize.x, textSize.y };
 }
@@ -266,6 +331,33 @@ void Font::DrawBakedText(Shader& textureShader, const CachedTextureInfo& texture
         return;
     }
 
+    unsigned int textureID = textureInfo.textureID;
+    if (!textureInfo.text.empty())
+    {
+        // Came from PrintToTexture: the caller's copy may predate an eviction, so go through the cache.
+        auto it = m_textCache.find(textureInfo.text);
+        if (it == m_textCache.end())
+        {
+            if (!m_rebakeShader)
+            {
+                m_rebakeShader = std::make_unique<Shader>("OpenGL/Shaders/simple.vert", "OpenGL/Shaders/simple.frag");
+                m_rebakeShader->use();
+                m_rebakeShader->setInt("ourTexture", 0);
+            }
+            ++s_textCacheStats.misses;
+            CachedTextureInfo rebaked = BakeTextToTexture(*m_rebakeShader, textureInfo.text);
+            if (rebaked.textureID == 0)
+                return;
+            rebaked.text = textureInfo.text;
+            it = InsertCacheEntry(rebaked);
+        }
+        else
+        {
+            TouchCacheEntry(it->second);
+        }
+        textureID = it->second.info.textureID;
+    }
+
     textureShader.use();
 
     float scale = newHeight / m_fontHeight;
@@ -288,7 +380,7 @@ void Font::DrawBakedText(Shader& textureShader, const CachedTextureInfo& texture
     textureShader.setFloat("alpha", 1.0f);
 
     GL::ActiveTexture(GL_TEXTURE0);
-    GL::BindTexture(GL_TEXTURE_2D, textureInfo.textureID);
+    GL::BindTexture(GL_TEXTURE_2D, textureID);
     GL::BindVertexArray(m_quadVAO);
 
     GL::DrawArrays(GL_TRIANGLES, 0, 6);
@@ -296,18 +388,57 @@ void Font::DrawBakedText(Shader& textureShader, const CachedTextureInfo& texture
     GL::BindVertexArray(0);
 }
 
-Math::ivec2 Font::measureText(const std::string& text) const
+void Font::DrawText(SpriteBatch& batch, std::string_view text, Math::Vec2 position, float newHeight, float alpha) const
+{
+    if (m_atlasTextureID == 0 || m_fontHeight == 0 || text.empty())
+        return;
+
+    const float scale = newHeight / m_fontHeight;
+
+    // Same inset as BakeTextToTexture (no neighbour bleeding), but with V running bottom-to-top
+    // because the glyph lands directly in a y-up projection instead of an FBO that is drawn flipped.
+    const float pixel_epsilon_x = 0.5f / m_atlasWidth;
+    const float one_pixel_y = 1.0f / m_atlasHeight;
+    const float uv_y = 1.0f - (static_cast<float>(1 + m_fontHeight) / m_atlasHeight) + one_pixel_y;
+    const float uv_h = static_cast<float>(m_fontHeight) / m_atlasHeight - 2.0f * one_pixel_y;
+
+    float current_x = position.x;
+    for (const char c : text)
+    {
+        const Glyph* glyph = FindGlyph(c);
+        if (!glyph) continue;
+
+        const float w = glyph->width * scale;
+        const Math::Matrix model = Math::Matrix::CreateTranslation({ current_x + w * 0.5f, position.y + newHeight * 0.5f })
+            * Math::Matrix::CreateScale({ w, newHeight });
+
+        SpriteBatch::UVRect rect;
+        rect.x = static_cast<float>(glyph->x) / m_atlasWidth + pixel_epsilon_x;
+        rect.w = static_cast<float>(glyph->width) / m_atlasWidth - 2.0f * pixel_epsilon_x;
+        rect.y = uv_y + uv_h;
+        rect.h = -uv_h;
+        batch.Draw(m_atlasTextureID, model, rect, false, alpha);
+
+        current_x += w;
+    }
+}
+
+float Font::MeasureWidth(std::string_view text, float newHeight) const
+{
+    if (m_fontHeight == 0)
+        return 0.0f;
+    return static_cast<float>(measureText(text).x) * (newHeight / m_fontHeight);
+}
+
+Math::ivec2 Font::measureText(std::string_view text) const
 {
     if (text.empty()) return { 0, m_fontHeight };
 
     int total_width = 0;
     for (const char c : text)
     {
-        auto it = m_charToRectMap.find(c);
-        if (it != m_charToRectMap.end())
-        {
-            total_width += (it->second.top_right.x - it->second.bottom_left.x);
-        }
+        if (const Glyph* glyph = FindGlyph(c))
+            total_width += glyph->width;
     }
     return { total_width, m_fontHeight };
 }
\ No newline at end of file
@@ -4,12 +4,15 @@
 
 #include "../Engine/Vec2.hpp"
 #include "../Engine/Rect.hpp"
+#include <array>
+#include <list>
 #include <string>
-#include <map>
+#include <string_view>
 #include <unordered_map>
 #include <memory> 
 
 class Shader;
+class SpriteBatch;
 
 struct CachedTextureInfo
 {
@@ -19,24 +22,69 @@ struct CachedTextureInfo
     std::string text;
 };
 
+struct TextCacheStats
+{
+    int entries = 0;
+    size_t residentBytes = 0;
+    int hits = 0;
+    int misses = 0;
+    int evictions = 0;
+};
+
 class Font
 {
 public:
     Font() = default;
-    ~Font() { Shutdown(); }
+    ~Font();
+
+    /// Per-font VRAM budget for baked strings; least recently used ones are deleted past it.
+    static constexpr size_t TEXT_CACHE_BUDGET_BYTES = 8u * 1024u * 1024u;
+    /// Baked-string cache totals over every live Font (ImGui Performance window).
+    static const TextCacheStats& GetTextCacheStats() { return s_textCacheStats; }
 
     void Initialize(const char* fontAtlasPath);
     void Shutdown();
 
+    /// Cached bake. The returned copy may outlive an eviction: DrawBakedText resolves it by text
+    /// and re-bakes on demand, so keep drawing through DrawBakedText rather than the raw id.
     CachedTextureInfo PrintToTexture(Shader& atlasShader, const std::string& text);
     /// Bakes text to a new GL texture without inserting into the long-lived cache (caller deletes `textureID`).
     CachedTextureInfo CreateTextTexture(Shader& atlasShader, const std::string& text);
     void DrawBakedText(Shader& textureShader, const CachedTextureInfo& textureInfo, Math::Vec2 position, float newHeight);
+
+    /// Queues one quad per glyph straight from the atlas (no texture, no FBO). For text that
+    /// changes often; position is the bottom-left corner, newHeight the rendered line height.
+    void DrawText(SpriteBatch& batch, std::string_view text, Math::Vec2 position, float newHeight, float alpha = 1.0f) const;
+    /// Rendered width of text at newHeight.
+    float MeasureWidth(std::string_view text, float newHeight) const;
+
     int m_fontHeight = 0;
 private:
     unsigned int GetPixel(const unsigned char* data, int x, int y, int width, int channels) const;
     CachedTextureInfo BakeTextToTexture(Shader& atlasShader, const std::string& text);
-    Math::ivec2 measureText(const std::string& text) const;
+    Math::ivec2 measureText(std::string_view text) const;
+
+    struct TextCacheEntry
+    {
+        CachedTextureInfo info;
+        size_t bytes = 0;
+        std::list<std::string>::iterator lruIt;
+    };
+    using TextCache = std::unordered_map<std::string, TextCacheEntry>;
+    TextCache::iterator InsertCacheEntry(const CachedTextureInfo& info);
+    void TouchCacheEntry(TextCacheEntry& entry);
+    void EvictToBudget();
+
+    struct Glyph
+    {
+        int x = 0;     // left edge in the atlas; glyphs span rows 1..m_fontHeight
+        int width = 0; // 0 = not in the atlas
+    };
+    const Glyph* FindGlyph(char c) const
+    {
+        const unsigned char index = static_cast<unsigned char>(c);
+        return (index < GLYPH_TABLE_SIZE && m_glyphs[index].width > 0) ? &m_glyphs[index] : nullptr;
+    }
 
 private:
     unsigned int m_atlasTextureID = 0;
@@ -45,12 +93,19 @@ private:
 
     const std::string m_charSequence = " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
 
-    
-    std::map<char, Math::IRect> m_charToRectMap;
+    // Indexed by ASCII code; the atlas only covers printable ASCII.
+    static constexpr int GLYPH_TABLE_SIZE = 128;
+    std::array<Glyph, GLYPH_TABLE_SIZE> m_glyphs{};
 
     unsigned int m_quadVAO = 0;
     unsigned int m_quadVBO = 0;
     unsigned int m_fboID = 0;
 
-    std::unordered_map<std::string, CachedTextureInfo> m_textCache;
+    TextCache m_textCache;
+    std::list<std::string> m_textLru; // front = most recently used
+    size_t m_textCacheBytes = 0;
+    // Own shader for re-bakes inside DrawBakedText, so the caller's projection uniform survives.
+    std::unique_ptr<Shader> m_rebakeShader;
+
+    inline static TextCacheStats s_textCacheStats{};
 };
\ No newline at end of file
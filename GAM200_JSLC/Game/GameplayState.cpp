@@ -10,10 +10,16 @@
 #include "../OpenGL/GLWrapper.hpp"
 #include "../Engine/Collision.hpp"
 #include "../Engine/ImguiManager.hpp"
+#include "../Engine/SpriteBatch.hpp"
+#include "../Engine/SpriteInstancer.hpp"
+#include "../Engine/RenderQueue.hpp"
+#include "../Engine/AssetCache.hpp"
 #include "Setting.hpp"
 #include "GameOver.hpp"
 #include "MapObjectConfig.hpp"
 #include "Background.hpp"
+#include "RenderLayers.hpp"
+#include "ZoneStreamer.hpp"
 #include <string>
 #include <sstream>
 #include <cmath>
@@ -55,6 +61,8 @@ constexpr float TRAIN_PLAYER_INSET = 30.0f;
 constexpr float TRAIN_DRONE_TARGET_INSET = 8.0f;
 constexpr float TRAIN_ROBOT_CORE_INSET_X = 80.0f;
 constexpr float TRAIN_ROBOT_CORE_OFFSET_Y = 18.0f;
+// Start streaming the next zone in when the player is this close to its edge (about one screen).
+constexpr float ZONE_PREFETCH_DISTANCE = 2400.0f;
 
 namespace
 {
@@ -62,6 +70,25 @@ namespace
     {
         return d.GetPosition();
     }
+
+    // World rectangle seen through CreateOrtho(0..width, 0..height) * CreateTranslation(offset).
+    // Padded by a few units so sprites touching the edge are not dropped by rounding.
+    Math::Rect VisibleWorldRect(float offsetX, float offsetY, float width, float height)
+    {
+        constexpr float kPad = 4.0f;
+        return { { -offsetX - kPad, -offsetY - kPad }, { -offsetX + width + kPad, -offsetY + height + kPad } };
+    }
+
+    unsigned int ZoneBit(MapZone zone)
+    {
+        return 1u << static_cast<int>(zone);
+    }
+
+    struct ZoneCapture
+    {
+        explicit ZoneCapture(MapZone zone) { ZoneStreamer::Instance().BeginCapture(static_cast<int>(zone)); }
+        ~ZoneCapture() { ZoneStreamer::Instance().EndCapture(); }
+    };
 } // namespace
 
 // Hallway hiding-box S.png: only while hall post-process is on; fades by player distance to spot top.
@@ -98,6 +125,7 @@ void GameplayState::Initialize()
     m_outlineShader = std::make_unique<Shader>("OpenGL/Shaders/simple.vert", "OpenGL/Shaders/outline.frag");
     m_outlineShader->use();
     m_outlineShader->setInt("ourTexture", 0);
+    m_outlineShader->setInt("outlineField", 1);
 
     gsm.GetEngine().GetTextureShader().use();
     gsm.GetEngine().GetTextureShader().setInt("ourTexture", 0);
@@ -128,8 +156,15 @@ void GameplayState::Initialize()
     // Load map object config before map initialization.
     MapObjectConfig::Instance().Load();
 
+    // Room and Hallway are needed within the first minute; the rest only read sprite sizes now
+    // and upload when the player gets close (UpdateZoneStreaming).
+    ZoneStreamer::Instance().Reset(ZoneBit(MapZone::Room) | ZoneBit(MapZone::Hallway));
+
     m_room = std::make_unique<Room>();
-    m_room->Initialize(engine, "Asset/Room.png");
+    {
+        ZoneCapture capture(MapZone::Room);
+        m_room->Initialize(engine, "Asset/Room.png");
+    }
 
     m_door = std::make_unique<Door>();
     m_door->Initialize({ 1710.0f, 440.0f }, { 50.0f, 300.0f }, 20.0f, DoorType::RoomToHallway);
@@ -138,31 +173,36 @@ void GameplayState::Initialize()
     m_rooftopDoor->Initialize({ 7195.0f, 400.0f }, { 300.0f, 300.0f }, 20.0f, DoorType::HallwayToRooftop);
 
     m_hallway = std::make_unique<Hallway>();
-    m_hallway->Initialize();
+    {
+        ZoneCapture capture(MapZone::Hallway);
+        m_hallway->Initialize();
+    }
 
     m_rooftop = std::make_unique<Rooftop>();
-    m_rooftop->Initialize();
+    {
+        ZoneCapture capture(MapZone::Rooftop);
+        m_rooftop->Initialize();
+    }
 
     m_underground = std::make_unique<Underground>();
-    m_underground->Initialize();
+    {
+        ZoneCapture capture(MapZone::Underground);
+        m_underground->Initialize();
+    }
     m_undergroundAccessed = false;
 
     m_train = std::make_unique<Train>();
-    m_train->Initialize();
+    {
+        ZoneCapture capture(MapZone::Train);
+        m_train->Initialize();
+    }
     m_trainAccessed = false;
     m_trainDeferEntryUntilIntroDone = false;
     m_rooftopAccessed = false;
     m_pulseDetonateSkill.Initialize();
 
     // Apply JSON config once at startup (the same path used by hot-reload).
-    {
-        const auto& cfg = MapObjectConfig::Instance().GetData();
-        m_room->ApplyConfig(cfg.room);
-        m_hallway->ApplyConfig(cfg.hallway);
-        m_rooftop->ApplyConfig(cfg.rooftop);
-        m_underground->ApplyConfig(cfg.underground);
-        m_train->ApplyConfig(cfg.train);
-    }
+    ApplyMapObjectConfig();
 
     m_camera.Initialize({ GAME_WIDTH / 2.0f, GAME_HEIGHT / 2.0f }, GAME_WIDTH, GAME_HEIGHT);
     m_camera.SetBounds({ 0.0f, 0.0f }, { GAME_WIDTH, GAME_HEIGHT });
@@ -171,7 +211,7 @@ void GameplayState::Initialize()
     m_font = std::make_unique<Font>();
     m_font->Initialize("Asset/fonts/Font_Outlined.png");
 
-    m_fpsText = m_font->PrintToTexture(*m_fontShader, "FPS: ...");
+    m_fpsLabel = "FPS: ...";
 
     // Custom cursor sprites
     m_mouseIdleCursor = std::make_unique<Background>();
@@ -192,6 +232,9 @@ void GameplayState::Initialize()
     m_hallwayHidingPromptS = std::make_unique<Background>();
     m_hallwayHidingPromptS->Initialize("Asset/S.png");
 
+    // Maps and player now hold their own references to whatever the splash screen warmed up.
+    AssetCache::Instance().ReleasePreloads();
+
     m_tutorial = std::make_unique<Tutorial>();
 
     auto& roomPulseSources = m_room->GetPulseSources();
@@ -351,6 +394,8 @@ void GameplayState::Update(double dt)
     auto& input = engine.GetInput();
     auto& ctl = engine.GetControlBindings();
 
+    m_camera.StorePreviousPosition();
+
     // Update player god mode from ImGui settings
     auto* imguiManager = engine.GetImguiManager();
     if (imguiManager)
@@ -364,6 +409,8 @@ void GameplayState::Update(double dt)
         return;
     }
 
+    UpdateZoneStreaming();
+
     if (input.IsKeyTriggered(Input::Key::Escape))
     {
         gsm.PushState(std::make_unique<SettingState>(gsm, true));
@@ -665,7 +712,7 @@ void GameplayState::Update(double dt)
         if (m_openingStoryDelayRemaining <= 0.0f)
         {
             m_openingStoryDelayRemaining = 0.0f;
-            m_storyDialogue->EnqueueOpening(*m_font, *m_fontShader);
+            m_storyDialogue->EnqueueOpening();
         }
     }
 
@@ -679,13 +726,13 @@ void GameplayState::Update(double dt)
             m_rooftopQStoryDone = true;
             m_storyDialogue->EnqueueLines(
                 { "Q skill unlocked. Press Q to release a pulse burst around you." },
-                *m_font, *m_fontShader, nullptr, true, true);
+                nullptr, true, true);
         }
     }
 
     if (m_storyDialogue)
     {
-        m_storyDialogue->Update(static_cast<float>(dt), input, ctl, *m_font, *m_fontShader);
+        m_storyDialogue->Update(static_cast<float>(dt), input, ctl);
         if (m_storyDialogue->IsBlocking())
         {
             if (!m_camera.IsAnimating())
@@ -743,12 +790,7 @@ void GameplayState::Update(double dt)
     // Auto hot-reload on file save for map object coordinates/sizes/sprites.
     if (MapObjectConfig::Instance().ReloadIfChanged())
     {
-        const auto& cfg = MapObjectConfig::Instance().GetData();
-        m_room->ApplyConfig(cfg.room);
-        m_hallway->ApplyConfig(cfg.hallway);
-        m_rooftop->ApplyConfig(cfg.rooftop);
-        m_underground->ApplyConfig(cfg.underground);
-        m_train->ApplyConfig(cfg.train);
+        ApplyMapObjectConfig();
     }
 
     auto configManager = gsm.GetEngine().GetDroneConfigManager();
@@ -1298,9 +1340,7 @@ void GameplayState::Update(double dt)
                     {
                         "It's getting dark... but the whole city is already blacked out.",
                         "I need to get out of here.",
-                    },
-                    *m_font,
-                    *m_fontShader);
+                    });
             }
             m_wasBlindOpen = m_room->IsBlindOpen();
 
@@ -1314,8 +1354,6 @@ void GameplayState::Update(double dt)
                             "Maybe it needs energy... or pulse.",
                             "I should find something electrical to recharge from.",
                         },
-                        *m_font,
-                        *m_fontShader,
                         [this] { m_roomBlindLowPulseStoryDone = true; });
                 }
             }
@@ -1371,9 +1409,7 @@ void GameplayState::Update(double dt)
         {
             m_hallwayFaradayBoxStoryDone = true;
             m_storyDialogue->EnqueueLines(
-                { "Wait, a Faraday box? This might actually keep us off their radar. Time to disappear." },
-                *m_font,
-                *m_fontShader);
+                { "Wait, a Faraday box? This might actually keep us off their radar. Time to disappear." });
         }
     }
 
@@ -1414,9 +1450,7 @@ void GameplayState::Update(double dt)
         if (nearLift && !m_wasNearLiftRooftop && !m_rooftopLiftStoryDone)
         {
             m_storyDialogue->EnqueueLines(
-                { "There's no way across unless I activate that lift." },
-                *m_font,
-                *m_fontShader);
+                { "There's no way across unless I activate that lift." });
             m_rooftopLiftStoryDone = true;
         }
         m_wasNearLiftRooftop = nearLift;
@@ -1647,9 +1681,7 @@ void GameplayState::Update(double dt)
                     "There's a drone. I should avoid it for now.",
                     "But... maybe I can use this power against it.",
                     "First, I need to find somewhere to charge.",
-                },
-                *m_font,
-                *m_fontShader);
+                });
         }
     }
 
@@ -1682,21 +1714,12 @@ void GameplayState::Update(double dt)
 
         std::stringstream ss_fps;
         ss_fps << "FPS: " << average_fps;
-        m_fpsText = m_font->PrintToTexture(*m_fontShader, ss_fps.str());
+        m_fpsLabel = ss_fps.str();
         m_fpsTimer -= 1.0;
         m_frameCount = 0;
     }
 
-    std::stringstream ss_pulse;
-    ss_pulse.precision(1);
-    ss_pulse << std::fixed << "Pulse: " << pulse.Value() << " / " << pulse.Max();
-    m_pulseText = m_font->PrintToTexture(*m_fontShader, ss_pulse.str());
-
-    m_pulseDetonateSkill.UpdateCooldownText(*m_font, *m_fontShader);
-
-    std::stringstream ss_warning;
-    ss_warning << "Warning Level: " << m_traceSystem->GetWarningLevel();
-    m_warningLevelText = m_font->PrintToTexture(*m_fontShader, ss_warning.str());
+    m_pulseDetonateSkill.UpdateCooldownText();
 
     if (engine.GetImguiManager())
     {
@@ -2042,6 +2065,158 @@ void GameplayState::RespawnAtCheckpoint()
     }
 }
 
+void GameplayState::BeginFlythroughZone(MapZone zone, float panSeconds)
+{
+    m_blockAmbientStoryForSession = true;
+    m_skipRooftopQHintByCheat = true;
+    m_rooftopQStoryDone = true;
+    m_storyDialogue->ResetForNewRun();
+    m_tutorial->DisableAll();
+    player.SetGodMode(true);
+    m_pendingTransition = PendingTransition::None;
+    m_fadeState = FadeState::None;
+    m_fadeAlpha = 0.0f;
+    m_camera.StopAnimation();
+
+    switch (zone)
+    {
+    case MapZone::Room:
+        break; // where GameplayState starts
+    case MapZone::Hallway:
+        OpenHallwayDoorLayoutOnly();
+        m_currentCheckpoint = MapZone::Hallway;
+        player.SetCurrentGroundLevel(HALLWAY_GROUND_LEVEL);
+        player.SetPosition({ GAME_WIDTH + player.GetHitboxSize().x * 0.5f + HALLWAY_ENTRY_MARGIN_X,
+                             HALLWAY_GROUND_LEVEL + player.GetSize().y * 0.5f });
+        player.ResetVelocity();
+        player.SetOnGround(true);
+        break;
+    case MapZone::Rooftop:
+        HandleHallwayToRooftopTransition();
+        break;
+    case MapZone::Underground:
+        HandleRooftopToUndergroundTransition();
+        break;
+    case MapZone::Train:
+        HandleUndergroundToTrainTransition();
+        // Skip the entry zoom so every measured frame is drawn at the gameplay scale.
+        m_trainZoomTransition = false;
+        m_cameraZoom = 1.0f;
+        player.SetSizeScale(0.6f);
+        break;
+    }
+
+    // Between the view centres at the bottom-left and top-right corners; an axis the view already
+    // covers stays centred. Camera animation suspends the player-follow camera until it ends.
+    const Math::Rect rect = GetZoneWorldRect(zone);
+    const auto panAxis = [](float min, float max, float halfView, float& outStart, float& outEnd) {
+        outStart = min + halfView;
+        outEnd = max - halfView;
+        if (outStart > outEnd)
+            outStart = outEnd = (min + max) * 0.5f;
+    };
+    Math::Vec2 start;
+    Math::Vec2 end;
+    panAxis(rect.bottom_left.x, rect.top_right.x, GAME_WIDTH * 0.5f, start.x, end.x);
+    panAxis(rect.bottom_left.y, rect.top_right.y, GAME_HEIGHT * 0.5f, start.y, end.y);
+    m_camera.StartAnimation(start, end, panSeconds);
+    m_camera.StorePreviousPosition(); // no interpolation from the previous zone
+
+    Logger::Instance().Log(Logger::Severity::Event, "Flythrough: zone %d, camera (%.0f, %.0f) -> (%.0f, %.0f) over %.1f s",
+        static_cast<int>(zone), start.x, start.y, end.x, end.y, panSeconds);
+}
+
+void GameplayState::ApplyMapObjectConfig()
+{
+    const auto& cfg = MapObjectConfig::Instance().GetData();
+    {
+        ZoneCapture capture(MapZone::Room);
+        m_room->ApplyConfig(cfg.room);
+    }
+    {
+        ZoneCapture capture(MapZone::Hallway);
+        m_hallway->ApplyConfig(cfg.hallway);
+    }
+    {
+        ZoneCapture capture(MapZone::Rooftop);
+        m_rooftop->ApplyConfig(cfg.rooftop);
+    }
+    {
+        ZoneCapture capture(MapZone::Underground);
+        m_underground->ApplyConfig(cfg.underground);
+    }
+    {
+        ZoneCapture capture(MapZone::Train);
+        m_train->ApplyConfig(cfg.train);
+    }
+}
+
+MapZone GameplayState::GetActiveZone() const
+{
+    if (m_trainAccessed) return MapZone::Train;
+    if (m_undergroundAccessed) return MapZone::Underground;
+    if (m_rooftopAccessed) return MapZone::Rooftop;
+    if (m_doorOpened) return MapZone::Hallway;
+    return MapZone::Room;
+}
+
+Math::Rect GameplayState::GetZoneWorldRect(MapZone zone) const
+{
+    switch (zone)
+    {
+    case MapZone::Room:
+        return { { 0.0f, 0.0f }, { GAME_WIDTH, GAME_HEIGHT } };
+    case MapZone::Hallway:
+        return { { GAME_WIDTH, 0.0f }, { GAME_WIDTH + Hallway::WIDTH, Hallway::HEIGHT } };
+    case MapZone::Rooftop:
+        return { { Rooftop::MIN_X, Rooftop::MIN_Y }, { Rooftop::MIN_X + Rooftop::WIDTH, Rooftop::MIN_Y + Rooftop::HEIGHT } };
+    case MapZone::Underground:
+        return { { Underground::MIN_X, Underground::MIN_Y }, { Underground::MIN_X + Underground::WIDTH, Underground::MIN_Y + Underground::HEIGHT } };
+    case MapZone::Train:
+        return { { Train::MIN_X, Train::MIN_Y }, { Train::MIN_X + m_train->GetMapWidth(), Train::MIN_Y + Train::HEIGHT } };
+    }
+    return {};
+}
+
+void GameplayState::UpdateZoneStreaming()
+{
+    const int active = static_cast<int>(GetActiveZone());
+    const int next = active + 1;
+    const int zoneCount = static_cast<int>(MapZone::Train) + 1;
+
+    // Queued door/lift transition: its target must be in memory before the fade-in ends.
+    int transitionTarget = -1;
+    switch (m_pendingTransition)
+    {
+    case PendingTransition::RoomToHallway:        transitionTarget = static_cast<int>(MapZone::Hallway); break;
+    case PendingTransition::HallwayToRooftop:     transitionTarget = static_cast<int>(MapZone::Rooftop); break;
+    case PendingTransition::RooftopToUnderground: transitionTarget = static_cast<int>(MapZone::Underground); break;
+    case PendingTransition::UndergroundToTrain:   transitionTarget = static_cast<int>(MapZone::Train); break;
+    case PendingTransition::None: break;
+    }
+
+    bool nearNext = false;
+    if (next < zoneCount)
+    {
+        const Math::Rect rect = GetZoneWorldRect(static_cast<MapZone>(next));
+        const Math::Vec2 p = player.GetPosition();
+        const float dx = std::max({ rect.bottom_left.x - p.x, 0.0f, p.x - rect.top_right.x });
+        const float dy = std::max({ rect.bottom_left.y - p.y, 0.0f, p.y - rect.top_right.y });
+        nearNext = dx * dx + dy * dy <= ZONE_PREFETCH_DISTANCE * ZONE_PREFETCH_DISTANCE;
+    }
+
+    ZoneStreamer& streamer = ZoneStreamer::Instance();
+    for (int zone = 0; zone < zoneCount; ++zone)
+    {
+        // Keep the active zone and the one behind it (respawn / back-tracking);
+        // anything two steps away either side is evicted.
+        bool keep = (zone == active) || (zone == active - 1) || (zone == transitionTarget);
+        if (zone == next)
+            keep = nearNext || streamer.IsResident(zone);
+        streamer.SetResident(zone, keep);
+    }
+}
+
 Math::Vec2 GameplayState::ScreenToWorldCoordinates(double screenX, double screenY) const
 {
     Engine& engine = gsm.GetEngine();
@@ -2070,6 +2245,7 @@ Math::Vec2 GameplayState::ScreenToWorldCoordinates(double screenX, double screen
     float mouseGameX = mouseNDCX * GAME_WIDTH;
     float mouseGameY = (1.0f - mouseNDCY) * GAME_HEIGHT;
 
+    // Tick camera, not GetRenderPosition(): aiming feeds the simulation and must not depend on frame alpha.
     Math::Vec2 cameraPos = m_camera.GetPosition();
     Math::Vec2 worldPos;
     worldPos.x = mouseGameX - (GAME_WIDTH / 2.0f) + cameraPos.x;
@@ -2270,6 +2446,9 @@ void GameplayState::DrawMainLayer()
         return;
     }
 
+    // Cheats and transitions can move the player after Update's streaming pass.
+    UpdateZoneStreaming();
+
     Engine& engine = gsm.GetEngine();
 
     float r, g, b;
@@ -2309,15 +2488,14 @@ void GameplayState::DrawMainLayer()
     GL::Enable(GL_BLEND);
     GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-    Shader& textureShader = engine.GetTextureShader();
-
     // Zoom-aware world projection: effectiveWidth/Height shrink as zoom increases (zoom-in effect)
     const float effectiveWidth  = GAME_WIDTH  / m_cameraZoom;
     const float effectiveHeight = GAME_HEIGHT / m_cameraZoom;
     const float viewHalfW = effectiveWidth * 0.5f;
     Math::Matrix worldProjection;
+    Math::Rect worldView;
     {
-        Math::Vec2 camPos   = m_camera.GetPosition();
+        Math::Vec2 camPos   = m_camera.GetRenderPosition();
         Math::Vec2 camShake = m_camera.GetScreenShakeOffset();
         float      offsetX  = std::round(effectiveWidth * 0.5f - camPos.x + camShake.x);
         float      offsetY  = std::round(effectiveHeight * 0.5f - camPos.y + camShake.y);
@@ -2325,71 +2503,48 @@ void GameplayState::DrawMainLayer()
             0.0f, effectiveWidth, 0.0f, effectiveHeight, -1.0f, 1.0f);
         Math::Matrix zoomedView = Math::Matrix::CreateTranslation({ offsetX, offsetY });
         worldProjection = zoomedOrtho * zoomedView;
-
-        textureShader.use();
-        textureShader.setMat4("projection", worldProjection);
-    }
-    textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-    textureShader.setBool("flipX", false);
-
-    // 1a) Train sunset sky gradient (drawn before everything else so it sits behind all sprites)
-    if (m_trainAccessed)
-    {
-        colorShader->use();
-        colorShader->setMat4("projection", worldProjection);
-        m_train->DrawBackground(*colorShader, m_camera.GetPosition(), viewHalfW);
-        // Restore texture shader state
-        textureShader.use();
-        textureShader.setMat4("projection", worldProjection);
-        textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-        textureShader.setBool("flipX", false);
-        // 레일은 Rail.png가 장면 최하단 레이어이므로 하늘 바로 다음·다른 맵·기차 본체보다 먼저 그린다.
-        m_train->DrawRailTrack(textureShader, m_camera.GetPosition(), viewHalfW);
+        worldView = VisibleWorldRect(offsetX, offsetY, effectiveWidth, effectiveHeight);
     }
 
-    // 1b) World maps (post-processed: exposure / hallway overlay)
-    m_room->Draw(textureShader);
-    m_hallway->Draw(textureShader);
-    m_rooftop->Draw(textureShader);
-    m_underground->Draw(textureShader);
-    m_train->Draw(textureShader, m_camera.GetPosition(), viewHalfW);
-    if (m_trainAccessed)
-    {
-        colorShader->use();
-        colorShader->setMat4("projection", worldProjection);
-        colorShader->setFloat("uAlpha", 1.0f);
-        m_train->DrawRobotTrainAlerts(*colorShader, *m_debugRenderer);
-        textureShader.use();
-        textureShader.setMat4("projection", worldProjection);
-        textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-        textureShader.setBool("flipX", false);
-        m_train->DrawCar2EnterLeavePrompt(textureShader, m_camera.GetPosition(), viewHalfW);
-    }
+    // Every system submits into one queue; RenderLayers.hpp fixes the order, and sprites outside the
+    // camera rectangle are dropped when the queue replays them into the batch.
+    RenderQueue& queue = engine.GetRenderQueue();
+    queue.Begin(worldProjection, *colorShader, *m_debugRenderer);
+    queue.SetCullRect(worldView);
+    // Robots overlap each other; keep them in submission order rather than grouped by texture.
+    queue.SetOrderedLayer(RenderLayer::MapActor);
+    queue.SetOrderedLayer(RenderLayer::TrainActor);
+    const Math::Vec2 cameraPos = m_camera.GetRenderPosition();
 
+    // 1a) Train sunset sky and rail: the lowest layers, behind every map and the train itself.
     if (m_trainAccessed)
     {
-        textureShader.use();
-        textureShader.setMat4("projection", worldProjection);
-        textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-        textureShader.setBool("flipX", false);
-        textureShader.setFloat("alpha", 1.0f);
-        m_train->DrawCarTransportOverlays(textureShader, m_camera.GetPosition(), viewHalfW);
+        m_train->DrawBackground(queue, cameraPos, viewHalfW);
+        m_train->DrawRailTrack(queue, cameraPos, viewHalfW);
     }
 
+    // 1b) World maps (post-processed: exposure / hallway overlay)
+    m_room->Draw(queue);
+    m_hallway->Draw(queue);
+    m_rooftop->Draw(queue);
+    m_underground->Draw(queue);
+    m_train->Draw(queue, cameraPos, viewHalfW);
     if (m_trainAccessed)
     {
-        colorShader->use();
-        colorShader->setMat4("projection", worldProjection);
-        GL::Enable(GL_BLEND);
-        GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        m_train->DrawCar3SirenWaves(*colorShader, m_camera.GetPosition(), viewHalfW);
-        m_train->DrawCarTransportVFX(*colorShader, m_camera.GetPosition(), viewHalfW);
-        m_train->DrawValveWaterVFX(*colorShader, worldProjection, m_camera.GetPosition(), viewHalfW);
-        textureShader.use();
-        textureShader.setMat4("projection", worldProjection);
-        textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-        textureShader.setBool("flipX", false);
+        queue.SubmitColor(RenderLayer::TrainAlert, [this](Shader& shader, DebugRenderer& debugRenderer)
+        {
+            m_train->DrawRobotTrainAlerts(shader, debugRenderer);
+        });
+        m_train->DrawCar2EnterLeavePrompt(queue, cameraPos, viewHalfW);
+        m_train->DrawCarTransportOverlays(queue, cameraPos, viewHalfW);
+        queue.SubmitColor(RenderLayer::TrainEffect, [this, cameraPos, viewHalfW](Shader& shader, DebugRenderer&)
+        {
+            m_train->DrawCar3SirenWaves(shader, cameraPos, viewHalfW);
+            m_train->DrawCarTransportVFX(shader, cameraPos, viewHalfW);
+        });
+        m_train->DrawValveWaterVFX(queue, cameraPos, viewHalfW);
     }
+    queue.End();
 
     // Hallway railings: DrawForegroundLayer (after player / VFX) so Railing.png sits in front.
 
@@ -2412,7 +2567,10 @@ void GameplayState::DrawForegroundLayer(bool compositeToScreen)
     }
     else
     {
-        GL::Viewport(0, 0, static_cast<int>(GAME_WIDTH), static_cast<int>(GAME_HEIGHT));
+        // Drawn into the scene FBO under a transparent state, so it follows the render scale.
+        int sceneW = 0, sceneH = 0;
+        engine.GetPostProcess().GetSceneSize(sceneW, sceneH);
+        GL::Viewport(0, 0, sceneW, sceneH);
     }
 
     GL::Disable(GL_DEPTH_TEST);
@@ -2426,111 +2584,94 @@ void GameplayState::DrawForegroundLayer(bool compositeToScreen)
     // Zoom-aware world projection
     const float fgEffectiveWidth  = GAME_WIDTH  / m_cameraZoom;
     const float fgEffectiveHeight = GAME_HEIGHT / m_cameraZoom;
-    Math::Vec2 fgCamPos = m_camera.GetPosition();
+    Math::Vec2 fgCamPos = m_camera.GetRenderPosition();
     float fgOffsetX = std::round(fgEffectiveWidth  * 0.5f - fgCamPos.x);
     float fgOffsetY = std::round(fgEffectiveHeight * 0.5f - fgCamPos.y);
     Math::Matrix fgZoomedOrtho = Math::Matrix::CreateOrtho(
         0.0f, fgEffectiveWidth, 0.0f, fgEffectiveHeight, -1.0f, 1.0f);
     Math::Matrix fgZoomedView = Math::Matrix::CreateTranslation({ fgOffsetX, fgOffsetY });
     Math::Matrix projection = fgZoomedOrtho * fgZoomedView;
+    const Math::Rect fgWorldView = VisibleWorldRect(fgOffsetX, fgOffsetY, fgEffectiveWidth, fgEffectiveHeight);
 
     GL::Enable(GL_BLEND);
     GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     Shader& textureShader = engine.GetTextureShader();
 
+    // World-space part of the foreground: one queue pass, ordered by the foreground layers.
+    RenderQueue& queue = engine.GetRenderQueue();
+    queue.Begin(projection, *colorShader, *m_debugRenderer);
+    queue.SetCullRect(fgWorldView);
+
     // 4) Sprite outlines (world-space)
-    m_outlineShader->use();
-    m_outlineShader->setMat4("projection", projection);
+    queue.SubmitCustom(RenderLayer::Outline, [this](const Math::Matrix& outlineProjection)
     {
-        Math::Vec2 playerPos = player.GetPosition();
+        m_outlineShader->use();
+        m_outlineShader->setMat4("projection", outlineProjection);
+        const Math::Vec2 playerPos = player.GetPosition();
         m_hallway->DrawSpriteOutlines(*m_outlineShader, playerPos);
         m_rooftop->DrawSpriteOutlines(*m_outlineShader, playerPos);
-    }
-    if (m_isDebugDraw)
-    {
-        player.DrawOutline(*m_outlineShader);
+        if (!m_isDebugDraw)
+            return;
 
+        player.DrawOutline(*m_outlineShader);
         for (const auto& robot : m_underground->GetRobots())
         {
             if (!robot.IsDead())
-            {
                 robot.DrawOutline(*m_outlineShader);
-            }
         }
         for (const auto& robot : m_train->GetRobots())
         {
             if (!robot.IsDead())
-            {
                 robot.DrawOutline(*m_outlineShader);
-            }
         }
-    }
-    GL::Disable(GL_BLEND);
-
-    GL::Enable(GL_BLEND);
-    GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    textureShader.use();
-    textureShader.setMat4("projection", projection);
-    textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-    textureShader.setBool("flipX", false);
-
-    // Drones (same order as former main pass: per-map managers, then room tracers)
-    m_hallway->DrawDrones(textureShader);
-    m_rooftop->DrawDrones(textureShader);
-    m_underground->DrawDrones(textureShader);
-    m_train->DrawDrones(textureShader);
-    droneManager->Draw(textureShader);
+    });
 
-    // Pulse charger "remain" bars: draw before the player so the gauge sits behind the character.
-    colorShader->use();
-    colorShader->setMat4("projection", projection);
-    colorShader->setFloat("uAlpha", 0.72f);
-    for (const auto& src : m_room->GetPulseSources())
-        src.DrawRemainGauge(*colorShader);
-    for (const auto& src : m_hallway->GetPulseSources())
-        src.DrawRemainGauge(*colorShader);
-    for (const auto& src : m_rooftop->GetPulseSources())
-        src.DrawRemainGauge(*colorShader);
-    for (const auto& src : m_underground->GetPulseSources())
-        src.DrawRemainGauge(*colorShader);
-    for (const auto& src : m_train->GetPulseSources())
-        src.DrawRemainGauge(*colorShader);
-    if (m_trainAccessed && m_train)
+    // Drones (same order as former main pass: per-map managers, then room tracers).
+    // Instanced runs are texture-sorted, so this is one instanced draw per drone texture.
+    queue.SubmitInstanced(RenderLayer::Drone, [this](SpriteInstancer& instancer)
     {
-        m_train->DrawCar3SirenProgressGauge(*colorShader, fgCamPos, fgEffectiveWidth * 0.5f);
-        m_train->DrawCarTransportInjectProgressGauge(*colorShader, fgCamPos, fgEffectiveWidth * 0.5f);
-        m_train->DrawCar2InsideLockTimer(*colorShader, fgCamPos, fgEffectiveWidth * 0.5f);
-    }
-    colorShader->setFloat("uAlpha", 1.0f);
+        m_hallway->DrawDrones(instancer);
+        m_rooftop->DrawDrones(instancer);
+        m_underground->DrawDrones(instancer);
+        m_train->DrawDrones(instancer);
+        droneManager->Draw(instancer);
+    });
 
-    textureShader.use();
-    textureShader.setMat4("projection", projection);
-    textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-    textureShader.setBool("flipX", false);
-    player.Draw(textureShader);
+    // Pulse charger "remain" bars: a layer below the player so the gauge sits behind the character.
+    const float fgViewHalfW = fgEffectiveWidth * 0.5f;
+    queue.SubmitColor(RenderLayer::PulseGauge, [this, fgCamPos, fgViewHalfW](Shader& shader, DebugRenderer&)
+    {
+        shader.setFloat("uAlpha", 0.72f);
+        for (const auto& src : m_room->GetPulseSources())
+            src.DrawRemainGauge(shader);
+        for (const auto& src : m_hallway->GetPulseSources())
+            src.DrawRemainGauge(shader);
+        for (const auto& src : m_rooftop->GetPulseSources())
+            src.DrawRemainGauge(shader);
+        for (const auto& src : m_underground->GetPulseSources())
+            src.DrawRemainGauge(shader);
+        for (const auto& src : m_train->GetPulseSources())
+            src.DrawRemainGauge(shader);
+        if (m_trainAccessed && m_train)
+        {
+            m_train->DrawCar3SirenProgressGauge(shader, fgCamPos, fgViewHalfW);
+            m_train->DrawCarTransportInjectProgressGauge(shader, fgCamPos, fgViewHalfW);
+            m_train->DrawCar2InsideLockTimer(shader, fgCamPos, fgViewHalfW);
+        }
+        shader.setFloat("uAlpha", 1.0f);
+    });
 
-    textureShader.use();
-    textureShader.setMat4("projection", projection);
-    textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-    textureShader.setBool("flipX", false);
-    pulseManager->DrawVFX(textureShader);
+    // Dash afterimages go straight under the player sprite.
+    queue.SubmitInstanced(RenderLayer::Afterimage, [this](SpriteInstancer& instancer)
+    {
+        player.DrawAfterimages(instancer);
+    });
 
-    // DrawVFX ends with GL_BLEND disabled; re-enable so railing alpha blends correctly
-    // (otherwise transparent texels overwrite the scene with black during attacks).
-    GL::Enable(GL_BLEND);
-    GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    // Hallway railings on top of player (and drones / pulse VFX in overlap)
-    textureShader.use();
-    textureShader.setMat4("projection", projection);
-    textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-    textureShader.setBool("flipX", false);
-    textureShader.setFloat("alpha", 1.0f);
-    textureShader.setVec3("colorTint", 1.0f, 1.0f, 1.0f);
-    textureShader.setFloat("tintStrength", 0.0f);
-    m_hallway->DrawForeground(textureShader);
+    // Player, pulse VFX, then hallway railings on top (and drones / pulse VFX in overlap)
+    queue.SubmitBatch(RenderLayer::Player, [this](SpriteBatch& batch) { player.Draw(batch); });
+    queue.SubmitBatch(RenderLayer::PulseEffect, [this](SpriteBatch& batch) { pulseManager->DrawVFX(batch); });
+    m_hallway->DrawForeground(queue);
 
     // Hiding-box S.png: hall darkening active + player within range of spot top-center
     if (m_doorOpened && !m_rooftopAccessed && m_hallwayHidingPromptS && m_hallwayHidingPromptS->GetTextureID() != 0)
@@ -2545,59 +2686,44 @@ void GameplayState::DrawForegroundLayer(bool compositeToScreen)
             if ((playerPos - topCenter).LengthSq() > HIDING_S_PROMPT_DISTANCE_SQ)
                 continue;
 
-            textureShader.use();
-            textureShader.setMat4("projection", projection);
-            textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-            textureShader.setBool("flipX", false);
-            textureShader.setFloat("alpha", 1.0f);
-            textureShader.setVec3("colorTint", 1.0f, 1.0f, 1.0f);
-            textureShader.setFloat("tintStrength", 0.0f);
-
             Math::Matrix sModel = Math::Matrix::CreateTranslation(topCenter)
                 * Math::Matrix::CreateScale({ HIDING_S_ICON_WORLD_SIZE, HIDING_S_ICON_WORLD_SIZE });
-            m_hallwayHidingPromptS->Draw(textureShader, sModel);
+            m_hallwayHidingPromptS->Draw(queue, RenderLayer::WorldPrompt, sModel);
         }
     }
 
-    // 6) World-space overlays (radars / gauges)
-    colorShader->use();
-    colorShader->setMat4("projection", projection);
-    droneManager->DrawRadars(*colorShader, *m_debugRenderer);
-    m_hallway->DrawRadars(*colorShader, *m_debugRenderer);
-    m_rooftop->DrawRadars(*colorShader, *m_debugRenderer);
-    m_underground->DrawRadars(*colorShader, *m_debugRenderer);
-    m_train->DrawRadars(*colorShader, *m_debugRenderer);
+    // 6) World-space overlays (radars / gauges); debug shapes flush when the colour run ends.
+    queue.SubmitColor(RenderLayer::Radar, [this](Shader& shader, DebugRenderer& debugRenderer)
+    {
+        droneManager->DrawRadars(shader, debugRenderer);
+        m_hallway->DrawRadars(shader, debugRenderer);
+        m_rooftop->DrawRadars(shader, debugRenderer);
+        m_underground->DrawRadars(shader, debugRenderer);
+        m_train->DrawRadars(shader, debugRenderer);
+        // Gauges draw directly; flush so the HP bars stay on top of the radar lines.
+        debugRenderer.Flush();
 
-    droneManager->DrawGauges(*colorShader, *m_debugRenderer);
-    m_hallway->DrawGauges(*colorShader, *m_debugRenderer);
-    m_rooftop->DrawGauges(*colorShader, *m_debugRenderer);
-    m_underground->DrawGauges(*colorShader, *m_debugRenderer);
-    m_train->DrawGauges(*colorShader, *m_debugRenderer);
+        droneManager->DrawGauges(shader, debugRenderer);
+        m_hallway->DrawGauges(shader, debugRenderer);
+        m_rooftop->DrawGauges(shader, debugRenderer);
+        m_underground->DrawGauges(shader, debugRenderer);
+        m_train->DrawGauges(shader, debugRenderer);
+    });
 
-    pulseManager->DrawDetonationVFX(*colorShader, *m_debugRenderer);
+    queue.SubmitInstanced(RenderLayer::Detonation, [this](SpriteInstancer& instancer)
+    {
+        pulseManager->DrawDetonationVFX(instancer);
+    });
 
     // 7) Fullscreen frame overlay (1920x1080), camera-locked in world space
     if (m_hudFrame && m_hudFrame->GetWidth() > 0)
     {
-        GL::Enable(GL_BLEND);
-        GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-        textureShader.use();
-        textureShader.setMat4("projection", projection);
-        textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-        textureShader.setBool("flipX", false);
-        textureShader.setFloat("alpha", 1.0f);
-        textureShader.setVec3("colorTint", 1.0f, 1.0f, 1.0f);
-        textureShader.setFloat("tintStrength", 0.0f);
-
-        Math::Vec2 camCenter = m_camera.GetPosition();
         // Scale HUD frame to effective view size so it always fills the screen regardless of zoom
-        Math::Matrix hudModel = Math::Matrix::CreateTranslation(camCenter)
+        Math::Matrix hudModel = Math::Matrix::CreateTranslation(fgCamPos)
             * Math::Matrix::CreateScale({ fgEffectiveWidth, fgEffectiveHeight });
-        m_hudFrame->Draw(textureShader, hudModel);
-
-        GL::Disable(GL_BLEND);
+        m_hudFrame->Draw(queue, RenderLayer::HudFrame, hudModel);
     }
+    queue.End();
 
     // 8) Screen-space HUD (pulse gauge)
     GL::Enable(GL_BLEND);
@@ -2617,16 +2743,16 @@ void GameplayState::DrawForegroundLayer(bool compositeToScreen)
     m_fontShader->use();
     m_fontShader->setMat4("projection", baseProjection);
 
-    m_font->DrawBakedText(*m_fontShader, m_fpsText, { 20.f, GAME_HEIGHT - 40.f }, 32.0f);
-
-    m_pulseDetonateSkill.DrawCooldownUI(*m_font, *m_fontShader, GAME_HEIGHT - 80.f);
+    // Per-frame strings (FPS, cooldown, countdowns) are glyph runs: no texture bake per value.
+    SpriteBatch& hudText = engine.GetSpriteBatch();
+    hudText.Begin(baseProjection);
+    m_font->DrawText(hudText, m_fpsLabel, { 20.f, GAME_HEIGHT - 40.f }, 32.0f);
+    m_pulseDetonateSkill.DrawCooldownUI(*m_font, hudText, GAME_HEIGHT - 80.f);
 
     std::string countdownText = m_rooftop->GetLiftCountdownText();
     if (!countdownText.empty())
-    {
-        CachedTextureInfo countdownTexture = m_font->PrintToTexture(*m_fontShader, countdownText);
-        m_font->DrawBakedText(*m_fontShader, countdownTexture, { GAME_WIDTH / 2.0f - 250.0f, 100.0f }, 50.0f);
-    }
+        m_font->DrawText(hudText, countdownText, { GAME_WIDTH / 2.0f - 250.0f, 100.0f }, 50.0f);
+    hudText.End();
 
     // Train departure countdown / status — Conversion.png style, but non-blocking.
     if (m_trainAccessed && m_train)
@@ -2655,33 +2781,33 @@ void GameplayState::DrawForegroundLayer(bool compositeToScreen)
                 m_conversionBackdrop->Draw(textureShader, trainBoxModel);
             }
 
-            m_fontShader->use();
-            m_fontShader->setMat4("projection", baseProjection);
-            CachedTextureInfo trainMsgTex = m_font->PrintToTexture(*m_fontShader, trainMsg);
-            const float rw =
-                static_cast<float>(trainMsgTex.width) * (kTrainBannerFontH / static_cast<float>(m_font->m_fontHeight));
-            m_font->DrawBakedText(*m_fontShader, trainMsgTex,
+            const float rw = m_font->MeasureWidth(trainMsg, kTrainBannerFontH);
+            hudText.Begin(baseProjection);
+            m_font->DrawText(hudText, trainMsg,
                 { boxCenterX - rw * 0.5f, boxCenterY - kTrainBannerFontH * 0.35f }, kTrainBannerFontH);
+            hudText.End();
         }
 
         std::string valveHint = m_train->GetCar5ValveHintBannerText();
         if (!valveHint.empty())
         {
             constexpr float kValveHintFontH = 38.0f;
-            CachedTextureInfo valveTex = m_font->PrintToTexture(*m_fontShader, valveHint);
-            const float rw =
-                static_cast<float>(valveTex.width) * (kValveHintFontH / static_cast<float>(m_font->m_fontHeight));
-            m_font->DrawBakedText(*m_fontShader, valveTex, { GAME_WIDTH * 0.5f - rw * 0.5f, 125.0f },
-                                  kValveHintFontH);
+            const float rw = m_font->MeasureWidth(valveHint, kValveHintFontH);
+            hudText.Begin(baseProjection);
+            m_font->DrawText(hudText, valveHint, { GAME_WIDTH * 0.5f - rw * 0.5f, 125.0f }, kValveHintFontH);
+            hudText.End();
         }
     }
 
+    m_fontShader->use();
+    m_fontShader->setMat4("projection", baseProjection);
+
     m_tutorial->Draw(*m_font, *m_fontShader);
 
     if (m_storyDialogue && m_storyDialogue->IsBlocking())
     {
         Shader& texForStory = engine.GetTextureShader();
-        m_storyDialogue->Draw(*m_font, texForStory, *m_fontShader, baseProjection);
+        m_storyDialogue->Draw(*m_font, texForStory, engine.GetSpriteBatch(), baseProjection);
 
         // Click hint (matches StoryDialogue box size/margin); keyed cursor texture, no black matte.
         constexpr float STORY_BOX_WIDTH = 1680.0f;
@@ -3290,6 +3416,7 @@ void GameplayState::DrawForegroundLayer(bool compositeToScreen)
         m_train->DrawDebug(*colorShader, *m_debugRenderer);
         m_door->DrawDebug(*colorShader);
         m_rooftopDoor->DrawDebug(*colorShader);
+        m_debugRenderer->Flush();
     }
 
     // Black fade overlay for map transitions
@@ -3329,6 +3456,7 @@ void GameplayState::Shutdown()
     m_rooftop->Shutdown();
     m_underground->Shutdown();
     m_train->Shutdown();
+    ZoneStreamer::Instance().Reset(~0u);
     player.Shutdown();
     droneManager->Shutdown();
     m_pulseGauge.Shutdown();
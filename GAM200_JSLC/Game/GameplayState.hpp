@@ -4,6 +4,7 @@
 #include "../Engine/GameState.hpp"
 #include "../Engine/DebugRenderer.hpp"
 #include "../Engine/Camera.hpp"
+#include "../Engine/Rect.hpp"
 #include "../Engine/Sound.hpp"
 #include "Player.hpp"
 #include "PulseSource.hpp"
@@ -50,6 +51,11 @@ public:
     void DrawMainLayer() override;
     void DrawForegroundLayer(bool compositeToScreen = true) override;
 
+    /// Offscreen benchmark (Engine::RunFlythrough): jumps straight into zone with story, tutorial and
+    /// damage off, then pans the camera corner to corner across it over panSeconds. Zones must be
+    /// visited in MapZone order, like a playthrough.
+    void BeginFlythroughZone(MapZone zone, float panSeconds);
+
 private:
     void OpenHallwayDoorLayoutOnly();
     void HandleRoomToHallwayTransition();
@@ -63,6 +69,12 @@ private:
     Math::Vec2 ScreenToWorldCoordinates(double screenX, double screenY) const;
     void WorldToFramebuffer(Math::Vec2 world, double& outFbX, double& outFbY) const;
     void ApplyGamepadDroneTargetingAssist(double dt, Input::Input& input, Math::Vec2& inOutMouseWorldPos);
+    /// Re-applies map JSON config with each map's sprites tagged to its streaming zone.
+    void ApplyMapObjectConfig();
+    MapZone GetActiveZone() const;
+    Math::Rect GetZoneWorldRect(MapZone zone) const;
+    /// Streams zone textures in/out around the active zone (see ZoneStreamer).
+    void UpdateZoneStreaming();
 
     GameStateManager& gsm;
     Player player;
@@ -83,10 +95,8 @@ private:
     double m_fpsTimer = 0.0;
     int m_frameCount = 0;
     std::unique_ptr<Font> m_font;
-    CachedTextureInfo m_pulseText;
     CachedTextureInfo m_debugToggleText;
-    CachedTextureInfo m_fpsText;
-    CachedTextureInfo m_warningLevelText;
+    std::string m_fpsLabel;
     Camera m_camera;
     std::unique_ptr<Hallway> m_hallway;
     std::unique_ptr<Rooftop> m_rooftop;
@@ -4,10 +4,12 @@
 #include "Background.hpp"
 #include "Player.hpp"
 #include "MapObjectTypes.hpp"
+#include "RenderLayers.hpp"
 #include "../OpenGL/Shader.hpp"
 #include "../Engine/Matrix.hpp"
 #include "../Engine/Collision.hpp"
 #include "../Engine/DebugRenderer.hpp"
+#include "../Engine/RenderQueue.hpp"
 #include <algorithm> 
 #include <cmath>
 
@@ -24,6 +26,26 @@ void Hallway::Initialize()
     m_size = { WIDTH, HEIGHT };
     m_position = { ROOM_WIDTH + WIDTH / 2.0f, HEIGHT / 2.0f };
 
+    float railW = 240.0f;
+    float railH = 207.0f;
+
+    int railCount = static_cast<int>(std::ceil(WIDTH / railW));
+
+    float startX = ROOM_WIDTH + (railW / 2.0f);
+    float startY = railH / 2.0f;
+
+    m_railingLayer.Clear();
+    for (int i = 0; i < railCount; ++i)
+    {
+        Math::Vec2 railPos = { startX + (i * railW), startY };
+        Math::Vec2 railSize = { railW, railH };
+
+        m_railingLayer.Add(m_railing.get(), Math::Matrix::CreateTranslation(railPos) * Math::Matrix::CreateScale(railSize));
+    }
+
+    m_staticLayer.Clear();
+    m_staticLayer.Add(m_background.get(), Math::Matrix::CreateTranslation(m_position) * Math::Matrix::CreateScale(m_size));
+
     m_droneManager = std::make_unique<DroneManager>();
     m_droneManager->SpawnDrone({ 2600.0f, 400.0f }, "Asset/Drone.png");
     m_droneManager->SpawnDrone({ 5500.0f, 400.0f }, "Asset/Drone.png");
@@ -69,6 +91,14 @@ void Hallway::ApplyConfig(const HallwayObjectConfig& cfg)
     m_obstaclePos = { cfg.obstacle.topLeft.x + cfg.obstacle.size.x * 0.5f,
                       obsBottomY + cfg.obstacle.size.y * 0.5f };
     m_obstacleSize = cfg.obstacle.size;
+
+    m_staticLayer.Clear();
+    m_staticLayer.Add(m_background.get(), Math::Matrix::CreateTranslation(m_position) * Math::Matrix::CreateScale(m_size));
+    for (const auto& spot : m_hidingSpots)
+    {
+        if (spot.sprite)
+            m_staticLayer.Add(spot.sprite.get(), Math::Matrix::CreateTranslation(spot.pos) * Math::Matrix::CreateScale(spot.size));
+    }
 }
 
 
@@ -114,57 +144,26 @@ void Hallway::Update(double dt, Math::Vec2 playerCenter, Math::Vec2 playerHitbox
     }
 }
 
-void Hallway::Draw(Shader& shader)
+void Hallway::Draw(RenderQueue& queue)
 {
-    Math::Matrix model = Math::Matrix::CreateTranslation(m_position) * Math::Matrix::CreateScale(m_size);
-    shader.setMat4("model", model);
-    m_background->Draw(shader, model);
+    // Background and hiding spots (pre-composited)
+    m_staticLayer.Draw(queue, RenderLayer::MapBackground);
 
     for (const auto& source : m_pulseSources)
     {
-        source.DrawSprite(shader);
-    }
-
-    for (const auto& spot : m_hidingSpots)
-    {
-        if (spot.sprite)
-        {
-            shader.setVec4("spriteRect", 0.f, 0.f, 1.f, 1.f);
-            shader.setBool("flipX", false);
-            Math::Matrix spotModel = Math::Matrix::CreateTranslation(spot.pos) * Math::Matrix::CreateScale(spot.size);
-            spot.sprite->Draw(shader, spotModel);
-        }
+        source.DrawSprite(queue, RenderLayer::MapProp);
     }
 }
 
-void Hallway::DrawDrones(Shader& shader)
+void Hallway::DrawDrones(SpriteInstancer& instancer)
 {
-    m_droneManager->Draw(shader);
+    m_droneManager->Draw(instancer);
 }
 
 
-void Hallway::DrawForeground(Shader& shader)
+void Hallway::DrawForeground(RenderQueue& queue)
 {
-    if (!m_railing) return;
-
-    float railW = 240.0f;
-    float railH = 207.0f;
-
-    int railCount = static_cast<int>(std::ceil(WIDTH / railW));
-
-    float startX = ROOM_WIDTH + (railW / 2.0f);
-    float startY = railH / 2.0f;
-
-    for (int i = 0; i < railCount; ++i)
-    {
-        Math::Vec2 railPos = { startX + (i * railW), startY };
-        Math::Vec2 railSize = { railW, railH };
-
-        Math::Matrix railModel = Math::Matrix::CreateTranslation(railPos) * Math::Matrix::CreateScale(railSize);
-
-        shader.setMat4("model", railModel);
-        m_railing->Draw(shader, railModel);
-    }
+    m_railingLayer.Draw(queue, RenderLayer::Railing);
 }
 
 void Hallway::DrawRadars(const Shader& colorShader, DebugRenderer& debugRenderer) const
@@ -179,6 +178,9 @@ void Hallway::DrawGauges(Shader& colorShader, DebugRenderer& debugRenderer) cons
 
 void Hallway::Shutdown()
 {
+    m_staticLayer.Shutdown();
+    m_railingLayer.Shutdown();
+
     if (m_background)
     {
         m_background->Shutdown();
@@ -310,11 +312,10 @@ void Hallway::DrawSpriteOutlines(Shader& outlineShader,
             int h = spot.sprite->GetHeight();
             if (w <= 0 || h <= 0) continue;
 
-            outlineShader.setVec2("texelSize", 1.0f / w, 1.0f / h);
             outlineShader.setVec4("outlineColor", 0.15f, 1.0f, 0.35f, 1.0f);
 
             Math::Matrix model = Math::Matrix::CreateTranslation(spot.pos) * Math::Matrix::CreateScale(spot.size);
-            spot.sprite->Draw(outlineShader, model);
+            spot.sprite->DrawOutline(outlineShader, model);
         }
     }
 }
\ No newline at end of file
@@ -5,10 +5,13 @@
 #include "PulseSource.hpp"
 #include "DroneManager.hpp"
 #include "Background.hpp"
+#include "StaticLayerCache.hpp"
 #include <memory>
 #include <vector>
 
 class Shader;
+class RenderQueue;
+class SpriteInstancer;
 class Player;
 class DebugRenderer;
 struct HallwayObjectConfig;
@@ -31,10 +34,10 @@ public:
     void ApplyConfig(const HallwayObjectConfig& cfg);
     void Update(double dt, Math::Vec2 playerCenter, Math::Vec2 playerHitboxSize, Player& player, bool isPlayerHiding);
 
-    void Draw(Shader& shader);
-    void DrawDrones(Shader& shader);
+    void Draw(RenderQueue& queue);
+    void DrawDrones(SpriteInstancer& instancer);
 
-    void DrawForeground(Shader& shader);
+    void DrawForeground(RenderQueue& queue);
 
     void DrawRadars(const Shader& colorShader, DebugRenderer& debugRenderer) const;
     void DrawGauges(Shader& colorShader, DebugRenderer& debugRenderer) const;
@@ -71,6 +74,9 @@ private:
 
     std::unique_ptr<Background> m_railing;
 
+    StaticLayerCache m_staticLayer;  // background + hiding spots, re-listed per config load
+    StaticLayerCache m_railingLayer; // the foreground railing strip
+
     Math::Vec2 m_position;
     Math::Vec2 m_size;
     std::vector<PulseSource> m_pulseSources;
@@ -9,14 +9,11 @@
 #include "../Engine/Input.hpp"
 #include "../Engine/Engine.hpp"
 #include "../Engine/Logger.hpp"
+#include "../Engine/AssetCache.hpp"
 #include "../OpenGL/Shader.hpp"
 #include "../OpenGL/GLWrapper.hpp"
 #include "../Engine/Matrix.hpp"
 
-#pragma warning(push, 0)
-#include <stb_image.h>
-#pragma warning(pop)
-
 #include <algorithm>
 #include <cmath>
 
@@ -38,32 +35,13 @@ static constexpr int   kConfirmBlinkSteps    = 4; // off/on/off/on -> two quick
 // ─────────────────────────────────────────────────────────────────────────────
 static void LoadTex(const char* path, unsigned int& id, int& w, int& h)
 {
-    GL::GenTextures(1, &id);
-    GL::BindTexture(GL_TEXTURE_2D, id);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    int ch = 0;
-    stbi_set_flip_vertically_on_load(true);
-    unsigned char* d = stbi_load(path, &w, &h, &ch, 0);
-    if (d)
-    {
-        GLenum fmt = (ch == 4) ? GL_RGBA : GL_RGB;
-        GL::TexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(fmt), w, h, 0, fmt, GL_UNSIGNED_BYTE, d);
-        GL::GenerateMipmap(GL_TEXTURE_2D);
-        stbi_image_free(d);
-    }
-    else
-    {
-        Logger::Instance().Log(Logger::Severity::Error,
-            "MainMenu: failed to load texture '%s'", path);
-        w = h = 1;
-        unsigned char white[] = { 255, 255, 255, 255 };
-        GL::TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
-    }
-    GL::BindTexture(GL_TEXTURE_2D, 0);
+    AssetCache::TextureOptions options;
+    options.whiteFallback = true;
+    options.owner = "MainMenu";
+    const AssetCache::Texture texture = AssetCache::Instance().AcquireTexture(path, options);
+    id = texture.id;
+    w = texture.width;
+    h = texture.height;
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -400,8 +378,10 @@ void MainMenu::Shutdown()
         m_texVBO = 0;
     }
 
-    if (m_bgTexID != 0)    { GL::DeleteTextures(1, &m_bgTexID);    m_bgTexID    = 0; }
-    if (m_clickTexID != 0) { GL::DeleteTextures(1, &m_clickTexID); m_clickTexID = 0; }
+    AssetCache::Instance().ReleaseTexture(m_bgTexID);
+    AssetCache::Instance().ReleaseTexture(m_clickTexID);
+    m_bgTexID = 0;
+    m_clickTexID = 0;
 
     if (m_fadeShader) m_fadeShader.reset();
     if (m_fadeVAO != 0)
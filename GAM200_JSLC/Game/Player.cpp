@@ -2,7 +2,11 @@
 
 #include "Player.hpp"
 #include "../Engine/ControlBindings.hpp"
+#include "../Engine/SimulationClock.hpp"
 #include "../OpenGL/Shader.hpp"
+#include "../Engine/SpriteBatch.hpp"
+#include "../Engine/SpriteInstancer.hpp"
+#include "../Engine/AssetCache.hpp"
 #include "../Engine/Matrix.hpp"
 #include "../OpenGL/GLWrapper.hpp"
 #include <iostream>
@@ -40,44 +44,27 @@ bool Player::LoadAnimation(AnimationState state, const char* texturePath, int to
     int index = static_cast<int>(state);
     AnimationData& anim = m_animations[index];
 
-    GL::GenTextures(1, &anim.textureID);
-    GL::BindTexture(GL_TEXTURE_2D, anim.textureID);
-
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-    int width, height, nrChannels;
-    stbi_set_flip_vertically_on_load(true);
-    unsigned char* data = stbi_load(texturePath, &width, &height, &nrChannels, 0);
-
-    if (data)
-    {
-        anim.texWidth = width;
-        anim.texHeight = height;
-        anim.frameWidth = width / totalFrames;
-        anim.totalFrames = totalFrames;
-        anim.frameDuration = frameDuration;
-
-        GLenum format = (nrChannels == 4) ? GL_RGBA : GL_RGB;
-        GL::TexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        GL::GenerateMipmap(GL_TEXTURE_2D);
-
-        stbi_image_free(data);
-        return true;
-    }
-    else
-    {
-        std::cout << "Failed to load texture: " << texturePath << std::endl;
-        stbi_image_free(data);
+    AssetCache::TextureOptions options;
+    options.filter = AssetCache::Filter::Nearest;
+    options.async = true;
+    options.owner = "Player";
+    const AssetCache::Texture texture = AssetCache::Instance().AcquireTexture(texturePath, options);
+    if (texture.id == 0)
         return false;
-    }
+
+    anim.textureID = texture.id;
+    anim.texWidth = texture.width;
+    anim.texHeight = texture.height;
+    anim.frameWidth = texture.width / totalFrames;
+    anim.totalFrames = totalFrames;
+    anim.frameDuration = frameDuration;
+    return true;
 }
 
 void Player::Init(Math::Vec2 startPos)
 {
     position = startPos;
+    m_prevPosition = startPos;
     velocity = Math::Vec2(0.0f, 0.0f);
     m_currentGroundLevel = GROUND_LEVEL;
     m_trainEnemyUndetectable = false;
@@ -129,6 +116,8 @@ AnimationState Player::DetermineAnimationState() const
 void Player::Update(double dt, Input::Input& input, const ControlBindings& controls)
 {
     const float fdt = static_cast<float>(dt);
+    m_prevPosition = position;
+    m_prevTickedFrame = SimulationClock::Instance().GetTickedFrame();
 
     if (IsDead())
     {
@@ -202,15 +191,8 @@ void Player::Update(double dt, Input::Input& input, const ControlBindings& contr
         m_afterimageSpawnTimer = 0.0f;
     }
 
-    // Fade out existing ghosts and remove expired ones
-    for (auto& ghost : m_afterimageGhosts)
-    {
-        ghost.alpha -= AFTERIMAGE_FADE_SPEED * fdt;
-    }
-    m_afterimageGhosts.erase(
-        std::remove_if(m_afterimageGhosts.begin(), m_afterimageGhosts.end(),
-            [](const AfterimageGhost& g) { return g.alpha <= 0.0f; }),
-        m_afterimageGhosts.end());
+    // Fade out existing ghosts (alpha is INIT_ALPHA * remaining life, so expiry == fully faded)
+    m_afterimages.Age(fdt);
 
     // Horizontal movement with acceleration/deceleration.
     if (!is_dashing)
@@ -332,97 +314,95 @@ void Player::Update(double dt, Input::Input& input, const ControlBindings& contr
         if (m_afterimageSpawnTimer <= 0.0f)
         {
             m_afterimageSpawnTimer = AFTERIMAGE_INTERVAL;
-            AfterimageGhost ghost;
+            ParticlePool::Spawn ghost;
             ghost.position = position;
-            ghost.animState = m_currentAnimState;
-            ghost.animFrame = m_animations[static_cast<int>(m_currentAnimState)].currentFrame;
-            ghost.flipped = m_is_flipped;
+            ghost.life = AFTERIMAGE_INIT_ALPHA / AFTERIMAGE_FADE_SPEED;
             ghost.alpha = AFTERIMAGE_INIT_ALPHA;
-            m_afterimageGhosts.push_back(ghost);
+            ghost.tag = PackAfterimageTag(m_currentAnimState,
+                                          m_animations[static_cast<int>(m_currentAnimState)].currentFrame, m_is_flipped);
+            m_afterimages.Emit(ghost);
         }
     }
 
 }
 
-void Player::Draw(const Shader& shader) const
+std::uint32_t Player::PackAfterimageTag(AnimationState state, int frame, bool flipped)
 {
-    if (m_isInvincible && !IsDead())
-    {
-        if (fmod(m_invincibilityTimer, 0.2f) < 0.1f)
-        {
-            return;
-        }
-    }
+    const std::uint32_t frameBits = static_cast<std::uint32_t>(std::clamp(frame, 0, 0xFFFF));
+    return static_cast<std::uint32_t>(state) | (frameBits << 8) | (flipped ? 0x80000000u : 0u);
+}
+
+bool Player::IsBlinkHidden() const
+{
+    return m_isInvincible && !IsDead() && fmod(m_invincibilityTimer, 0.2f) < 0.1f;
+}
+
+void Player::DrawAfterimages(SpriteInstancer& instancer) const
+{
+    if (m_afterimages.Empty() || IsBlinkHidden())
+        return;
 
-    // Draw Sandevistan afterimage ghosts before the player (they appear behind)
-    if (!m_afterimageGhosts.empty())
+    // Cyberpunk electric cyan tint
+    const SpriteTint ghostTint{ 0.0f, 0.85f, 1.0f, 0.75f };
+
+    for (std::size_t i = 0; i < m_afterimages.Span(); ++i)
     {
-        // Cyberpunk electric cyan tint
-        shader.setVec3("colorTint", 0.0f, 0.85f, 1.0f);
+        if (!m_afterimages.IsAlive(i))
+            continue;
 
-        for (const auto& ghost : m_afterimageGhosts)
+        const std::uint32_t tag = m_afterimages.tag[i];
+        AnimationState ghostState = static_cast<AnimationState>(tag & 0xFFu);
+        const AnimationData* ghostAnim = &m_animations[static_cast<int>(ghostState)];
+        if (ghostAnim->textureID == 0 || ghostAnim->totalFrames <= 0)
         {
-            AnimationState ghostState = ghost.animState;
-            const AnimationData* ghostAnim = &m_animations[static_cast<int>(ghostState)];
-            if (ghostAnim->textureID == 0 || ghostAnim->totalFrames <= 0)
-            {
-                ghostState = AnimationState::Walking;
-                ghostAnim = &m_animations[static_cast<int>(AnimationState::Walking)];
-            }
-
-            Math::Vec2 ghostSize = size;
-            Math::Vec2 ghostPos = ghost.position;
-            if (ghostState == AnimationState::Crouching)
-            {
-                float oldHeight = ghostSize.y;
-                ghostSize.x *= 0.7f;
-                ghostSize.y *= 0.7f;
-                ghostPos.y -= (oldHeight - ghostSize.y) * 0.5f;
-            }
-            else if (ghostState == AnimationState::Idle)
-            {
-                ghostSize.x *= 0.7f;
-            }
+            ghostState = AnimationState::Walking;
+            ghostAnim = &m_animations[static_cast<int>(AnimationState::Walking)];
+        }
 
-            // Apply train-map size scale with bottom-align
-            if (m_sizeScale != 1.0f)
-            {
-                float oldHeight = ghostSize.y;
-                ghostSize.x *= m_sizeScale;
-                ghostSize.y *= m_sizeScale;
-                ghostPos.y -= (oldHeight - ghostSize.y) * 0.5f;
-            }
+        Math::Vec2 ghostSize = size;
+        Math::Vec2 ghostPos = { m_afterimages.posX[i], m_afterimages.posY[i] };
+        if (ghostState == AnimationState::Crouching)
+        {
+            float oldHeight = ghostSize.y;
+            ghostSize.x *= 0.7f;
+            ghostSize.y *= 0.7f;
+            ghostPos.y -= (oldHeight - ghostSize.y) * 0.5f;
+        }
+        else if (ghostState == AnimationState::Idle)
+        {
+            ghostSize.x *= 0.7f;
+        }
 
-            Math::Matrix ghostModel = Math::Matrix::CreateTranslation(ghostPos) *
-                                      Math::Matrix::CreateScale(ghostSize);
-            shader.setMat4("model", ghostModel);
-            shader.setBool("flipX", ghost.flipped);
-            shader.setFloat("alpha", ghost.alpha);
-            shader.setFloat("tintStrength", 0.75f);
-
-            int safeFrame = ghost.animFrame;
-            if (safeFrame < 0) safeFrame = 0;
-            if (safeFrame >= ghostAnim->totalFrames) safeFrame = ghostAnim->totalFrames - 1;
-
-            float frame_x = static_cast<float>(safeFrame * ghostAnim->frameWidth);
-            float rect_x  = frame_x / static_cast<float>(ghostAnim->texWidth);
-            float rect_w  = static_cast<float>(ghostAnim->frameWidth) / static_cast<float>(ghostAnim->texWidth);
-            shader.setVec4("spriteRect", rect_x, 0.0f, rect_w, 1.0f);
-
-            GL::ActiveTexture(GL_TEXTURE0);
-            GL::BindTexture(GL_TEXTURE_2D, ghostAnim->textureID);
-            GL::BindVertexArray(VAO);
-            GL::DrawArrays(GL_TRIANGLES, 0, 6);
-            GL::BindVertexArray(0);
+        // Apply train-map size scale with bottom-align
+        if (m_sizeScale != 1.0f)
+        {
+            float oldHeight = ghostSize.y;
+            ghostSize.x *= m_sizeScale;
+            ghostSize.y *= m_sizeScale;
+            ghostPos.y -= (oldHeight - ghostSize.y) * 0.5f;
         }
 
-        // Reset tint state before drawing the main player sprite
-        shader.setFloat("tintStrength", 0.0f);
+        int safeFrame = static_cast<int>((tag >> 8) & 0xFFFFu);
+        if (safeFrame >= ghostAnim->totalFrames) safeFrame = ghostAnim->totalFrames - 1;
+
+        float frame_x = static_cast<float>(safeFrame * ghostAnim->frameWidth);
+        float rect_x  = frame_x / static_cast<float>(ghostAnim->texWidth);
+        float rect_w  = static_cast<float>(ghostAnim->frameWidth) / static_cast<float>(ghostAnim->texWidth);
+        const float alpha = m_afterimages.alpha[i] * m_afterimages.LifeT(i);
+        instancer.Add(ghostAnim->textureID, ghostPos, ghostSize, 0.0f, (tag & 0x80000000u) != 0, alpha,
+                      { rect_x, 0.0f, rect_w, 1.0f }, ghostTint);
     }
+}
+
+void Player::Draw(SpriteBatch& batch) const
+{
+    if (IsBlinkHidden())
+        return;
 
     Math::Vec2 drawSize{};
     Math::Vec2 drawPosition{};
     GetCurrentDrawTransform(drawPosition, drawSize);
+    drawPosition += SimulationClock::Instance().InterpolationOffset(m_prevPosition, position, m_prevTickedFrame);
 
     // Apply train-map size scale with bottom-align
     if (m_sizeScale != 1.0f)
@@ -437,12 +417,7 @@ void Player::Draw(const Shader& shader) const
     Math::Matrix transMatrix = Math::Matrix::CreateTranslation(drawPosition);
     Math::Matrix model = transMatrix * scaleMatrix;
 
-    shader.use();
-    shader.setMat4("model", model);
-    shader.setBool("flipX", m_is_flipped);
-
     const float baseAlpha = m_isHiding ? 0.5f : 1.0f;
-    shader.setFloat("alpha", baseAlpha * m_spriteAlphaMul);
 
     const AnimationData& currentAnim = m_animations[static_cast<int>(m_currentAnimState)];
 
@@ -452,16 +427,8 @@ void Player::Draw(const Shader& shader) const
     float rect_w = static_cast<float>(currentAnim.frameWidth) / currentAnim.texWidth;
     float rect_h = 1.0f;
 
-    shader.setVec4("spriteRect", rect_x, rect_y, rect_w, rect_h);
-
-    GL::ActiveTexture(GL_TEXTURE0);
-    GL::BindTexture(GL_TEXTURE_2D, currentAnim.textureID);
-    GL::BindVertexArray(VAO);
-    GL::DrawArrays(GL_TRIANGLES, 0, 6);
-    GL::BindVertexArray(0);
-
-    shader.setFloat("alpha", 1.0f);
-    shader.setFloat("tintStrength", 0.0f);
+    batch.Draw(currentAnim.textureID, model, { rect_x, rect_y, rect_w, rect_h }, m_is_flipped,
+               baseAlpha * m_spriteAlphaMul);
 }
 
 void Player::DrawOutline(const Shader& outlineShader) const
@@ -473,10 +440,13 @@ void Player::DrawOutline(const Shader& outlineShader) const
     {
         return;
     }
+    if (!AssetCache::Instance().BindOutlineField(currentAnim.textureID))
+        return;
 
     Math::Vec2 drawSize{};
     Math::Vec2 drawPosition{};
     GetCurrentDrawTransform(drawPosition, drawSize);
+    drawPosition += SimulationClock::Instance().InterpolationOffset(m_prevPosition, position, m_prevTickedFrame);
 
     // Apply train-map size scale with bottom-align
     if (m_sizeScale != 1.0f)
@@ -495,8 +465,6 @@ void Player::DrawOutline(const Shader& outlineShader) const
     outlineShader.setFloat("alpha", (m_isHiding ? 0.5f : 1.0f) * m_spriteAlphaMul);
     outlineShader.setVec4("outlineColor", 0.2f, 0.6f, 1.0f, 1.0f);
     outlineShader.setFloat("outlineWidthTexels", 2.0f);
-    outlineShader.setVec2("texelSize", 1.0f / static_cast<float>(currentAnim.frameWidth),
-                          1.0f / static_cast<float>(currentAnim.texHeight));
 
     float frame_x_offset = static_cast<float>(currentAnim.currentFrame * currentAnim.frameWidth);
     float rect_x = frame_x_offset / static_cast<float>(currentAnim.texWidth);
@@ -517,10 +485,8 @@ void Player::Shutdown()
 
     for (int i = 0; i < 5; ++i)
     {
-        if (m_animations[i].textureID != 0)
-        {
-            GL::DeleteTextures(1, &m_animations[i].textureID);
-        }
+        AssetCache::Instance().ReleaseTexture(m_animations[i].textureID);
+        m_animations[i].textureID = 0;
     }
 }
 
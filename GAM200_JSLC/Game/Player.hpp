@@ -4,12 +4,15 @@
 #include "../Engine/Vec2.hpp"
 #include "../Game/PulseCore.hpp"
 #include "../Engine/Input.hpp"
+#include "../Engine/ParticlePool.hpp"
 
 class ControlBindings;
 
 #include <vector>
 
 class Shader;
+class SpriteBatch;
+class SpriteInstancer;
 
 enum class AnimationState
 {
@@ -20,15 +23,6 @@ enum class AnimationState
     Dashing
 };
 
-struct AfterimageGhost
-{
-    Math::Vec2 position;
-    int animFrame = 0;
-    AnimationState animState = AnimationState::Walking;
-    bool flipped = false;
-    float alpha = 0.65f;
-};
-
 struct AnimationData
 {
     unsigned int textureID = 0;
@@ -48,7 +42,9 @@ class Player
 public:
     void Init(Math::Vec2 startPos);
     void Update(double dt, Input::Input& input, const ControlBindings& controls);
-    void Draw(const Shader& shader) const;
+    void Draw(SpriteBatch& batch) const;
+    /// Sandevistan ghosts; draw right before Draw() so they sit behind the player.
+    void DrawAfterimages(SpriteInstancer& instancer) const;
     void DrawOutline(const Shader& outlineShader) const;
     void Shutdown();
     void MoveLeft();
@@ -118,6 +114,8 @@ private:
     AnimationData m_animations[5];
     AnimationState m_currentAnimState = AnimationState::Idle;
     Math::Vec2 position{};
+    Math::Vec2 m_prevPosition{}; // position at the start of the last fixed tick (render interpolation)
+    long long m_prevTickedFrame = -1; // SimulationClock::GetTickedFrame() when m_prevPosition was stored
     Math::Vec2 velocity{};
     Math::Vec2 size{};
     bool is_on_ground = false;
@@ -159,10 +157,15 @@ private:
     bool  m_trainJumpBlocked = false;
     float m_spriteAlphaMul = 1.0f;
 
+    bool IsBlinkHidden() const;
+
     // Sandevistan afterimage effect
-    std::vector<AfterimageGhost> m_afterimageGhosts;
+    // Ghost tag: animation state in bits 0-7, frame in bits 8-23, flipped in bit 31.
+    static std::uint32_t PackAfterimageTag(AnimationState state, int frame, bool flipped);
     float m_afterimageSpawnTimer = 0.0f;
     static constexpr float AFTERIMAGE_INTERVAL   = 0.025f;
     static constexpr float AFTERIMAGE_FADE_SPEED = 5.0f;
     static constexpr float AFTERIMAGE_INIT_ALPHA = 0.65f;
+    static constexpr std::size_t AFTERIMAGE_CAPACITY = 32;
+    ParticlePool m_afterimages{ AFTERIMAGE_CAPACITY };
 };
\ No newline at end of file
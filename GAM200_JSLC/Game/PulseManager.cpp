@@ -9,6 +9,9 @@
 #include "../Engine/Collision.hpp"
 #include "../Engine/DebugRenderer.hpp"
 #include "../OpenGL/Shader.hpp"
+#include "../Engine/SpriteBatch.hpp"
+#include "../Engine/SpriteInstancer.hpp"
+#include "../Engine/AssetCache.hpp"
 #include "../Engine/Matrix.hpp"
 #include "../OpenGL/GLWrapper.hpp"
 #include <cmath>
@@ -16,10 +19,6 @@
 #include <algorithm>
 #include <random> 
 
-#pragma warning(push, 0)
-#include <stb_image.h>
-#pragma warning(pop)
-
 constexpr float PI = 3.14159265359f;
 
 std::default_random_engine generator;
@@ -29,31 +28,10 @@ void PulseManager::Initialize()
 {
     auto LoadTexture = [&](const char* path) -> GLuint
         {
-            GLuint tex = 0;
-            GL::GenTextures(1, &tex);
-            GL::BindTexture(GL_TEXTURE_2D, tex);
-
-            GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-            GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-            GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-            GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-            int w, h, ch;
-            stbi_set_flip_vertically_on_load(true);
-            unsigned char* data = stbi_load(path, &w, &h, &ch, 0);
-
-            if (!data)
-            {
-                Logger::Instance().Log(Logger::Severity::Error, "Failed to load texture: %s", path);
-                return 0;
-            }
-
-            GLenum format = (ch == 4) ? GL_RGBA : GL_RGB;
-            GL::TexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, GL_UNSIGNED_BYTE, data);
-            GL::GenerateMipmap(GL_TEXTURE_2D);
-
-            stbi_image_free(data);
-            return tex;
+            AssetCache::TextureOptions options;
+            options.filter = AssetCache::Filter::Nearest;
+            options.owner = "PulseManager";
+            return AssetCache::Instance().AcquireTexture(path, options).id;
         };
 
     m_texCornerNE = LoadTexture("Asset/pulse/pulse_corner_ne.png");
@@ -65,26 +43,6 @@ void PulseManager::Initialize()
 
     m_fluidTexID = LoadTexture("Asset/pulse/PulseFluid.png");
 
-    float vertices[] = {
-        -0.5f,  0.5f,   0.0f, 1.0f,
-         0.5f, -0.5f,   1.0f, 0.0f,
-        -0.5f, -0.5f,   0.0f, 0.0f,
-        -0.5f,  0.5f,   0.0f, 1.0f,
-         0.5f,  0.5f,   1.0f, 1.0f,
-         0.5f, -0.5f,   1.0f, 0.0f
-    };
-
-    GL::GenVertexArrays(1, &m_pulseVAO);
-    GL::GenBuffers(1, &m_pulseVBO);
-    GL::BindVertexArray(m_pulseVAO);
-    GL::BindBuffer(GL_ARRAY_BUFFER, m_pulseVBO);
-    GL::BufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-    GL::VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-    GL::EnableVertexAttribArray(0);
-    GL::VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
-    GL::EnableVertexAttribArray(1);
-    GL::BindVertexArray(0);
-
     m_logTimer = 0.0;
 }
 
@@ -92,17 +50,15 @@ void PulseManager::Initialize()
 
 void PulseManager::Shutdown()
 {
-    if (m_fluidTexID != 0) GL::DeleteTextures(1, &m_fluidTexID);
-
-    if (m_texCornerNE) GL::DeleteTextures(1, &m_texCornerNE);
-    if (m_texCornerNW) GL::DeleteTextures(1, &m_texCornerNW);
-    if (m_texCornerSE) GL::DeleteTextures(1, &m_texCornerSE);
-    if (m_texCornerSW) GL::DeleteTextures(1, &m_texCornerSW);
-    if (m_texLineH)    GL::DeleteTextures(1, &m_texLineH);
-    if (m_texLineV)    GL::DeleteTextures(1, &m_texLineV);
+    AssetCache& cache = AssetCache::Instance();
+    cache.ReleaseTexture(m_fluidTexID);
 
-    GL::DeleteVertexArrays(1, &m_pulseVAO);
-    GL::DeleteBuffers(1, &m_pulseVBO);
+    cache.ReleaseTexture(m_texCornerNE);
+    cache.ReleaseTexture(m_texCornerNW);
+    cache.ReleaseTexture(m_texCornerSE);
+    cache.ReleaseTexture(m_texCornerSW);
+    cache.ReleaseTexture(m_texLineH);
+    cache.ReleaseTexture(m_texLineV);
 
     m_fluidTexID = 0;
     m_texCornerNE = m_texCornerNW = m_texCornerSE = m_texCornerSW = 0;
@@ -239,12 +195,7 @@ void PulseManager::Update(Math::Vec2 playerHitboxCenter, Math::Vec2 playerHitbox
     }
 
     // Chain arc timers
-    for (auto& arc : m_chainArcs)
-        arc.timer += fdt;
-    m_chainArcs.erase(
-        std::remove_if(m_chainArcs.begin(), m_chainArcs.end(),
-            [](const ChainArc& a) { return a.timer >= CHAIN_ARC_DURATION; }),
-        m_chainArcs.end());
+    m_chainArcs.Age(fdt);
 
     PulseSource* closest_source = nullptr;
     float closest_dist_sq = -1.0f;
@@ -304,19 +255,13 @@ void PulseManager::SetVFXScale(float scale)
     m_vfxScale = std::clamp(scale, 0.65f, 1.15f);
 }
 
-void PulseManager::DrawVFX(const Shader& shader) const
+void PulseManager::DrawVFX(SpriteBatch& batch) const
 {
     if (!m_isAttacking && !m_isCharging) return;
 
-    GL::Enable(GL_BLEND);
-    GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    shader.use();
-    GL::ActiveTexture(GL_TEXTURE0);
-    GL::BindVertexArray(m_pulseVAO);
-
-    shader.setBool("flipX", false);
-    shader.setVec4("spriteRect", 0.f, 0.f, 1.f, 1.f);
+    // Texture / UV rect the tiling helpers below draw with (replaces the old bound-texture + uniform state).
+    GLuint currentTex = 0;
+    SpriteBatch::UVRect rect;
 
     const float s = m_vfxScale;
     const float TILE = 16.0f * s;
@@ -336,8 +281,7 @@ void PulseManager::DrawVFX(const Shader& shader) const
             Math::Matrix model =
                 Math::Matrix::CreateTranslation(p) *
                 Math::Matrix::CreateScale(size);
-            shader.setMat4("model", model);
-            GL::DrawArrays(GL_TRIANGLES, 0, 6);
+            batch.Draw(currentTex, model, rect);
         };
 
     auto safeDir = [&](Math::Vec2 a, Math::Vec2 b) -> Math::Vec2
@@ -383,12 +327,12 @@ void PulseManager::DrawVFX(const Shader& shader) const
             float len = b.x - a.x;
             if (len < 0.5f) return;
 
-            GL::BindTexture(GL_TEXTURE_2D, m_texLineH);
+            currentTex = m_texLineH;
 
             int full = (int)(len / TILE);
             float rem = len - full * TILE;
 
-            shader.setVec4("spriteRect", 0.f, 0.f, 1.f, 1.f);
+            rect = { 0.f, 0.f, 1.f, 1.f };
             for (int i = 0; i < full; ++i)
             {
                 Math::Vec2 p = { a.x + (i + 0.5f) * TILE, a.y };
@@ -398,12 +342,12 @@ void PulseManager::DrawVFX(const Shader& shader) const
             if (rem > 0.5f)
             {
                 float u = rem / TILE;
-                shader.setVec4("spriteRect", 0.f, 0.f, u, 1.f);
+                rect = { 0.f, 0.f, u, 1.f };
 
                 Math::Vec2 p = { a.x + full * TILE + rem * 0.5f, a.y };
                 drawSprite(p, { rem, TILE });
 
-                shader.setVec4("spriteRect", 0.f, 0.f, 1.f, 1.f);
+                rect = { 0.f, 0.f, 1.f, 1.f };
             }
         };
 
@@ -415,12 +359,12 @@ void PulseManager::DrawVFX(const Shader& shader) const
             float len = b.y - a.y;
             if (len < 0.5f) return;
 
-            GL::BindTexture(GL_TEXTURE_2D, m_texLineV);
+            currentTex = m_texLineV;
 
             int full = (int)(len / TILE);
             float rem = len - full * TILE;
 
-            shader.setVec4("spriteRect", 0.f, 0.f, 1.f, 1.f);
+            rect = { 0.f, 0.f, 1.f, 1.f };
             for (int i = 0; i < full; ++i)
             {
                 Math::Vec2 p = { a.x, a.y + (i + 0.5f) * TILE };
@@ -430,12 +374,12 @@ void PulseManager::DrawVFX(const Shader& shader) const
             if (rem > 0.5f)
             {
                 float v = rem / TILE;
-                shader.setVec4("spriteRect", 0.f, 0.f, 1.f, v);
+                rect = { 0.f, 0.f, 1.f, v };
 
                 Math::Vec2 p = { a.x, a.y + full * TILE + rem * 0.5f };
                 drawSprite(p, { TILE, rem });
 
-                shader.setVec4("spriteRect", 0.f, 0.f, 1.f, 1.f);
+                rect = { 0.f, 0.f, 1.f, 1.f };
             }
         };
 
@@ -456,9 +400,9 @@ void PulseManager::DrawVFX(const Shader& shader) const
             Math::Vec2 outDir = next - corner;
 
             GLuint tex = cornerTexFromDirs(inDir, outDir);
-            GL::BindTexture(GL_TEXTURE_2D, tex);
+            currentTex = tex;
 
-            shader.setVec4("spriteRect", 0.f, 0.f, 1.f, 1.f);
+            rect = { 0.f, 0.f, 1.f, 1.f };
             drawSprite(corner, { TILE, TILE });
         };
 
@@ -512,8 +456,8 @@ void PulseManager::DrawVFX(const Shader& shader) const
                 {
                     float headS = phase * totalLen;
 
-                    GL::BindTexture(GL_TEXTURE_2D, m_fluidTexID);
-                    shader.setVec4("spriteRect", 0.f, 0.f, 1.f, 1.f);
+                    currentTex = m_fluidTexID;
+                    rect = { 0.f, 0.f, 1.f, 1.f };
 
                     auto drawPacketRect = [&](float sHead, float len, float thickness)
                         {
@@ -548,9 +492,6 @@ void PulseManager::DrawVFX(const Shader& shader) const
             }
         }
 
-        shader.setVec4("spriteRect", 0.f, 0.f, 1.f, 1.f);
-        GL::BindVertexArray(0);
-        GL::Disable(GL_BLEND);
         return;
     }
 
@@ -573,15 +514,7 @@ void PulseManager::DrawVFX(const Shader& shader) const
             drawSegment_Tiled(corner, end);
             drawCornerAuto(start, corner, end);
         }
-
-        shader.setVec4("spriteRect", 0.f, 0.f, 1.f, 1.f);
-        GL::BindVertexArray(0);
-        GL::Disable(GL_BLEND);
-        return;
     }
-
-    GL::BindVertexArray(0);
-    GL::Disable(GL_BLEND);
 }
 
 void PulseManager::StartDetonationVFX(Math::Vec2 origin, float maxRadius,
@@ -592,9 +525,15 @@ void PulseManager::StartDetonationVFX(Math::Vec2 origin, float maxRadius,
     m_detonationMaxRadius = maxRadius;
     m_detonationTimer     = 0.f;
 
-    m_chainArcs.clear();
+    m_chainArcs.Clear();
     for (const auto& [from, to] : chainArcs)
-        m_chainArcs.push_back({ from, to, 0.f });
+    {
+        ParticlePool::Spawn arc;
+        arc.position = from;
+        arc.aux = to;
+        arc.life = CHAIN_ARC_DURATION;
+        m_chainArcs.Emit(arc);
+    }
 }
 
 void PulseManager::SyncDetonationOriginToPlayer(Math::Vec2 playerHitboxCenter)
@@ -603,9 +542,9 @@ void PulseManager::SyncDetonationOriginToPlayer(Math::Vec2 playerHitboxCenter)
         m_detonationOrigin = playerHitboxCenter;
 }
 
-void PulseManager::DrawDetonationVFX(Shader& colorShader, DebugRenderer& debugRenderer) const
+void PulseManager::DrawDetonationVFX(SpriteInstancer& instancer) const
 {
-    if (!m_detonationActive && m_chainArcs.empty())
+    if (!m_detonationActive && m_chainArcs.Empty())
         return;
 
     // ── Shockwave ────────────────────────────────────────────────────────────
@@ -625,8 +564,7 @@ void PulseManager::DrawDetonationVFX(Shader& colorShader, DebugRenderer& debugRe
                     float kp = p * (1.f - k * 0.12f);
                     float r  = kp * m_detonationMaxRadius * 0.45f;
                     float f  = fade * (1.f - k * 0.2f);
-                    debugRenderer.DrawCircle(colorShader, m_detonationOrigin, r,
-                                             { f * 0.6f, f });
+                    instancer.AddRing(m_detonationOrigin, r, VFX_RING_WIDTH, f * 0.6f, f, 0.8f);
                 }
             }
         }
@@ -647,14 +585,13 @@ void PulseManager::DrawDetonationVFX(Shader& colorShader, DebugRenderer& debugRe
                     Math::Vec2 endPt = m_detonationOrigin
                         + Math::Vec2{ std::cos(angle), std::sin(angle) } * len;
                     float rS = fade * 0.3f, gS = fade, bS = fade;
-                    debugRenderer.DrawLine(colorShader, m_detonationOrigin, endPt, rS, gS, bS, 7.f);
+                    instancer.AddLine(m_detonationOrigin, endPt, 7.f, rS, gS, bS);
 
                     // Secondary spike at halfway angle
                     float aHalf = angle + (PI / SPIKE_COUNT);
                     Math::Vec2 ep2 = m_detonationOrigin
                         + Math::Vec2{ std::cos(aHalf), std::sin(aHalf) } * (len * 0.60f);
-                    debugRenderer.DrawLine(colorShader, m_detonationOrigin, ep2,
-                                           rS * 0.55f, gS * 0.55f, bS * 0.55f, 4.5f);
+                    instancer.AddLine(m_detonationOrigin, ep2, 4.5f, rS * 0.55f, gS * 0.55f, bS * 0.55f);
                 }
             }
         }
@@ -670,25 +607,29 @@ void PulseManager::DrawDetonationVFX(Shader& colorShader, DebugRenderer& debugRe
             float eRadius  = easedP * m_detonationMaxRadius;
             float fade     = 1.f - progress;
 
-            debugRenderer.DrawCircle(colorShader, m_detonationOrigin, eRadius,
-                                     { fade * 0.15f, fade });
+            instancer.AddRing(m_detonationOrigin, eRadius, VFX_RING_WIDTH, fade * 0.15f, fade, 0.8f);
             if (eRadius > 8.f)
-                debugRenderer.DrawCircle(colorShader, m_detonationOrigin, eRadius * 0.88f,
-                                         { fade * 0.05f, fade * 0.55f });
+                instancer.AddRing(m_detonationOrigin, eRadius * 0.88f, VFX_RING_WIDTH, fade * 0.05f, fade * 0.55f, 0.8f);
             // Extra bright leading edge (slightly larger)
-            debugRenderer.DrawCircle(colorShader, m_detonationOrigin, eRadius * 1.03f,
-                                     { fade * 0.08f, fade * 0.70f });
+            instancer.AddRing(m_detonationOrigin, eRadius * 1.03f, VFX_RING_WIDTH, fade * 0.08f, fade * 0.70f, 0.8f);
         }
     }
 
     // ── Chain arc — 지지직 purple zigzag lightning ───────────────────────────
-    for (const auto& arc : m_chainArcs)
+    for (std::size_t i = 0; i < m_chainArcs.Span(); ++i)
     {
-        float p    = arc.timer / CHAIN_ARC_DURATION;
+        if (!m_chainArcs.IsAlive(i))
+            continue;
+
+        // Same shape as before: timer counts up from 0 while life counts down.
+        const float timer = CHAIN_ARC_DURATION - m_chainArcs.life[i];
+        const Math::Vec2 from{ m_chainArcs.posX[i], m_chainArcs.posY[i] };
+        const Math::Vec2 to{ m_chainArcs.auxX[i], m_chainArcs.auxY[i] };
+        float p    = timer / CHAIN_ARC_DURATION;
         float fade = std::max(0.f, 1.f - p * 0.75f); // slower fade-out so arcs stay readable
         if (fade <= 0.f) continue;
 
-        Math::Vec2 dir = arc.to - arc.from;
+        Math::Vec2 dir = to - from;
         float len = dir.Length();
         if (len < 1.f) continue;
 
@@ -696,66 +637,66 @@ void PulseManager::DrawDetonationVFX(Shader& colorShader, DebugRenderer& debugRe
         Math::Vec2 perp    = normDir.Perpendicular();
 
         // 부드러운 밝기 변조 (지지직 단절 느낌 완화)
-        const float flicker = 0.78f + 0.22f * (0.5f + 0.5f * std::sin(arc.timer * 22.f));
+        const float flicker = 0.78f + 0.22f * (0.5f + 0.5f * std::sin(timer * 22.f));
         float       ef      = fade * flicker;
 
         // 지그재그: 주파수 낮춤 → 흐름이 더 부드럽고 읽기 쉬움
         const float amp  = 44.f * fade;
         const float freq = 16.f;
-        Math::Vec2 q1 = arc.from + normDir * (len * 0.25f)
-                        + perp * (amp * std::sin(arc.timer * freq));
-        Math::Vec2 q2 = arc.from + normDir * (len * 0.50f)
-                        + perp * (amp * std::cos(arc.timer * freq + 1.3f));
-        Math::Vec2 q3 = arc.from + normDir * (len * 0.75f)
-                        + perp * (amp * std::sin(arc.timer * freq + 2.7f));
+        Math::Vec2 q1 = from + normDir * (len * 0.25f)
+                        + perp * (amp * std::sin(timer * freq));
+        Math::Vec2 q2 = from + normDir * (len * 0.50f)
+                        + perp * (amp * std::cos(timer * freq + 1.3f));
+        Math::Vec2 q3 = from + normDir * (len * 0.75f)
+                        + perp * (amp * std::sin(timer * freq + 2.7f));
 
         auto seg = [&](Math::Vec2 a, Math::Vec2 b, float r, float g, float bcol, float thick) {
-            debugRenderer.DrawLine(colorShader, a, b, r, g, bcol, thick);
+            instancer.AddLine(a, b, thick, r, g, bcol);
         };
 
         // 넓은 페더 (가장 아래 — 차-차 / 차-드론 연쇄가 잘 보이도록)
         float rF = ef * 0.35f, gF = ef * 0.06f, bF = ef * 0.45f;
-        seg(arc.from, q1, rF, gF, bF, 26.f);
+        seg(from, q1, rF, gF, bF, 26.f);
         seg(q1, q2, rF, gF, bF, 26.f);
         seg(q2, q3, rF, gF, bF, 26.f);
-        seg(q3, arc.to, rF, gF, bF, 26.f);
+        seg(q3, to, rF, gF, bF, 26.f);
 
         // 직선 백본 (지그재그 중심 대략 따라 가시성 보강)
         float rB = ef * 0.45f, gB = ef * 0.08f, bB = ef * 0.55f;
-        seg(arc.from, arc.to, rB, gB, bB, 12.f);
+        seg(from, to, rB, gB, bB, 12.f);
 
         // 코어: 밝은 지그재그
         float rC = ef * 1.00f, gC = ef * 0.20f, bC = ef * 1.00f;
-        seg(arc.from, q1, rC, gC, bC, 9.f);
+        seg(from, q1, rC, gC, bC, 9.f);
         seg(q1, q2, rC, gC, bC, 9.f);
         seg(q2, q3, rC, gC, bC, 9.f);
-        seg(q3, arc.to, rC, gC, bC, 9.f);
+        seg(q3, to, rC, gC, bC, 9.f);
 
         // 시안 하이라이트 (두껍게)
         {
             float rA = ef * 0.18f, gA = ef * 1.00f, bA = ef * 1.0f;
             constexpr float AC_OFF = 5.0f;
             Math::Vec2      aoff   = normDir * AC_OFF + perp * (AC_OFF * 0.45f);
-            seg(arc.from + aoff * 0.25f, q2 + aoff, rA, gA, bA, 6.f);
-            seg(q2 + aoff, arc.to - aoff * 0.18f, rA * 0.88f, gA * 0.88f, bA * 0.88f, 5.f);
+            seg(from + aoff * 0.25f, q2 + aoff, rA, gA, bA, 6.f);
+            seg(q2 + aoff, to - aoff * 0.18f, rA * 0.88f, gA * 0.88f, bA * 0.88f, 5.f);
         }
 
         // 글로우: 이중 오프셋 직선
         float rG = ef * 0.88f, gG = ef * 0.12f, bG = ef * 1.0f;
         constexpr float GLOW_OFF = 11.0f;
         Math::Vec2      off      = perp * GLOW_OFF;
-        seg(arc.from + off, arc.to + off, rG * 0.55f, gG * 0.55f, bG * 0.55f, 8.f);
-        seg(arc.from - off, arc.to - off, rG * 0.55f, gG * 0.55f, bG * 0.55f, 8.f);
-        seg(arc.from + off * 1.55f, arc.to + off * 1.55f, rG * 0.40f, gG * 0.40f, bG * 0.40f, 5.f);
-        seg(arc.from - off * 1.55f, arc.to - off * 1.55f, rG * 0.40f, gG * 0.40f, bG * 0.40f, 5.f);
+        seg(from + off, to + off, rG * 0.55f, gG * 0.55f, bG * 0.55f, 8.f);
+        seg(from - off, to - off, rG * 0.55f, gG * 0.55f, bG * 0.55f, 8.f);
+        seg(from + off * 1.55f, to + off * 1.55f, rG * 0.40f, gG * 0.40f, bG * 0.40f, 5.f);
+        seg(from - off * 1.55f, to - off * 1.55f, rG * 0.40f, gG * 0.40f, bG * 0.40f, 5.f);
 
         float hf   = fade * 1.0f;
         float hitR = 46.f + (1.f - fade) * 58.f;
-        debugRenderer.DrawCircle(colorShader, arc.to, hitR, { hf * 0.90f, 0.f });
-        debugRenderer.DrawCircle(colorShader, arc.to, hitR * 0.58f, { hf * 0.68f, 0.f });
+        instancer.AddRing(to, hitR, VFX_RING_WIDTH, hf * 0.90f, 0.f, 0.8f);
+        instancer.AddRing(to, hitR * 0.58f, VFX_RING_WIDTH, hf * 0.68f, 0.f, 0.8f);
 
         float sf   = fade * 0.78f;
         float srcR = 32.f + (1.f - fade) * 34.f;
-        debugRenderer.DrawCircle(colorShader, arc.from, srcR, { sf * 0.75f, 0.f });
+        instancer.AddRing(from, srcR, VFX_RING_WIDTH, sf * 0.75f, 0.f, 0.8f);
     }
 }
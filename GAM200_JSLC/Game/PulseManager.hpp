@@ -3,12 +3,15 @@
 #pragma once
 #include "../Engine/Vec2.hpp"
 #include "Player.hpp" 
+#include "../Engine/ParticlePool.hpp"
 #include <vector>
 #include <utility>
 #include <memory>
 
 class PulseSource;
 class Shader;
+class SpriteBatch;
+class SpriteInstancer;
 class DebugRenderer;
 
 class PulseManager
@@ -32,14 +35,14 @@ public:
         float attackSide = 1.0f
     );
 
-    void DrawVFX(const Shader& shader) const;
+    void DrawVFX(SpriteBatch& batch) const;
     void SetVFXScale(float scale);
 
     void StartDetonationVFX(Math::Vec2 origin, float maxRadius,
                             const std::vector<std::pair<Math::Vec2, Math::Vec2>>& chainArcs = {});
     /// 매 프레임 플레이어 중심에 맞춤(기차 이동·점프 중에도 원이 플레이어에 붙음)
     void SyncDetonationOriginToPlayer(Math::Vec2 playerHitboxCenter);
-    void DrawDetonationVFX(Shader& colorShader, DebugRenderer& debugRenderer) const;
+    void DrawDetonationVFX(SpriteInstancer& instancer) const;
 
 private:
     AnimationData m_pulseAnim;
@@ -51,8 +54,6 @@ private:
     unsigned int m_texCornerSW = 0;
 
     unsigned int m_fluidTexID = 0;
-    unsigned int m_pulseVAO = 0;
-    unsigned int m_pulseVBO = 0;
 
 
 
@@ -94,15 +95,12 @@ private:
     static constexpr float DETONATION_RING_STAGGER   = 0.07f;
     static constexpr float DETONATION_RING_DURATION  = 0.75f;
 
-    // Chain arc VFX (Static-style chained pulse between drones)
-    struct ChainArc
-    {
-        Math::Vec2 from{};
-        Math::Vec2 to{};
-        float timer = 0.f;
-    };
-    std::vector<ChainArc> m_chainArcs;
+    // Chain arc VFX (Static-style chained pulse between drones): position = from, aux = to
     static constexpr float CHAIN_ARC_DURATION = 0.40f;  // longer visibility for readability
+    static constexpr std::size_t CHAIN_ARC_CAPACITY = 128;
+    ParticlePool m_chainArcs{ CHAIN_ARC_CAPACITY };
+    // Shockwave / hit circles were 1px debug lines; now instanced rings of this world width.
+    static constexpr float VFX_RING_WIDTH = 1.5f;
 
     float m_vfxScale = 1.0f;
 };
\ No newline at end of file
@@ -84,7 +84,7 @@ void PulseSource::InitializeSprite(const char* texPath, Math::Vec2 pivot)
     m_sprite->Initialize(texPath);
 }
 
-void PulseSource::DrawSprite(Shader& textureShader) const
+void PulseSource::DrawSprite(RenderQueue& queue, uint8_t layer) const
 {
     if (!m_sprite) return;
 
@@ -93,11 +93,8 @@ void PulseSource::DrawSprite(Shader& textureShader) const
         m_position.y + (0.5f - m_pivot.y) * m_size.y
     };
 
-    textureShader.setVec4("spriteRect", 0.f, 0.f, 1.f, 1.f);
-    textureShader.setBool("flipX", false);
-
     Math::Matrix model = Math::Matrix::CreateTranslation(renderPos) * Math::Matrix::CreateScale(m_size);
-    m_sprite->Draw(textureShader, model);
+    m_sprite->Draw(queue, layer, model);
 }
 
 void PulseSource::DrawRemainGauge(Shader& colorShader) const
@@ -151,7 +148,6 @@ void PulseSource::DrawOutline(Shader& outlineShader) const
     int h = m_sprite->GetHeight();
     if (w <= 0 || h <= 0) return;
 
-    outlineShader.setVec2("texelSize", 1.0f / w, 1.0f / h);
     outlineShader.setVec4("outlineColor", 0.2f, 0.6f, 1.0f, 1.0f);
     outlineShader.setFloat("outlineWidthTexels", 2.0f);
 
@@ -160,7 +156,7 @@ void PulseSource::DrawOutline(Shader& outlineShader) const
         m_position.y + (0.5f - m_pivot.y) * m_size.y
     };
     Math::Matrix model = Math::Matrix::CreateTranslation(renderPos) * Math::Matrix::CreateScale(m_size);
-    m_sprite->Draw(outlineShader, model);
+    m_sprite->DrawOutline(outlineShader, model);
 }
 
 void PulseSource::Shutdown()
@@ -2,9 +2,11 @@
 
 #pragma once
 #include "../Engine/Vec2.hpp"
+#include <cstdint>
 #include <memory>
 
 class Shader;
+class RenderQueue;
 class Background;
 
 class PulseSource
@@ -26,7 +28,7 @@ public:
     void RefillStock();
 
     void Draw(Shader& shader) const;
-    void DrawSprite(Shader& textureShader) const;
+    void DrawSprite(RenderQueue& queue, uint8_t layer) const;
     void DrawOutline(Shader& outlineShader) const;
 
     void DrawRemainGauge(Shader& colorShader) const;
@@ -0,0 +1,49 @@
+//RenderLayers.hpp
+
+#pragma once
+#include <cstdint>
+
+/**
+ * RenderQueue layers for GameplayState's world passes, lowest drawn first.
+ * Inside a layer sprites are grouped by pipeline and texture (batch and custom passes, texture 0,
+ * sort first), so anything whose overlap order matters (a light over its background, a valve over
+ * its car) gets its own layer. Layers of interchangeable actors that overlap each other are
+ * marked ordered instead (RenderQueue::SetOrderedLayer): MapActor, TrainActor.
+ * Maps share layers because they never overlap each other on screen.
+ */
+namespace RenderLayer
+{
+    // DrawMainLayer
+    enum : uint8_t
+    {
+        Sky,
+        Rail,
+        MapBackground, // StaticLayerCache tiles: background, lights, hiding spots, obstacles, buttons
+        MapProp,       // pulse sources
+        MapPlatform,  // rooftop lift
+        MapActor,     // robots (ordered)
+        TrainCar,
+        TrainProp,    // car 5 valve
+        TrainActor,   // robots on the train (ordered)
+        TrainAlert,   // robot "!" markers (colour)
+        TrainPrompt,  // Enter / Leave / PulseLine / Start sprites
+        TrainEffect,  // siren waves, transport pulse lights (colour)
+        TrainWater    // valve water particles (instanced)
+    };
+
+    // DrawForegroundLayer (world space, above the post-processed scene)
+    enum : uint8_t
+    {
+        Outline,
+        Drone,
+        PulseGauge,   // charger remain bars + train progress gauges, behind the player
+        Afterimage,
+        Player,
+        PulseEffect,
+        Railing,      // hallway railing in front of the player
+        WorldPrompt,  // hiding-spot S icon
+        Radar,        // radars / drone and robot gauges (colour + debug shapes)
+        Detonation,
+        HudFrame
+    };
+}
@@ -3,19 +3,18 @@
 #include "Robot.hpp"
 #include "Player.hpp" 
 #include "../OpenGL/Shader.hpp"
+#include "../Engine/RenderQueue.hpp"
 #include "../Engine/Matrix.hpp"
 #include "../Engine/DebugRenderer.hpp"
 #include "../Engine/Collision.hpp"
 #include "../Engine/Logger.hpp"
+#include "../Engine/AssetCache.hpp"
+#include "../Engine/SimulationClock.hpp"
 #include "../OpenGL/GLWrapper.hpp"
 #include <random>
 #include <cmath>
 #include <algorithm>
 
-#pragma warning(push, 0)
-#include <stb_image.h>
-#pragma warning(pop)
-
 constexpr float ATTACK_DASH_SPEED = 800.0f;
 
 // Random number generation for robot behavior
@@ -24,40 +23,19 @@ static std::uniform_real_distribution<float> robot_dist(0.0f, 1.0f);
 
 unsigned int Robot::LoadTexture(const char* path)
 {
-    unsigned int textureID;
-    GL::GenTextures(1, &textureID);
-    GL::BindTexture(GL_TEXTURE_2D, textureID);
-
-    // Set texture wrapping/filtering options
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-    int width, height, nrChannels;
-    stbi_set_flip_vertically_on_load(true);
-    unsigned char* data = stbi_load(path, &width, &height, &nrChannels, 0);
-
-    if (data)
-    {
-        GLenum format = (nrChannels == 4) ? GL_RGBA : GL_RGB;
-        GL::TexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        GL::GenerateMipmap(GL_TEXTURE_2D);
-        stbi_image_free(data);
-        Logger::Instance().Log(Logger::Severity::Info, "Robot Texture Loaded: %s", path);
-    }
-    else
-    {
-        Logger::Instance().Log(Logger::Severity::Error, "Failed to load texture: %s", path);
-        stbi_image_free(data);
-    }
-    return textureID;
+    // All robots share the same three sprites through the cache.
+    AssetCache::TextureOptions options;
+    options.filter = AssetCache::Filter::Nearest;
+    options.async = true;
+    options.owner = "Robot";
+    return AssetCache::Instance().AcquireTexture(path, options).id;
 }
 
 void Robot::Init(Math::Vec2 startPos)
 {
     m_spawnPos = startPos;
     m_position = startPos;
+    m_prevPosition = startPos;
     m_spawnX = startPos.x;
     m_velocity = { 0.0f, 0.0f };
     m_hp = 100.0f;
@@ -138,6 +116,8 @@ void Robot::ApplyTrainBerserkerProfile()
 
 void Robot::Update(double dt, Player& player, const std::vector<ObstacleInfo>& obstacles, float mapMinX, float mapMaxX)
 {
+    m_prevPosition = m_position;
+    m_prevTickedFrame = SimulationClock::Instance().GetTickedFrame();
     if (m_state == RobotState::Dead) return;
 
     float fDt = static_cast<float>(dt);
@@ -417,18 +397,14 @@ void Robot::DecideAttackPattern()
     m_lastAttack = nextAttack;
 }
 
-void Robot::Draw(const Shader& shader) const
+void Robot::Draw(RenderQueue& queue, uint8_t layer) const
 {
     if (m_state == RobotState::Dead) return;
 
-    shader.use();
-
     bool flipX = (m_directionX > 0.0f);
 
-    Math::Matrix model = Math::Matrix::CreateTranslation(m_position) * Math::Matrix::CreateScale(m_size);
-    shader.setMat4("model", model);
-    shader.setBool("flipX", flipX);
-    shader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
+    const Math::Vec2 drawPos = SimulationClock::Instance().Interpolate(m_prevPosition, m_position, m_prevTickedFrame);
+    Math::Matrix model = Math::Matrix::CreateTranslation(drawPos) * Math::Matrix::CreateScale(m_size);
 
     unsigned int textureToBind = m_textureID;
 
@@ -446,45 +422,32 @@ void Robot::Draw(const Shader& shader) const
         }
     }
 
-    GL::ActiveTexture(GL_TEXTURE0);
-    GL::BindTexture(GL_TEXTURE_2D, textureToBind);
-
-    GL::BindVertexArray(m_VAO);
-    GL::DrawArrays(GL_TRIANGLES, 0, 6);
-    GL::BindVertexArray(0);
+    queue.SubmitSprite(layer, textureToBind, model, {}, flipX);
 }
 
 void Robot::DrawOutline(const Shader& outlineShader) const
 {
     if (m_state == RobotState::Dead) return;
 
+    unsigned int textureToBind = m_textureID;
+    if (m_state == RobotState::Attack)
+    {
+        if (m_currentAttack == AttackType::HighSweep) textureToBind = m_textureHighID;
+        else if (m_currentAttack == AttackType::LowSweep) textureToBind = m_textureLowID;
+    }
+    if (!AssetCache::Instance().BindOutlineField(textureToBind)) return;
+
     outlineShader.use();
 
     bool flipX = (m_directionX > 0.0f);
-    Math::Matrix model = Math::Matrix::CreateTranslation(m_position) * Math::Matrix::CreateScale(m_size);
+    const Math::Vec2 drawPos = SimulationClock::Instance().Interpolate(m_prevPosition, m_position, m_prevTickedFrame);
+    Math::Matrix model = Math::Matrix::CreateTranslation(drawPos) * Math::Matrix::CreateScale(m_size);
     outlineShader.setMat4("model", model);
     outlineShader.setBool("flipX", flipX);
     outlineShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
     outlineShader.setVec4("outlineColor", 0.2f, 0.6f, 1.0f, 1.0f);
     outlineShader.setFloat("outlineWidthTexels", 2.0f);
 
-    unsigned int textureToBind = m_textureID;
-    if (m_state == RobotState::Attack)
-    {
-        if (m_currentAttack == AttackType::HighSweep) textureToBind = m_textureHighID;
-        else if (m_currentAttack == AttackType::LowSweep) textureToBind = m_textureLowID;
-    }
-
-    // Robot textures are single-frame sprites.
-    int texW = 396;
-    int texH = 450;
-    if (textureToBind == m_textureHighID || textureToBind == m_textureLowID)
-    {
-        texW = 590;
-        texH = 450;
-    }
-    outlineShader.setVec2("texelSize", 1.0f / static_cast<float>(texW), 1.0f / static_cast<float>(texH));
-
     GL::ActiveTexture(GL_TEXTURE0);
     GL::BindTexture(GL_TEXTURE_2D, textureToBind);
     GL::BindVertexArray(m_VAO);
@@ -665,9 +628,10 @@ void Robot::Shutdown()
     // Cleanup OpenGL resources
     GL::DeleteVertexArrays(1, &m_VAO);
     GL::DeleteBuffers(1, &m_VBO);
-    GL::DeleteTextures(1, &m_textureID);
-    GL::DeleteTextures(1, &m_textureHighID);
-    GL::DeleteTextures(1, &m_textureLowID);
+    AssetCache::Instance().ReleaseTexture(m_textureID);
+    AssetCache::Instance().ReleaseTexture(m_textureHighID);
+    AssetCache::Instance().ReleaseTexture(m_textureLowID);
+    m_textureID = m_textureHighID = m_textureLowID = 0;
     
     m_soundHigh.Stop();
     m_soundLow.Stop();
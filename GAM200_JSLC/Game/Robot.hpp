@@ -3,9 +3,11 @@
 #pragma once
 #include "../Engine/Vec2.hpp"
 #include "../Engine/Sound.hpp"
+#include <cstdint>
 #include <vector>
 
 class Shader;
+class RenderQueue;
 class DebugRenderer;
 class Player;
 
@@ -45,7 +47,7 @@ public:
     /// Q 펄스: 넉백 + HP (드론 주입과 비슷한 느낌)
     void ApplyPulseImpact(Math::Vec2 impulse, float damage);
     void Update(double dt, Player& player, const std::vector<ObstacleInfo>& obstacles, float mapMinX, float mapMaxX);
-    void Draw(const Shader& shader) const;
+    void Draw(RenderQueue& queue, uint8_t layer) const;
     void DrawOutline(const Shader& outlineShader) const;
     void DrawGauge(Shader& colorShader, DebugRenderer& debugRenderer) const;
     void DrawAlert(Shader& colorShader, DebugRenderer& debugRenderer) const;
@@ -111,6 +113,8 @@ private:
     unsigned int m_VBO = 0;
 
     Math::Vec2 m_position;
+    Math::Vec2 m_prevPosition; // position at the start of the last fixed tick (render interpolation)
+    long long m_prevTickedFrame = -1; // SimulationClock::GetTickedFrame() when m_prevPosition was stored
     Math::Vec2 m_size;
     Math::Vec2 m_velocity;
 
@@ -4,12 +4,14 @@
 #include "Background.hpp"
 #include "Player.hpp"
 #include "MapObjectConfig.hpp"
+#include "RenderLayers.hpp"
 #include "../Game/PulseCore.hpp"
 #include "../OpenGL/Shader.hpp"
 #include "../Engine/Matrix.hpp"
 
 #include "../Engine/Logger.hpp"
 #include "../Engine/DebugRenderer.hpp"
+#include "../Engine/RenderQueue.hpp"
 #include <algorithm>
 #include <cmath>
 
@@ -72,6 +74,7 @@ void Rooftop::Initialize()
 
     m_isClose = false;
     m_isPlayerClose = false;
+    RebuildStaticLayer();
 }
 
 void Rooftop::ApplyConfig(const RooftopObjectConfig& cfg)
@@ -107,6 +110,22 @@ void Rooftop::ApplyConfig(const RooftopObjectConfig& cfg)
     if (h <= 0.0f) h = (cfg.liftButton.fallbackSize.y > 0.0f ? cfg.liftButton.fallbackSize.y : 96.0f);
     m_liftButtonSize = { w, h };
     m_liftButtonPos = { cfg.liftButton.topLeft.x + w * 0.5f, cfg.liftButton.topLeft.y - h * 0.5f };
+
+    RebuildStaticLayer();
+}
+
+void Rooftop::RebuildStaticLayer()
+{
+    const Math::Matrix model = Math::Matrix::CreateTranslation(m_position) * Math::Matrix::CreateScale(m_size);
+    m_staticLayer.Clear();
+    m_staticLayer.Add(m_isClose ? m_closeBackground.get() : m_background.get(), model);
+    m_staticLayer.Add(m_light.get(), model);
+
+    // Hole sprite: only until the player fills it with pulse and closes it.
+    if (!m_isClose && m_holeSprite)
+        m_staticLayer.Add(m_holeSprite.get(), Math::Matrix::CreateTranslation(m_debugBoxPos) * Math::Matrix::CreateScale(m_debugBoxSize));
+    if (m_liftButtonSprite)
+        m_staticLayer.Add(m_liftButtonSprite.get(), Math::Matrix::CreateTranslation(m_liftButtonPos) * Math::Matrix::CreateScale(m_liftButtonSize));
 }
 
 void Rooftop::SyncGroundLevelForPlayer(Player& player, Math::Vec2 playerHitboxSize)
@@ -233,6 +252,7 @@ void Rooftop::Update(double dt, Player& player, Math::Vec2 playerHitboxSize, Inp
             {
                 pulse.spend(INTERACT_COST);
                 m_isClose = true;
+                RebuildStaticLayer();
             }
         }
     }
@@ -610,53 +630,25 @@ void Rooftop::Update(double dt, Player& player, Math::Vec2 playerHitboxSize, Inp
     m_hasPrevPlayerX = true;
 }
 
-void Rooftop::Draw(Shader& shader) const
+void Rooftop::Draw(RenderQueue& queue) const
 {
-    // Render current background (dark or closed-hole version)
-    Math::Matrix model = Math::Matrix::CreateTranslation(m_position) * Math::Matrix::CreateScale(m_size);
-    shader.setMat4("model", model);
-
-    if (m_isClose)
-    {
-        m_closeBackground->Draw(shader, model);
-        m_light->Draw(shader, model);
-    }
-    else
-    {
-        m_background->Draw(shader, model);
-        m_light->Draw(shader, model);
-    }
-
-    // Hole sprite: m_isClose(true) once player fills pulse and closes hole.
-    // Collision/hitbox uses same center/size (m_debugBoxPos/m_debugBoxSize).
-    if (!m_isClose && m_holeSprite)
-    {
-        Math::Matrix holeModel = Math::Matrix::CreateTranslation(m_debugBoxPos) * Math::Matrix::CreateScale(m_debugBoxSize);
-        shader.setMat4("model", holeModel);
-        m_holeSprite->Draw(shader, holeModel);
-    }
-
-    if (m_liftButtonSprite)
-    {
-        Math::Matrix buttonModel = Math::Matrix::CreateTranslation(m_liftButtonPos) * Math::Matrix::CreateScale(m_liftButtonSize);
-        shader.setMat4("model", buttonModel);
-        m_liftButtonSprite->Draw(shader, buttonModel);
-    }
+    // Current background (dark or closed-hole version), light, hole and lift button (pre-composited).
+    // Collision/hitbox for the hole uses the same center/size (m_debugBoxPos/m_debugBoxSize).
+    m_staticLayer.Draw(queue, RenderLayer::MapBackground);
 
     for (const auto& source : m_pulseSources)
     {
-        source.DrawSprite(shader);
+        source.DrawSprite(queue, RenderLayer::MapProp);
     }
 
     // Render the lift platform
     Math::Matrix liftModel = Math::Matrix::CreateTranslation(m_liftPos) * Math::Matrix::CreateScale(m_liftSize);
-    shader.setMat4("model", liftModel);
-    m_lift->Draw(shader, liftModel);
+    m_lift->Draw(queue, RenderLayer::MapPlatform, liftModel);
 }
 
-void Rooftop::DrawDrones(Shader& shader) const
+void Rooftop::DrawDrones(SpriteInstancer& instancer) const
 {
-    m_droneManager->Draw(shader);
+    m_droneManager->Draw(instancer);
 }
 
 void Rooftop::DrawRadars(const Shader& colorShader, DebugRenderer& debugRenderer) const
@@ -673,6 +665,7 @@ void Rooftop::DrawGauges(Shader& colorShader, DebugRenderer& debugRenderer) cons
 
 void Rooftop::Shutdown()
 {
+    m_staticLayer.Shutdown();
     // Cleanup allocated resources
     if (m_background)
     {
@@ -765,13 +758,12 @@ void Rooftop::DrawSpriteOutlines(Shader& outlineShader, Math::Vec2 playerPos, fl
             int h = m_holeSprite->GetHeight();
             if (w > 0 && h > 0)
             {
-                outlineShader.setVec2("texelSize", 1.0f / w, 1.0f / h);
                 outlineShader.setVec4("outlineColor", 0.2f, 0.6f, 1.0f, 1.0f);
                 outlineShader.setFloat("outlineWidthTexels", 2.0f);
 
                 Math::Matrix holeModel = Math::Matrix::CreateTranslation(m_debugBoxPos) * Math::Matrix::CreateScale(m_debugBoxSize);
                 outlineShader.setMat4("model", holeModel);
-                m_holeSprite->Draw(outlineShader, holeModel);
+                m_holeSprite->DrawOutline(outlineShader, holeModel);
             }
         }
     }
@@ -793,13 +785,12 @@ void Rooftop::DrawSpriteOutlines(Shader& outlineShader, Math::Vec2 playerPos, fl
             int h = m_liftButtonSprite->GetHeight();
             if (w > 0 && h > 0)
             {
-                outlineShader.setVec2("texelSize", 1.0f / w, 1.0f / h);
                 outlineShader.setVec4("outlineColor", 0.2f, 0.6f, 1.0f, 1.0f);
                 outlineShader.setFloat("outlineWidthTexels", 2.0f);
 
                 Math::Matrix buttonModel = Math::Matrix::CreateTranslation(m_liftButtonPos) * Math::Matrix::CreateScale(m_liftButtonSize);
                 outlineShader.setMat4("model", buttonModel);
-                m_liftButtonSprite->Draw(outlineShader, buttonModel);
+                m_liftButtonSprite->DrawOutline(outlineShader, buttonModel);
             }
         }
     }
@@ -822,13 +813,12 @@ void Rooftop::DrawSpriteOutlines(Shader& outlineShader, Math::Vec2 playerPos, fl
             int h = m_lift->GetHeight();
             if (w > 0 && h > 0)
             {
-                outlineShader.setVec2("texelSize", 1.0f / w, 1.0f / h);
                 outlineShader.setVec4("outlineColor", 0.2f, 0.6f, 1.0f, 1.0f);
                 outlineShader.setFloat("outlineWidthTexels", 2.0f);
 
                 Math::Matrix liftModel = Math::Matrix::CreateTranslation(m_liftPos) * Math::Matrix::CreateScale(m_liftSize);
                 outlineShader.setMat4("model", liftModel);
-                m_lift->Draw(outlineShader, liftModel);
+                m_lift->DrawOutline(outlineShader, liftModel);
             }
         }
     }
@@ -4,6 +4,7 @@
 #include "Background.hpp"
 #include "PulseSource.hpp"
 #include "DroneManager.hpp"
+#include "StaticLayerCache.hpp"
 #include "../Engine/Vec2.hpp"
 #include "../Engine/Input.hpp" 
 #include <memory>
@@ -11,6 +12,8 @@
 #include <string>
 
 class Shader;
+class RenderQueue;
+class SpriteInstancer;
 class Player;
 class DebugRenderer;
 struct RooftopObjectConfig;
@@ -42,8 +45,8 @@ public:
     void SyncGroundLevelForPlayer(Player& player, Math::Vec2 playerHitboxSize);
     void Update(double dt, Player& player, Math::Vec2 playerHitboxSize, Input::Input& input,
                 Math::Vec2 mouseWorldPos, bool isLeftClickTriggered);
-    void Draw(Shader& shader) const;
-    void DrawDrones(Shader& shader) const;
+    void Draw(RenderQueue& queue) const;
+    void DrawDrones(SpriteInstancer& instancer) const;
     void DrawRadars(const Shader& colorShader, DebugRenderer& debugRenderer) const;
     void DrawGauges(Shader& colorShader, DebugRenderer& debugRenderer) const;
     void Shutdown();
@@ -79,6 +82,9 @@ private:
         AtDestination   // Movement complete
     };
 
+    /// Background (open or closed), light, hole and lift button; re-listed when the hole closes.
+    void RebuildStaticLayer();
+
     std::unique_ptr<Background> m_background;
     std::unique_ptr<Background> m_light;
     std::unique_ptr<Background> m_closeBackground; // Visual state for when the rooftop hole is closed
@@ -87,6 +93,7 @@ private:
     std::unique_ptr<Background> m_liftButtonSprite;
     Math::Vec2 m_liftButtonPos{};
     Math::Vec2 m_liftButtonSize{};
+    mutable StaticLayerCache m_staticLayer; // tiles are baked lazily from Draw
 
     // Lift transformation and state variables
     Math::Vec2 m_liftPos;
@@ -6,9 +6,11 @@
 #include "../OpenGL/Shader.hpp"
 #include "Player.hpp"
 #include "../Engine/DebugRenderer.hpp"
+#include "../Engine/RenderQueue.hpp"
 #include "../Engine/Collision.hpp"
 #include "../Game/PulseCore.hpp"
 #include "MapObjectConfig.hpp"
+#include "RenderLayers.hpp"
 
 // Level design constants
 constexpr float ROOM_WIDTH = 1620.0f;
@@ -124,23 +126,22 @@ bool Room::ConsumeBlindInteractDenied()
     return v;
 }
 
-void Room::Draw(Shader& textureShader) const
+void Room::Draw(RenderQueue& queue) const
 {
     Math::Vec2 screenSize = { GAME_WIDTH, GAME_HEIGHT };
     Math::Vec2 screenCenter = screenSize * 0.5f;
     
     // Background fills the entire logical game area
     Math::Matrix bg_model = Math::Matrix::CreateTranslation(screenCenter) * Math::Matrix::CreateScale(screenSize);
-    textureShader.setMat4("model", bg_model);
 
     // Render appropriate background based on blind state
     if (m_isBright)
     {
-        m_brightBackground->Draw(textureShader, bg_model);
+        m_brightBackground->Draw(queue, RenderLayer::MapBackground, bg_model);
     }
     else
     {
-        m_background->Draw(textureShader, bg_model);
+        m_background->Draw(queue, RenderLayer::MapBackground, bg_model);
     }
 }
 
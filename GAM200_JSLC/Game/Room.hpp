@@ -10,6 +10,7 @@
 
 class Engine;
 class Shader;
+class RenderQueue;
 class Player;
 class DebugRenderer;
 class ControlBindings;
@@ -27,7 +28,7 @@ public:
     void ApplyConfig(const RoomObjectConfig& cfg);
     void Shutdown();
     void Update(Player& player, double dt, Input::Input& input, Math::Vec2 mouseWorldPos, const ControlBindings& controls);
-    void Draw(Shader& textureShader) const;
+    void Draw(RenderQueue& queue) const;
     
     Math::Vec2 GetBlindPos() const { return m_blindPos; }
     Math::Vec2 GetBlindSize() const { return m_blindSize; }
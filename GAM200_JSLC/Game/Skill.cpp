@@ -8,6 +8,7 @@
 #include "PulseCore.hpp"
 #include "Train.hpp"
 #include "Underground.hpp"
+#include "Font.hpp"
 #include "../Engine/ControlBindings.hpp"
 #include "../Engine/Logger.hpp"
 #include <sstream>
@@ -129,25 +130,25 @@ void PulseDetonateSkill::Update(
 
 // ── UI text ──────────────────────────────────────────────────────────────────
 
-void PulseDetonateSkill::UpdateCooldownText(Font& font, Shader& fontShader)
+void PulseDetonateSkill::UpdateCooldownText()
 {
     if (m_unlocked && m_cooldown > 0.f)
     {
         std::stringstream ss;
         ss.precision(1);
         ss << std::fixed << "[Q] " << m_cooldown << "s";
-        m_cooldownText = font.PrintToTexture(fontShader, ss.str());
+        m_cooldownText = ss.str();
     }
     else
     {
-        m_cooldownText = {};
+        m_cooldownText.clear();
     }
 }
 
-void PulseDetonateSkill::DrawCooldownUI(Font& font, Shader& fontShader, float screenY) const
+void PulseDetonateSkill::DrawCooldownUI(const Font& font, SpriteBatch& batch, float screenY) const
 {
-    if (m_unlocked && m_cooldownText.textureID != 0)
-        font.DrawBakedText(fontShader, m_cooldownText, { 20.f, screenY }, 32.0f);
+    if (m_unlocked && !m_cooldownText.empty())
+        font.DrawText(batch, m_cooldownText, { 20.f, screenY }, 32.0f);
 }
 
 // ── Reset ────────────────────────────────────────────────────────────────────
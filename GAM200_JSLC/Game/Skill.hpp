@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include "Font.hpp"            // CachedTextureInfo
+#include <string>
 #include "../Engine/Vec2.hpp"  // Math::Vec2
 #include <utility>
 #include <vector>
@@ -14,6 +14,8 @@ class PulseManager;
 class Train;
 class Underground;
 class Shader;
+class Font;
+class SpriteBatch;
 class ControlBindings;
 namespace Input { class Input; }
 
@@ -45,23 +47,23 @@ public:
                 Train* trainMapForBranchArcs = nullptr,
                 Underground* undergroundForPulseRobots = nullptr);
 
-    // Bake the cooldown string into a GL texture — call during the text-update phase.
-    void UpdateCooldownText(Font& font, Shader& fontShader);
+    // Format the cooldown string — call during the text-update phase.
+    void UpdateCooldownText();
 
-    // Draw the cooldown label at (20, screenY) — call inside Draw() after font shader is bound.
-    void DrawCooldownUI(Font& font, Shader& fontShader, float screenY) const;
+    // Queue the cooldown label at (20, screenY) as glyph quads — call between batch Begin/End.
+    void DrawCooldownUI(const Font& font, SpriteBatch& batch, float screenY) const;
 
     // Reset cooldown to 0 on player respawn (unlock state persists).
     void ResetCooldown();
 
     bool  IsUnlocked() const { return m_unlocked; }
     float GetCooldown() const { return m_cooldown; }
-    const CachedTextureInfo& GetCooldownText() const { return m_cooldownText; }
+    const std::string& GetCooldownText() const { return m_cooldownText; }
 
 private:
     bool  m_unlocked  = false;
     float m_cooldown  = 0.f;
-    CachedTextureInfo m_cooldownText{};
+    std::string m_cooldownText;
 
     static constexpr float SKILL_COST     = 8.f;
     static constexpr float SKILL_RADIUS   = 535.f * 0.7f;
@@ -7,12 +7,9 @@
 #include "../OpenGL/Shader.hpp"
 #include "../Engine/Matrix.hpp"
 #include "../Engine/Logger.hpp"
+#include "../Engine/AssetCache.hpp"
 #include "../OpenGL/GLWrapper.hpp"
 
-#pragma warning(push, 0)
-#include <stb_image.h>
-#pragma warning(pop)
-
 #include <cmath>
 #include <algorithm>
 
@@ -73,31 +70,13 @@ void SplashState::Initialize()
     // ── Texture loader helper ─────────────────────────────────────────────
     auto loadTex = [&](const char* path, unsigned int& id, int& w, int& h)
     {
-        GL::GenTextures(1, &id);
-        GL::BindTexture(GL_TEXTURE_2D, id);
-        GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        int ch = 0;
-        stbi_set_flip_vertically_on_load(true);
-        unsigned char* d = stbi_load(path, &w, &h, &ch, 0);
-        if (d)
-        {
-            GLenum fmt = (ch == 4) ? GL_RGBA : GL_RGB;
-            GL::TexImage2D(GL_TEXTURE_2D, 0, fmt, w, h, 0, fmt, GL_UNSIGNED_BYTE, d);
-            GL::GenerateMipmap(GL_TEXTURE_2D);
-            stbi_image_free(d);
-        }
-        else
-        {
-            Logger::Instance().Log(Logger::Severity::Error,
-                "SplashState: failed to load texture");
-            w = h = 1;
-            unsigned char white[] = { 255, 255, 255, 255 };
-            GL::TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
-        }
-        GL::BindTexture(GL_TEXTURE_2D, 0);
+        AssetCache::TextureOptions options;
+        options.whiteFallback = true;
+        options.owner = "Splash";
+        const AssetCache::Texture texture = AssetCache::Instance().AcquireTexture(path, options);
+        id = texture.id;
+        w = texture.width;
+        h = texture.height;
     };
 
     loadTex("Asset/DigiPen.png",        m_texID,       m_texW,       m_texH);
@@ -105,6 +84,32 @@ void SplashState::Initialize()
     loadTex("Asset/Robot.png",          m_robotTexID,  m_robotTexW,  m_robotTexH);
     loadTex("Asset/Drone.png",          m_droneTexID,  m_droneTexW,  m_droneTexH);
 
+    // ── Gameplay warm-up ──────────────────────────────────────────────────
+    // Decoded on loader threads while the logo plays; GameplayState picks them up as cache hits.
+    // Options must match the owners' (Background / Player / Drone) or the keys differ.
+    {
+        AssetCache& cache = AssetCache::Instance();
+        // Owners are set too, so TextureTracker charges the warm-up to the subsystem that will use it.
+        AssetCache::TextureOptions sprite;
+        sprite.owner = "Background";
+        for (const char* path : { "Asset/Room.png", "Asset/Room_Bright.png", "Asset/Hallway.png", "Asset/Railing.png",
+                                  "Asset/Hallway_pulsesource.png", "Asset/HidingSpot.png", "Asset/Hud.png",
+                                  "Asset/Conversion.png", "Asset/S.png" })
+            cache.PreloadTexture(path, sprite);
+
+        AssetCache::TextureOptions player;
+        player.filter = AssetCache::Filter::Nearest;
+        player.owner = "Player";
+        for (const char* path : { "Asset/Player_Idle.png", "Asset/Player_Walking.png", "Asset/Player_Crouch.png" })
+            cache.PreloadTexture(path, player);
+
+        AssetCache::TextureOptions drone;
+        drone.filter = AssetCache::Filter::LinearMipmap;
+        drone.repeat = true;
+        drone.owner = "Drone";
+        cache.PreloadTexture("Asset/Drone.png", drone);
+    }
+
     // ── Audio ─────────────────────────────────────────────────────────────
     m_logoSound.Load("Asset/DigiPen.mp3");
     m_logoSound.Play();
@@ -360,10 +365,11 @@ void SplashState::Shutdown()
 
     if (m_VAO)         { GL::DeleteVertexArrays(1, &m_VAO);        m_VAO         = 0; }
     if (m_VBO)         { GL::DeleteBuffers(1, &m_VBO);             m_VBO         = 0; }
-    if (m_texID)       { GL::DeleteTextures(1, &m_texID);          m_texID       = 0; }
-    if (m_playerTexID) { GL::DeleteTextures(1, &m_playerTexID);    m_playerTexID = 0; }
-    if (m_robotTexID)  { GL::DeleteTextures(1, &m_robotTexID);     m_robotTexID  = 0; }
-    if (m_droneTexID)  { GL::DeleteTextures(1, &m_droneTexID);     m_droneTexID  = 0; }
+    AssetCache& cache = AssetCache::Instance();
+    if (m_texID)       { cache.ReleaseTexture(m_texID);          m_texID       = 0; }
+    if (m_playerTexID) { cache.ReleaseTexture(m_playerTexID);    m_playerTexID = 0; }
+    if (m_robotTexID)  { cache.ReleaseTexture(m_robotTexID);     m_robotTexID  = 0; }
+    if (m_droneTexID)  { cache.ReleaseTexture(m_droneTexID);     m_droneTexID  = 0; }
 
     m_splashShader.reset();
     m_silhouetteShader.reset();
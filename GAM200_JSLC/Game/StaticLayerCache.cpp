@@ -0,0 +1,351 @@
+//StaticLayerCache.cpp
+
+#include "StaticLayerCache.hpp"
+#include "Background.hpp"
+#include "../Engine/AssetCache.hpp"
+#include "../Engine/Logger.hpp"
+#include "../Engine/RenderQueue.hpp"
+#include "../Engine/TextureTracker.hpp"
+#include "../Engine/SpriteBatch.hpp"
+#include "../OpenGL/GLWrapper.hpp"
+#include "../OpenGL/Shader.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace
+{
+    // Texels baked past each tile edge, so bilinear taps at the seams read the neighbour's pixels
+    // instead of clamping to the tile's own border.
+    constexpr int GUTTER = 1;
+
+    // One bake shader / quad / framebuffer for every cache; created with the first bake.
+    struct SharedTarget
+    {
+        std::unique_ptr<Shader> shader;
+        unsigned int quadVAO = 0;
+        unsigned int quadVBO = 0;
+        unsigned int fbo = 0;
+        int users = 0;
+    };
+
+    SharedTarget& Shared()
+    {
+        static SharedTarget shared;
+        return shared;
+    }
+
+    void CreateShared(SharedTarget& shared)
+    {
+        shared.shader = std::make_unique<Shader>("OpenGL/Shaders/simple.vert", "OpenGL/Shaders/simple.frag");
+        shared.shader->use();
+        shared.shader->setInt("ourTexture", 0);
+        shared.shader->setBool("flipX", false);
+        shared.shader->setFloat("alpha", 1.0f);
+        shared.shader->setFloat("tintStrength", 0.0f);
+
+        float vertices[] = {
+            -0.5f,  0.5f,   0.0f, 1.0f,
+             0.5f, -0.5f,   1.0f, 0.0f,
+            -0.5f, -0.5f,   0.0f, 0.0f,
+
+            -0.5f,  0.5f,   0.0f, 1.0f,
+             0.5f,  0.5f,   1.0f, 1.0f,
+             0.5f, -0.5f,   1.0f, 0.0f
+        };
+        GL::GenVertexArrays(1, &shared.quadVAO);
+        GL::GenBuffers(1, &shared.quadVBO);
+        GL::BindVertexArray(shared.quadVAO);
+        GL::BindBuffer(GL_ARRAY_BUFFER, shared.quadVBO);
+        GL::BufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        GL::VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+        GL::EnableVertexAttribArray(0);
+        GL::VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+        GL::EnableVertexAttribArray(1);
+        GL::BindVertexArray(0);
+
+        GL::GenFramebuffers(1, &shared.fbo);
+    }
+
+    void DestroyShared(SharedTarget& shared)
+    {
+        GL::DeleteVertexArrays(1, &shared.quadVAO);
+        GL::DeleteBuffers(1, &shared.quadVBO);
+        GL::DeleteFramebuffers(1, &shared.fbo);
+        shared.quadVAO = 0;
+        shared.quadVBO = 0;
+        shared.fbo = 0;
+        shared.shader.reset();
+    }
+
+    bool Overlaps(const Math::Rect& a, const Math::Rect& b)
+    {
+        return a.bottom_left.x < b.top_right.x && b.bottom_left.x < a.top_right.x
+            && a.bottom_left.y < b.top_right.y && b.bottom_left.y < a.top_right.y;
+    }
+
+    Math::Rect Offset(const Math::Rect& rect, Math::Vec2 offset)
+    {
+        return { rect.bottom_left + offset, rect.top_right + offset };
+    }
+}
+
+void StaticLayerCache::Clear()
+{
+    ReleaseTiles();
+    m_sources.clear();
+    m_bounds = {};
+    m_dirty = true;
+    m_bypass = false;
+}
+
+void StaticLayerCache::Add(const Background* source, const Math::Matrix& model)
+{
+    if (!source)
+        return;
+
+    Source entry;
+    entry.sprite = source;
+    entry.model = model;
+    const Math::Vec2 a = model.TransformPoint({ -0.5f, -0.5f });
+    const Math::Vec2 b = model.TransformPoint({ 0.5f, 0.5f });
+    entry.bounds.bottom_left = { std::min(a.x, b.x), std::min(a.y, b.y) };
+    entry.bounds.top_right = { std::max(a.x, b.x), std::max(a.y, b.y) };
+
+    // Whole-texel bounds keep the 1:1 art on texel centres inside the tiles.
+    const Math::Vec2 low = { std::floor(entry.bounds.bottom_left.x), std::floor(entry.bounds.bottom_left.y) };
+    const Math::Vec2 high = { std::ceil(entry.bounds.top_right.x), std::ceil(entry.bounds.top_right.y) };
+    if (m_sources.empty())
+    {
+        m_bounds = { low, high };
+    }
+    else
+    {
+        m_bounds.bottom_left = { std::min(m_bounds.bottom_left.x, low.x), std::min(m_bounds.bottom_left.y, low.y) };
+        m_bounds.top_right = { std::max(m_bounds.top_right.x, high.x), std::max(m_bounds.top_right.y, high.y) };
+    }
+
+    m_sources.push_back(entry);
+    m_dirty = true;
+}
+
+void StaticLayerCache::Draw(RenderQueue& queue, uint8_t layer, Math::Vec2 offset)
+{
+    if (m_sources.empty())
+        return;
+
+    const AssetCache& assets = AssetCache::Instance();
+    bool streamedOut = false;
+    bool loading = false;
+    for (const Source& source : m_sources)
+    {
+        const unsigned int textureID = source.sprite->GetTextureID();
+        if (textureID != source.bakedTexture)
+            m_dirty = true; // re-acquired after a stream-out: new id, new pixels
+        if (textureID == 0)
+            streamedOut = true;
+        else if (assets.IsPending(textureID))
+            loading = true;
+    }
+
+    if (streamedOut)
+        ReleaseTiles(); // the zone is far away; don't keep its composite alive either
+
+    if (streamedOut || loading || m_bypass)
+    {
+        // Baking now would capture the 1x1 placeholders; draw the layers as before until they land.
+        queue.SubmitBatch(layer, [this, offset](SpriteBatch& batch)
+        {
+            const Math::Matrix translation = Math::Matrix::CreateTranslation(offset);
+            for (const Source& source : m_sources)
+                source.sprite->Draw(batch, translation * source.model);
+        });
+        return;
+    }
+
+    const Math::Rect* cull = queue.GetCullRect();
+    if (cull && !Overlaps(Offset(m_bounds, offset), *cull))
+        return; // off screen: not even a pending bake is worth doing yet
+
+    const bool hasView = cull != nullptr;
+    const Math::Rect view = hasView ? *cull : Math::Rect{};
+    queue.SubmitCustom(layer, [this, offset, hasView, view](const Math::Matrix& projection)
+    {
+        if (m_dirty)
+            Rebuild();
+        DrawTiles(projection, offset, hasView ? &view : nullptr);
+    });
+}
+
+void StaticLayerCache::Rebuild()
+{
+    ReleaseTiles();
+    m_dirty = false;
+
+    SharedTarget& shared = Shared();
+    if (!m_sharedRef)
+    {
+        if (shared.users++ == 0)
+            CreateShared(shared);
+        m_sharedRef = true;
+    }
+
+    const int boundsW = static_cast<int>(m_bounds.top_right.x - m_bounds.bottom_left.x);
+    const int boundsH = static_cast<int>(m_bounds.top_right.y - m_bounds.bottom_left.y);
+    if (boundsW <= 0 || boundsH <= 0)
+        return;
+
+    // Split evenly rather than leaving a sliver row (1080 -> 2 x 540, not 1024 + 56).
+    const int columns = (boundsW + MAX_TILE_SIZE - 1) / MAX_TILE_SIZE;
+    const int rows = (boundsH + MAX_TILE_SIZE - 1) / MAX_TILE_SIZE;
+    const int tileW = (boundsW + columns - 1) / columns;
+    const int tileH = (boundsH + rows - 1) / rows;
+
+    // Runs inside the scene pass: put the caller's target and viewport back afterwards.
+    GLint previousFramebuffer = 0;
+    GLint previousViewport[4] = { 0, 0, 0, 0 };
+    GL::GetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    GL::GetIntegerv(GL_VIEWPORT, previousViewport);
+
+    Shader& shader = *shared.shader;
+    shader.use();
+    shader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
+
+    // Straight-alpha sources over a premultiplied target: colour is weighted by source alpha,
+    // coverage accumulates as plain "over".
+    GL::Enable(GL_BLEND);
+    GL::BlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    GL::ActiveTexture(GL_TEXTURE0);
+    GL::BindVertexArray(shared.quadVAO);
+    GL::BindFramebuffer(GL_FRAMEBUFFER, shared.fbo);
+
+    bool complete = true;
+    for (int row = 0; row < rows && complete; ++row)
+    {
+        for (int column = 0; column < columns; ++column)
+        {
+            Tile tile;
+            tile.rect.bottom_left = m_bounds.bottom_left
+                + Math::Vec2{ static_cast<float>(column * tileW), static_cast<float>(row * tileH) };
+            tile.rect.top_right = {
+                std::min(tile.rect.bottom_left.x + static_cast<float>(tileW), m_bounds.top_right.x),
+                std::min(tile.rect.bottom_left.y + static_cast<float>(tileH), m_bounds.top_right.y) };
+            tile.width = static_cast<int>(tile.rect.top_right.x - tile.rect.bottom_left.x) + 2 * GUTTER;
+            tile.height = static_cast<int>(tile.rect.top_right.y - tile.rect.bottom_left.y) + 2 * GUTTER;
+
+            GL::GenTextures(1, &tile.texture);
+            GL::BindTexture(GL_TEXTURE_2D, tile.texture);
+            GL::TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tile.width, tile.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            TextureTracker::Instance().Track(tile.texture, 0, tile.width, tile.height, GL_RGBA, "StaticLayer");
+            GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            GL::FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tile.texture, 0);
+            if (GL::CheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            {
+                Logger::Instance().Log(Logger::Severity::Error,
+                    "StaticLayerCache: %dx%d tile framebuffer incomplete, drawing layers uncached", tile.width, tile.height);
+                GL::DeleteTextures(1, &tile.texture);
+                TextureTracker::Instance().Untrack(tile.texture);
+                complete = false;
+                break;
+            }
+            m_tiles.push_back(tile);
+            ++s_stats.tiles;
+            s_stats.residentBytes += static_cast<size_t>(tile.width) * static_cast<size_t>(tile.height) * 4;
+
+            GL::Viewport(0, 0, tile.width, tile.height);
+            GL::ClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+            GL::Clear(GL_COLOR_BUFFER_BIT);
+
+            const float gutter = static_cast<float>(GUTTER);
+            const Math::Rect baked = { tile.rect.bottom_left - Math::Vec2{ gutter, gutter },
+                                       tile.rect.top_right + Math::Vec2{ gutter, gutter } };
+            shader.setMat4("projection", Math::Matrix::CreateOrtho(baked.bottom_left.x, baked.top_right.x,
+                                                                   baked.bottom_left.y, baked.top_right.y, -1.0f, 1.0f));
+            for (Source& source : m_sources)
+            {
+                source.bakedTexture = source.sprite->GetTextureID();
+                if (!Overlaps(source.bounds, baked))
+                    continue;
+                shader.setMat4("model", source.model);
+                GL::BindTexture(GL_TEXTURE_2D, source.bakedTexture);
+                GL::DrawArrays(GL_TRIANGLES, 0, 6);
+            }
+        }
+    }
+
+    GL::BindVertexArray(0);
+    GL::BindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previousFramebuffer));
+    GL::Viewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+    GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    if (!complete)
+    {
+        ReleaseTiles();
+        m_bypass = true;
+        return;
+    }
+    ++s_stats.rebuilds;
+}
+
+void StaticLayerCache::DrawTiles(const Math::Matrix& projection, Math::Vec2 offset, const Math::Rect* view) const
+{
+    if (m_tiles.empty())
+        return;
+
+    const SharedTarget& shared = Shared();
+    Shader& shader = *shared.shader;
+    shader.use();
+    shader.setMat4("projection", projection);
+
+    // Premultiplied tiles; RenderQueue restores the default blend after the custom run.
+    GL::Enable(GL_BLEND);
+    GL::BlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    GL::ActiveTexture(GL_TEXTURE0);
+    GL::BindVertexArray(shared.quadVAO);
+
+    const float gutter = static_cast<float>(GUTTER);
+    for (const Tile& tile : m_tiles)
+    {
+        const Math::Rect rect = Offset(tile.rect, offset);
+        if (view && !Overlaps(rect, *view))
+            continue;
+
+        const Math::Vec2 size = rect.top_right - rect.bottom_left;
+        const Math::Vec2 center = rect.bottom_left + size * 0.5f;
+        shader.setMat4("model", Math::Matrix::CreateTranslation(center) * Math::Matrix::CreateScale(size));
+        const float w = static_cast<float>(tile.width);
+        const float h = static_cast<float>(tile.height);
+        shader.setVec4("spriteRect", gutter / w, gutter / h, (w - 2.0f * gutter) / w, (h - 2.0f * gutter) / h);
+        GL::BindTexture(GL_TEXTURE_2D, tile.texture);
+        GL::DrawArrays(GL_TRIANGLES, 0, 6);
+    }
+    GL::BindVertexArray(0);
+}
+
+void StaticLayerCache::ReleaseTiles()
+{
+    for (Tile& tile : m_tiles)
+    {
+        GL::DeleteTextures(1, &tile.texture);
+        TextureTracker::Instance().Untrack(tile.texture);
+        --s_stats.tiles;
+        s_stats.residentBytes -= static_cast<size_t>(tile.width) * static_cast<size_t>(tile.height) * 4;
+    }
+    m_tiles.clear();
+    m_dirty = true;
+}
+
+void StaticLayerCache::Shutdown()
+{
+    Clear();
+    if (m_sharedRef)
+    {
+        SharedTarget& shared = Shared();
+        if (--shared.users == 0)
+            DestroyShared(shared);
+        m_sharedRef = false;
+    }
+}
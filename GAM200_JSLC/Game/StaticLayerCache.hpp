@@ -0,0 +1,88 @@
+//StaticLayerCache.hpp
+
+#pragma once
+#include "../Engine/Matrix.hpp"
+#include "../Engine/Rect.hpp"
+#include "../Engine/Vec2.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Background;
+class RenderQueue;
+
+struct StaticLayerStats
+{
+    int tiles = 0;
+    size_t residentBytes = 0;
+    int rebuilds = 0;
+};
+
+/**
+ * @brief Immovable sprites of one zone pre-composited into a grid of render-target tiles.
+ *
+ * The owner lists its static sprites with Add() (in draw order, in world space) and calls Invalidate()
+ * or re-lists them whenever their look changes: config hot-reload, the rooftop hole closing. Draw()
+ * then submits one custom pass that draws only the visible tiles, instead of every full-size layer.
+ *
+ * Tiles are baked lazily, on the first visible Draw after a change, and hold premultiplied colour so
+ * translucent layers composite exactly as their sources did. They are also rebuilt when a source
+ * texture is re-uploaded (zone stream-in), freed while a source is streamed out, and bypassed (sources
+ * drawn directly) while a source still shows its async placeholder.
+ */
+class StaticLayerCache
+{
+public:
+    /// Largest tile edge in texels; map art is drawn 1:1, so this is also world units.
+    static constexpr int MAX_TILE_SIZE = 1024;
+
+    /// Totals over every live cache (ImGui Performance window).
+    static const StaticLayerStats& GetStats() { return s_stats; }
+
+    StaticLayerCache() = default;
+    StaticLayerCache(const StaticLayerCache&) = delete;
+    StaticLayerCache& operator=(const StaticLayerCache&) = delete;
+
+    /// Drops the sprite list and the tiles.
+    void Clear();
+    /// source must outlive the cache entry; model maps the unit quad into world space.
+    void Add(const Background* source, const Math::Matrix& model);
+    /// Re-bake on the next visible Draw.
+    void Invalidate() { m_dirty = true; }
+
+    /// offset: world translation applied to the whole layer.
+    void Draw(RenderQueue& queue, uint8_t layer, Math::Vec2 offset = {});
+
+    /// Frees the tiles and, with the last cache, the shared bake shader and framebuffer.
+    void Shutdown();
+
+private:
+    struct Source
+    {
+        const Background* sprite = nullptr;
+        Math::Matrix model;
+        Math::Rect bounds;
+        unsigned int bakedTexture = 0; // texture id the tiles were composited from
+    };
+
+    struct Tile
+    {
+        unsigned int texture = 0;
+        Math::Rect rect; // world space, without the gutter
+        int width = 0;   // texels, with the gutter
+        int height = 0;
+    };
+
+    void Rebuild();
+    void DrawTiles(const Math::Matrix& projection, Math::Vec2 offset, const Math::Rect* view) const;
+    void ReleaseTiles();
+
+    std::vector<Source> m_sources;
+    std::vector<Tile> m_tiles;
+    Math::Rect m_bounds;
+    bool m_dirty = true;
+    bool m_bypass = false;    // framebuffer unusable: draw the sources directly
+    bool m_sharedRef = false; // holds a reference on the shared GL objects
+
+    inline static StaticLayerStats s_stats{};
+};
@@ -2,11 +2,14 @@
 
 #include "StoryDialogue.hpp"
 #include "../Engine/ControlBindings.hpp"
+#include "../Engine/SpriteBatch.hpp"
 #include "Background.hpp"
 #include "../Engine/Input.hpp"
 #include "../Engine/Matrix.hpp"
 #include "../OpenGL/Shader.hpp"
 #include "../OpenGL/GLWrapper.hpp"
+#include <algorithm>
+#include <string_view>
 
 bool StoryDialogue::s_dialogueEnabled = true;
 
@@ -46,7 +49,6 @@ void StoryDialogue::Shutdown()
 
 void StoryDialogue::ResetForNewRun()
 {
-    ClearLineTexture();
     m_lines.clear();
     m_pending.clear();
     m_onSequenceComplete = nullptr;
@@ -59,31 +61,9 @@ void StoryDialogue::ResetForNewRun()
     m_charAccum = 0.0f;
 }
 
-void StoryDialogue::ClearLineTexture()
-{
-    if (m_lineTex.textureID != 0)
-    {
-        GL::DeleteTextures(1, &m_lineTex.textureID);
-        m_lineTex = {};
-    }
-}
-
-void StoryDialogue::RebuildLineTexture(Font& font, Shader& fontShader)
-{
-    ClearLineTexture();
-    if (!m_active || m_lineIndex >= m_lines.size())
-        return;
-    const std::string& full = m_lines[m_lineIndex];
-    if (m_visibleChars == 0)
-        return;
-    const std::string sub = full.substr(0, m_visibleChars);
-    m_lineTex = font.CreateTextTexture(fontShader, sub);
-}
-
 void StoryDialogue::BeginSequence(std::vector<std::string> lines, std::function<void()> onComplete, float preTypeDelay,
                                   bool useConversionBackdrop, bool blocksGameplay)
 {
-    ClearLineTexture();
     m_lines                   = std::move(lines);
     m_lineIndex               = 0;
     m_visibleChars            = 0;
@@ -95,12 +75,11 @@ void StoryDialogue::BeginSequence(std::vector<std::string> lines, std::function<
     m_active                  = true;
 }
 
-void StoryDialogue::FinishSequence(Font& font, Shader& fontShader)
+void StoryDialogue::FinishSequence()
 {
     auto done = std::move(m_onSequenceComplete);
     m_onSequenceComplete = nullptr;
 
-    ClearLineTexture();
     m_lines.clear();
     m_lineIndex = 0;
     m_visibleChars = 0;
@@ -118,11 +97,10 @@ void StoryDialogue::FinishSequence(Font& font, Shader& fontShader)
         m_pending.pop_front();
         BeginSequence(std::move(next.lines), std::move(next.onComplete), next.preTypeDelay,
                       next.useConversionBackdrop, next.blocksGameplay);
-        RebuildLineTexture(font, fontShader);
     }
 }
 
-void StoryDialogue::EnqueueLines(const std::vector<std::string>& lines, Font& font, Shader& fontShader,
+void StoryDialogue::EnqueueLines(const std::vector<std::string>& lines,
     std::function<void()> onSequenceComplete, bool useConversionBackdrop, bool blocksGameplay)
 {
     if (lines.empty() || !s_dialogueEnabled)
@@ -133,10 +111,9 @@ void StoryDialogue::EnqueueLines(const std::vector<std::string>& lines, Font& fo
         return;
     }
     BeginSequence(lines, std::move(onSequenceComplete), 0.0f, useConversionBackdrop, blocksGameplay);
-    RebuildLineTexture(font, fontShader);
 }
 
-void StoryDialogue::EnqueueOpening(Font& font, Shader& fontShader)
+void StoryDialogue::EnqueueOpening()
 {
     QueuedSequence q;
     q.lines = {
@@ -152,10 +129,9 @@ void StoryDialogue::EnqueueOpening(Font& font, Shader& fontShader)
         return;
     }
     BeginSequence(std::move(q.lines), std::move(q.onComplete), q.preTypeDelay, q.useConversionBackdrop, q.blocksGameplay);
-    RebuildLineTexture(font, fontShader);
 }
 
-void StoryDialogue::Update(float dt, const Input::Input& input, const ControlBindings& controls, Font& font, Shader& fontShader)
+void StoryDialogue::Update(float dt, const Input::Input& input, const ControlBindings& controls)
 {
     if (!s_dialogueEnabled)
     {
@@ -183,40 +159,35 @@ void StoryDialogue::Update(float dt, const Input::Input& input, const ControlBin
         if (m_visibleChars < line.size())
         {
             m_visibleChars = line.size();
-            RebuildLineTexture(font, fontShader);
         }
         else
         {
             ++m_lineIndex;
             if (m_lineIndex >= m_lines.size())
             {
-                FinishSequence(font, fontShader);
-                if (m_active)
-                    RebuildLineTexture(font, fontShader);
+                FinishSequence();
             }
             else
             {
                 m_visibleChars = 0;
                 m_charAccum = 0.0f;
-                ClearLineTexture();
             }
         }
         return;
     }
 
-    if (m_visibleChars < line.size())                       
+    if (m_visibleChars < line.size())
     {
         m_charAccum += dt;
         while (m_charAccum >= m_secondsPerChar && m_visibleChars < line.size())
         {
             m_charAccum -= m_secondsPerChar;
             ++m_visibleChars;
-            RebuildLineTexture(font, fontShader);
         }
     }
 }
 
-void StoryDialogue::Draw(Font& font, Shader& textureShader, Shader& fontShader, const Math::Matrix& screenProjection)
+void StoryDialogue::Draw(const Font& font, Shader& textureShader, SpriteBatch& batch, const Math::Matrix& screenProjection)
 {
     if (!s_dialogueEnabled || !m_active)
         return;
@@ -243,16 +214,17 @@ void StoryDialogue::Draw(Font& font, Shader& textureShader, Shader& fontShader,
         m_boxImage->Draw(textureShader, boxModel);
     }
 
-    if (m_lineTex.textureID != 0 && m_lineTex.height > 0)
+    if (m_lineIndex < m_lines.size() && m_visibleChars > 0)
     {
-        const float rw = static_cast<float>(m_lineTex.width) * (TEXT_HEIGHT / static_cast<float>(font.m_fontHeight));
-        const float posX = boxCenterX - rw * 0.5f;
+        // Centre on the full line so revealed glyphs stay put while the rest types in.
+        const std::string& line = m_lines[m_lineIndex];
+        const float posX = boxCenterX - font.MeasureWidth(line, TEXT_HEIGHT) * 0.5f;
         const float posY = boxCenterY - TEXT_HEIGHT * 0.35f;
-        GL::Enable(GL_BLEND);
-        GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        fontShader.use();
-        fontShader.setMat4("projection", screenProjection);
-        font.DrawBakedText(fontShader, m_lineTex, { posX, posY }, TEXT_HEIGHT);
+        const std::string_view visible(line.data(), std::min(m_visibleChars, line.size()));
+
+        batch.Begin(screenProjection);
+        font.DrawText(batch, visible, { posX, posY }, TEXT_HEIGHT);
+        batch.End();
     }
 
     GL::Disable(GL_BLEND);
@@ -15,6 +15,7 @@ class Input;
 }
 class ControlBindings;
 class Shader;
+class SpriteBatch;
 class Background;
 
 /// Narrative typewriter text; optional full-screen box (Conversion.png). Blocks gameplay while active.
@@ -35,17 +36,16 @@ public:
     bool IsActive() const { return m_active && s_dialogueEnabled; }
     bool IsBlocking() const { return IsActive() && m_blocksGameplay; }
 
-    void EnqueueLines(const std::vector<std::string>& lines, Font& font, Shader& fontShader,
+    void EnqueueLines(const std::vector<std::string>& lines,
         std::function<void()> onSequenceComplete = nullptr, bool useConversionBackdrop = true,
         bool blocksGameplay = true);
-    void EnqueueOpening(Font& font, Shader& fontShader);
+    void EnqueueOpening();
 
-    void Update(float dt, const Input::Input& input, const ControlBindings& controls, Font& font, Shader& fontShader);
-    void Draw(Font& font, Shader& textureShader, Shader& fontShader, const Math::Matrix& screenProjection);
+    void Update(float dt, const Input::Input& input, const ControlBindings& controls);
+    /// Line is drawn as glyph runs from the font atlas; only the first m_visibleChars glyphs are emitted.
+    void Draw(const Font& font, Shader& textureShader, SpriteBatch& batch, const Math::Matrix& screenProjection);
 
 private:
-    void ClearLineTexture();
-    void RebuildLineTexture(Font& font, Shader& fontShader);
     struct QueuedSequence
     {
         std::vector<std::string> lines;
@@ -57,7 +57,7 @@ private:
 
     void BeginSequence(std::vector<std::string> lines, std::function<void()> onComplete, float preTypeDelay,
                        bool useConversionBackdrop, bool blocksGameplay);
-    void FinishSequence(Font& font, Shader& fontShader);
+    void FinishSequence();
 
     static bool s_dialogueEnabled;
 
@@ -74,6 +74,4 @@ private:
     bool m_blocksGameplay          = true;
     std::function<void()> m_onSequenceComplete;
     std::deque<QueuedSequence> m_pending;
-
-    CachedTextureInfo m_lineTex{};
 };
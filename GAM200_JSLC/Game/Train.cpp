@@ -7,10 +7,13 @@
 #include "../OpenGL/Shader.hpp"
 #include "../Engine/Matrix.hpp"
 #include "../Engine/DebugRenderer.hpp"
+#include "../Engine/RenderQueue.hpp"
+#include "../Engine/SpriteInstancer.hpp"
 #include "../Engine/Collision.hpp"
 #include "../Engine/Logger.hpp"
 #include "../OpenGL/GLWrapper.hpp"
 #include "MapObjectConfig.hpp"
+#include "RenderLayers.hpp"
 #include "Robot.hpp"
 #include <algorithm>
 #include <cmath>
@@ -58,131 +61,6 @@ static float WrapAnglePi(float a)
     return a;
 }
 
-#ifdef __EMSCRIPTEN__
-static std::string PatchShaderForWebGL330(const std::string& src)
-{
-    std::string out = src;
-    const std::string from = "#version 330 core";
-    auto pos = out.find(from);
-    if (pos != std::string::npos)
-    {
-        size_t endPos = pos + from.size();
-        if (endPos < out.size() && out[endPos] == '\n')
-            ++endPos;
-        out.erase(pos, endPos - pos);
-        out = "#version 300 es\nprecision highp float;\n" + out;
-    }
-    return out;
-}
-#endif
-
-static GLuint CompileGLShader(GLenum type, const char* src)
-{
-#ifdef __EMSCRIPTEN__
-    std::string patched = PatchShaderForWebGL330(std::string(src));
-    const char* code = patched.c_str();
-#else
-    const char* code = src;
-#endif
-
-    GLuint shader = GL::CreateShader(type);
-    GL::ShaderSource(shader, 1, &code, nullptr);
-    GL::CompileShader(shader);
-
-    GLint ok = 0;
-    GL::GetShaderiv(shader, GL_COMPILE_STATUS, &ok);
-    if (!ok)
-    {
-        char log[1024];
-        GL::GetShaderInfoLog(shader, static_cast<GLsizei>(sizeof(log)), nullptr, log);
-        Logger::Instance().Log(Logger::Severity::Error, "Train valve water shader compile failed:\n%s", log);
-        GL::DeleteShader(shader);
-        return 0;
-    }//
-    return shader;
-}
-
-static GLuint LinkGLProgram(GLuint vs, GLuint fs)
-{
-    GLuint program = GL::CreateProgram();
-    GL::AttachShader(program, vs);
-    GL::AttachShader(program, fs);
-    GL::LinkProgram(program);
-
-    GLint ok = 0;
-    GL::GetProgramiv(program, GL_LINK_STATUS, &ok);
-    if (!ok)
-    {
-        char log[1024];
-        GL::GetProgramInfoLog(program, static_cast<GLsizei>(sizeof(log)), nullptr, log);
-        Logger::Instance().Log(Logger::Severity::Error, "Train valve water program link failed:\n%s", log);
-        GL::DeleteProgram(program);
-        return 0;
-    }
-    return program;
-}
-
-namespace {
-// GPU-instanced valve water shader (GLSL 330 core — patched for WebGL2 in __EMSCRIPTEN__ builds)
-constexpr const char* kValveWaterVS = R"GLSL(
-#version 330 core
-layout (location = 0) in vec2 aPos;
-
-layout (location = 1) in vec2 iCenter;
-layout (location = 2) in vec2 iHalfSize;
-layout (location = 3) in float iAlpha;
-layout (location = 4) in float iLayer;
-
-uniform mat4 projection;
-
-out vec4 vColor;
-
-void main()
-{
-    vec2 corner = aPos * 2.0; // (-0.5..0.5) -> (-1..1)
-    vec2 world = iCenter + corner * iHalfSize;
-
-    // Tiny screen-space offsets from old multi-quad look (layer encoded as 0/1/2)
-    if (iLayer > 1.5)
-        world += vec2(-1.8, -1.0);
-    else if (iLayer > 0.5)
-        world += vec2(1.5, 1.5);
-
-    vec3 rgb = vec3(0.16, 0.74, 0.98);
-    float a = iAlpha;
-    if (iLayer > 1.5)
-    {
-        rgb = vec3(0.03, 0.25, 0.55);
-        a *= 0.28;
-    }
-    else if (iLayer > 0.5)
-    {
-        rgb = vec3(0.72, 0.95, 1.00);
-        a *= 0.62;
-    }
-    else
-    {
-        rgb = vec3(0.16, 0.74, 0.98);
-        a *= 0.55;
-    }
-
-    vColor = vec4(rgb, a);
-    gl_Position = projection * vec4(world, 0.0, 1.0);
-}
-)GLSL";
-
-constexpr const char* kValveWaterFS = R"GLSL(
-#version 330 core
-in vec4 vColor;
-out vec4 FragColor;
-
-void main()
-{
-    FragColor = vColor;
-}
-)GLSL";
-} // namespace
-
 // Convert pixel (px,py) top-left + size to world local center (Y-flipped)
 static Train::TrainHitbox MakeHitbox(float carOffset, float px, float py, float pw, float ph,
                                      bool collision = true,
@@ -985,42 +863,41 @@ void Train::UpdateValveWaterParticles(float dt)
     m_valveSplashScratch.clear();
 
     // 1) update existing particles
-    for (auto& p : m_valveWaterParticles)
+    ParticlePool& water = m_valveWater;
+    water.Integrate(dt, gravityY);
+
+    // Floor collision -> burst splash particles. Semi-implicit Euler, so the pre-step height is pos - vel * dt.
+    for (std::size_t i = 0; i < water.Span(); ++i)
     {
-        const float prevY = p.pos.y;
-        p.vel.y += gravityY * dt;
-        p.pos += p.vel * dt;
-        p.life -= dt;
+        if (!water.IsAlive(i))
+            continue;
+        const float y = water.posY[i];
+        if (y >= floorY)
+            continue;
 
-        // Floor collision -> burst splash particles
-        if (p.life > 0.0f && p.vel.y < -120.0f && p.maxLife > 0.45f && prevY >= floorY && p.pos.y < floorY)
+        const float prevY = y - water.velY[i] * dt;
+        if (water.velY[i] < -120.0f && water.maxLife[i] > 0.45f && prevY >= floorY)
         {
             const int splashCount = 3 + static_cast<int>(m_valvePressureT * 6.0f);
-            for (int i = 0; i < splashCount; ++i)
+            for (int k = 0; k < splashCount; ++k)
             {
-                const float fi = static_cast<float>(i);
-                const float ph = m_valveWaterAnimTime * 6.5f + fi * 1.37f + static_cast<float>(m_valveParticleCounter % 29u);
-                ValveWaterParticle sp{};
-                sp.pos = { p.pos.x + std::sin(ph) * 10.0f, floorY + 2.0f };
-                sp.vel = { std::sin(ph * 1.9f) * (70.0f + m_valvePressureT * 120.0f),
-                           140.0f + m_valvePressureT * 230.0f + std::cos(ph) * 40.0f };
+                const float fk = static_cast<float>(k);
+                const float ph = m_valveWaterAnimTime * 6.5f + fk * 1.37f + static_cast<float>(m_valveParticleCounter % 29u);
+                ParticlePool::Spawn sp{};
+                sp.position = { water.posX[i] + std::sin(ph) * 10.0f, floorY + 2.0f };
+                sp.velocity = { std::sin(ph * 1.9f) * (70.0f + m_valvePressureT * 120.0f),
+                                140.0f + m_valvePressureT * 230.0f + std::cos(ph) * 40.0f };
                 const float s = 7.0f + m_valvePressureT * 8.0f;
                 sp.size = { s, s * 0.9f };
-                sp.maxLife = 0.22f + m_valvePressureT * 0.22f;
-                sp.life = sp.maxLife;
+                sp.life = 0.22f + m_valvePressureT * 0.22f;
                 sp.alpha = 0.30f + m_valvePressureT * 0.35f;
                 m_valveSplashScratch.push_back(sp);
             }
-            p.life = 0.0f;
         }
+        water.Kill(i);
     }
-    m_valveWaterParticles.erase(
-        std::remove_if(m_valveWaterParticles.begin(), m_valveWaterParticles.end(),
-            [floorY](const ValveWaterParticle& p) { return p.life <= 0.0f || p.pos.y < floorY; }),
-        m_valveWaterParticles.end());
-    if (!m_valveSplashScratch.empty())
-        m_valveWaterParticles.insert(m_valveWaterParticles.end(), m_valveSplashScratch.begin(),
-                                     m_valveSplashScratch.end());
+    for (const ParticlePool::Spawn& sp : m_valveSplashScratch)
+        water.Emit(sp);
 
     // ApplyValveWaterDamageToEnemies는 Train::Update 끝에서 호출 — 스크립트가 SetPosition으로
     // 드론/로봇을 배치한 뒤에 넉백·데미지가 적용되도록 한다.
@@ -1046,13 +923,13 @@ void Train::UpdateValveWaterParticles(float dt)
         const float ph = static_cast<float>(m_valveParticleCounter) * 0.91f + m_valveWaterAnimTime * 2.4f;
         ++m_valveParticleCounter;
 
-        ValveWaterParticle p{};
+        ParticlePool::Spawn p{};
         const float outletJitterX = std::sin(ph * 1.3f) * 7.0f;
         const float outletJitterY = std::cos(ph * 1.9f) * 4.0f;
         float outletX = dirSign * 132.0f;
         if (dirSign > 0.0f)
             outletX += 42.0f; // right nozzle feels more "open"
-        p.pos = { valveWorld.x + outletX + outletJitterX, valveWorld.y - 40.0f + outletJitterY };
+        p.position = { valveWorld.x + outletX + outletJitterX, valveWorld.y - 40.0f + outletJitterY };
 
         const float pressureSpeed = 80.0f + m_valvePressureT * 360.0f;
         float sideKick = dirSign * (180.0f + m_valvePressureT * 420.0f + std::sin(ph) * 64.0f);
@@ -1064,24 +941,16 @@ void Train::UpdateValveWaterParticles(float dt)
             vertical *= 0.50f; // slightly flatter than before
         if (dirSign > 0.0f)
             vertical *= 0.26f; // right stream: slightly lower launch angle
-        p.vel = { sideKick, vertical };
+        p.velocity = { sideKick, vertical };
 
         const float s = 18.0f + m_valvePressureT * 24.0f + std::sin(ph * 0.8f) * 3.4f;
         const float sMul = (dirSign > 0.0f) ? 1.22f : 1.12f;
         p.size = { s * 1.12f * sMul, s * 1.60f * sMul };
-        p.maxLife = 0.55f + m_valvePressureT * 0.55f + std::abs(std::sin(ph * 0.6f)) * 0.18f;
-        p.life = p.maxLife;
+        p.life = 0.55f + m_valvePressureT * 0.55f + std::abs(std::sin(ph * 0.6f)) * 0.18f;
         p.alpha = 0.25f + m_valvePressureT * 0.55f;
 
-        m_valveWaterParticles.push_back(p);
-    }
-
-    if (m_valveWaterParticles.size() > kMaxValveWaterParticles)
-    {
-        const std::size_t drop = m_valveWaterParticles.size() - kMaxValveWaterParticles;
-        m_valveWaterParticles.erase(
-            m_valveWaterParticles.begin(),
-            m_valveWaterParticles.begin() + static_cast<std::ptrdiff_t>(drop));
+        // Past kMaxValveWaterParticles the ring overwrites the oldest drop.
+        m_valveWater.Emit(p);
     }
 }
 
@@ -1259,6 +1128,9 @@ void Train::UpdateCarTransportDrones(float dt, const Player& player, Math::Vec2
 }
 
 
+Train::~Train() = default;
+
+
 // ---------------------------------------------------------------------------
 // Initialize
 // ---------------------------------------------------------------------------
@@ -1309,7 +1181,7 @@ void Train::Initialize()
 
     // --- Rail tile ---
     m_railTile = std::make_unique<Background>();
-    m_railTile->Initialize("Asset/Train/rail.png");
+    m_railTile->Initialize("Asset/Train/rail.png", true); // GL_REPEAT: DrawRailTrack is one quad
 
     if (m_railTile->GetWidth() > 0)
         m_railTileW = static_cast<float>(m_railTile->GetWidth());
@@ -1344,9 +1216,9 @@ void Train::Initialize()
     BuildTrainHitboxes();
     ResetCarTransportSlotsToInitialState();
 
-    // --- Sky gradient VAO ---
+    // --- Sky quad + shader ---
     InitSkyVAO();
-    InitValveWaterGpu();
+    m_skyShader = std::make_unique<Shader>("OpenGL/Shaders/train_sky.vert", "OpenGL/Shaders/train_sky.frag");
 
     // --- Train state ---
     m_trainState      = TrainState::Stationary;
@@ -1760,169 +1632,13 @@ void Train::BuildTrainHitboxes()
 
 
 // ---------------------------------------------------------------------------
-// Valve water — GPU instanced rendering (single batched draw)
+// Valve water — hits on drones / robots
 // ---------------------------------------------------------------------------
-void Train::InitValveWaterGpu()
-{
-    ShutdownValveWaterGpu();
-
-    GLuint vs = CompileGLShader(GL_VERTEX_SHADER, kValveWaterVS);
-    GLuint fs = CompileGLShader(GL_FRAGMENT_SHADER, kValveWaterFS);
-    if (!vs || !fs)
-        return;
-
-    m_valveWaterProg = LinkGLProgram(vs, fs);
-    GL::DeleteShader(vs);
-    GL::DeleteShader(fs);
-    if (!m_valveWaterProg)
-        return;
-
-    m_valveWaterLocProjection = GL::GetUniformLocation(m_valveWaterProg, "projection");
-
-    float quadVerts[] = {
-        -0.5f,  0.5f,
-         0.5f, -0.5f,
-        -0.5f, -0.5f,
-        -0.5f,  0.5f,
-         0.5f,  0.5f,
-         0.5f, -0.5f
-    };
-
-    GL::GenVertexArrays(1, &m_valveWaterVAO);
-    GL::GenBuffers(1, &m_valveWaterQuadVBO);
-    GL::GenBuffers(1, &m_valveWaterInstVBO);
-
-    GL::BindVertexArray(m_valveWaterVAO);
-
-    GL::BindBuffer(GL_ARRAY_BUFFER, m_valveWaterQuadVBO);
-    GL::BufferData(GL_ARRAY_BUFFER, sizeof(quadVerts), quadVerts, GL_STATIC_DRAW);
-    GL::VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    GL::EnableVertexAttribArray(0);
-
-    constexpr GLsizei instStride = sizeof(ValveWaterGpuInstance);
-    GL::BindBuffer(GL_ARRAY_BUFFER, m_valveWaterInstVBO);
-    m_valveWaterInstPoolBytes = sizeof(ValveWaterGpuInstance) * 4096u;
-    GL::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_valveWaterInstPoolBytes), nullptr, GL_DYNAMIC_DRAW);
-
-    GL::VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, instStride, (void*)offsetof(ValveWaterGpuInstance, center));
-    GL::EnableVertexAttribArray(1);
-    GL::VertexAttribDivisor(1, 1);
-
-    GL::VertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, instStride, (void*)offsetof(ValveWaterGpuInstance, halfSize));
-    GL::EnableVertexAttribArray(2);
-    GL::VertexAttribDivisor(2, 1);
-
-    GL::VertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, instStride, (void*)offsetof(ValveWaterGpuInstance, alpha));
-    GL::EnableVertexAttribArray(3);
-    GL::VertexAttribDivisor(3, 1);
-
-    GL::VertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, instStride, (void*)offsetof(ValveWaterGpuInstance, layer));
-    GL::EnableVertexAttribArray(4);
-    GL::VertexAttribDivisor(4, 1);
-
-    GL::BindVertexArray(0);
-    GL::BindBuffer(GL_ARRAY_BUFFER, 0);
-
-    m_valveWaterGpuReady = true;
-}
-
-void Train::ShutdownValveWaterGpu()
-{
-    if (m_valveWaterVAO) { GL::DeleteVertexArrays(1, &m_valveWaterVAO); m_valveWaterVAO = 0; }
-    if (m_valveWaterQuadVBO) { GL::DeleteBuffers(1, &m_valveWaterQuadVBO); m_valveWaterQuadVBO = 0; }
-    if (m_valveWaterInstVBO) { GL::DeleteBuffers(1, &m_valveWaterInstVBO); m_valveWaterInstVBO = 0; }
-    if (m_valveWaterProg) { GL::DeleteProgram(m_valveWaterProg); m_valveWaterProg = 0; }
-    m_valveWaterLocProjection = -1;
-    m_valveWaterInstPoolBytes = 0;
-    m_valveWaterGpuReady = false;
-}
-
-void Train::UploadAndDrawValveWaterGpu(const Math::Matrix& projection, Math::Vec2 cameraPos, float viewHalfW) const
-{
-    if (!m_valveWaterGpuReady || !m_valveWaterProg || !m_valveWaterVAO)
-        return;
-
-    const float valveY = MIN_Y + m_valveLocalCenter.y;
-
-    const float halfW = (viewHalfW > 300.0f) ? viewHalfW : 300.0f;
-    const float visL = cameraPos.x - halfW - 900.0f;
-    const float visR = cameraPos.x + halfW + 900.0f;
-
-    m_valveWaterGpuScratch.clear();
-    m_valveWaterGpuScratch.reserve(m_valveWaterParticles.size() * 3u + 64u);
-
-    for (const auto& p : m_valveWaterParticles)
-    {
-        if (p.pos.x < visL || p.pos.x > visR)
-            continue;
-
-        const float lifeT = (p.maxLife > 0.0f) ? std::clamp(p.life / p.maxLife, 0.0f, 1.0f) : 0.0f;
-        const float alphaBase = p.alpha * (0.35f + lifeT * 0.65f);
-        const float stretch = 1.0f + std::min(1.8f, std::abs(p.vel.y) / 320.0f);
-        const float depthT = std::clamp((valveY - p.pos.y) / 360.0f, 0.0f, 1.0f);
-
-        const float widthMul = 1.65f + depthT * 2.45f;
-        const float rightOnlyBoost = (p.vel.x > 0.0f) ? 1.48f : 1.0f;
-        const Math::Vec2 mainSize = { p.size.x * widthMul * rightOnlyBoost, p.size.y * stretch * 1.20f };
-
-        const Math::Vec2 half = { mainSize.x * 0.5f, mainSize.y * 0.5f };
-
-        ValveWaterGpuInstance body{};
-        body.center = p.pos;
-        body.halfSize = half;
-        body.alpha = alphaBase;
-        body.layer = 0.0f;
-        m_valveWaterGpuScratch.push_back(body);
-
-        ValveWaterGpuInstance core{};
-        core.center = p.pos + Math::Vec2{ 1.5f, 1.5f };
-        core.halfSize = { mainSize.x * 0.56f * 0.5f, mainSize.y * 0.76f * 0.5f };
-        core.alpha = alphaBase;
-        core.layer = 1.0f;
-        m_valveWaterGpuScratch.push_back(core);
-
-        ValveWaterGpuInstance sh{};
-        sh.center = p.pos + Math::Vec2{ -1.8f, -1.0f };
-        sh.halfSize = { mainSize.x * 0.66f * 0.5f, mainSize.y * 0.74f * 0.5f };
-        sh.alpha = alphaBase;
-        sh.layer = 2.0f;
-        m_valveWaterGpuScratch.push_back(sh);
-    }
-
-    if (m_valveWaterGpuScratch.empty())
-        return;
-
-    const GLsizeiptr bytesNeeded =
-        static_cast<GLsizeiptr>(m_valveWaterGpuScratch.size() * sizeof(ValveWaterGpuInstance));
-
-    GL::BindBuffer(GL_ARRAY_BUFFER, m_valveWaterInstVBO);
-    if (bytesNeeded > static_cast<GLsizeiptr>(m_valveWaterInstPoolBytes))
-    {
-        const GLsizeiptr newBytes =
-            (bytesNeeded * 3) / 2 + static_cast<GLsizeiptr>(sizeof(ValveWaterGpuInstance)) * 256;
-        GL::BufferData(GL_ARRAY_BUFFER, newBytes, nullptr, GL_DYNAMIC_DRAW);
-        m_valveWaterInstPoolBytes = static_cast<std::uint32_t>(newBytes);
-    }
-
-    GL::BufferSubData(GL_ARRAY_BUFFER, 0,
-                      static_cast<GLsizeiptr>(m_valveWaterGpuScratch.size() * sizeof(ValveWaterGpuInstance)),
-                      m_valveWaterGpuScratch.data());
-    GL::BindBuffer(GL_ARRAY_BUFFER, 0);
-
-    GL::UseProgram(m_valveWaterProg);
-    GL::UniformMatrix4fv(m_valveWaterLocProjection, 1, GL_FALSE, projection.Ptr());
-
-    GL::BindVertexArray(m_valveWaterVAO);
-    GL::DrawArraysInstanced(GL_TRIANGLES, 0, 6, static_cast<GLsizei>(m_valveWaterGpuScratch.size()));
-    GL::BindVertexArray(0);
-    GL::UseProgram(0);
-}
-
 void Train::ApplyValveWaterDamageToEnemies(float dt)
 {
     if (dt <= 0.0f)
         return;
-    if (m_valvePressureT <= 0.01f && m_valveWaterParticles.empty())
+    if (m_valvePressureT <= 0.01f && m_valveWater.Empty())
         return;
 
     const float fdt = static_cast<float>(dt);
@@ -1934,19 +1650,19 @@ void Train::ApplyValveWaterDamageToEnemies(float dt)
 
     auto hitsWater = [&](const Math::Vec2& enemyCenter, const Math::Vec2& enemySize, float extraEnemyPadding) -> bool
     {
-        if (m_valveWaterParticles.empty())
-            return false;
-        for (const auto& p : m_valveWaterParticles)
+        const ParticlePool& water = m_valveWater;
+        for (std::size_t i = 0; i < water.Span(); ++i)
         {
-            if (p.life <= 0.0f)
+            if (!water.IsAlive(i))
                 continue;
 
-            const float lifeT = (p.maxLife > 0.0f) ? std::clamp(p.life / p.maxLife, 0.0f, 1.0f) : 0.0f;
-            const float stretch = 1.0f + std::min(1.8f, std::abs(p.vel.y) / 320.0f);
-            const float depthT = std::clamp((valveY - p.pos.y) / 360.0f, 0.0f, 1.0f);
+            const Math::Vec2 pos{ water.posX[i], water.posY[i] };
+            const float lifeT = water.LifeT(i);
+            const float stretch = 1.0f + std::min(1.8f, std::abs(water.velY[i]) / 320.0f);
+            const float depthT = std::clamp((valveY - pos.y) / 360.0f, 0.0f, 1.0f);
             const float widthMul = 1.65f + depthT * 2.45f;
 
-            const bool isRightJet = (p.vel.x > 0.0f);
+            const bool isRightJet = (water.velX[i] > 0.0f);
             const float jetBoost = isRightJet ? 1.48f : 1.0f;
             const float hitBoost = isRightJet ? 1.35f : 1.0f;
 
@@ -1954,8 +1670,8 @@ void Train::ApplyValveWaterDamageToEnemies(float dt)
             paddedEnemySize.x += extraEnemyPadding;
             paddedEnemySize.y += extraEnemyPadding;
 
-            const Math::Vec2 mainSize = { p.size.x * widthMul * jetBoost * hitBoost, p.size.y * stretch * 1.20f };
-            if (!Collision::CheckAABB(p.pos, mainSize, enemyCenter, paddedEnemySize))
+            const Math::Vec2 mainSize = { water.sizeX[i] * widthMul * jetBoost * hitBoost, water.sizeY[i] * stretch * 1.20f };
+            if (!Collision::CheckAABB(pos, mainSize, enemyCenter, paddedEnemySize))
                 continue;
 
             if (m_valvePressureT < 0.05f && lifeT < 0.05f)
@@ -2592,7 +2308,7 @@ void Train::DrawCar3SirenWaves(Shader& colorShader, Math::Vec2 cameraPos, float
 }
 
 
-void Train::DrawCar2EnterLeavePrompt(Shader& textureShader, Math::Vec2 cameraPos, float viewHalfW) const
+void Train::DrawCar2EnterLeavePrompt(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const
 {
     if (!m_car2PurpleHbValid)
         return;
@@ -2625,16 +2341,9 @@ void Train::DrawCar2EnterLeavePrompt(Shader& textureShader, Math::Vec2 cameraPos
     const float pw = static_cast<float>(tex->GetWidth());
     const float ph = static_cast<float>(tex->GetHeight());
 
-    textureShader.use();
-    textureShader.setBool("flipX", false);
-    textureShader.setFloat("alpha", 1.0f);
-    textureShader.setVec3("colorTint", 1.0f, 1.0f, 1.0f);
-    textureShader.setFloat("tintStrength", 0.0f);
-    textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-
     Math::Matrix model =
         Math::Matrix::CreateTranslation(promptCenter) * Math::Matrix::CreateScale({ pw * 0.85f, ph * 0.85f });
-    tex->Draw(textureShader, model);
+    tex->Draw(queue, RenderLayer::TrainPrompt, model);
 }
 
 
@@ -3589,7 +3298,7 @@ void Train::StartEntryTimer()
         m_valveWaterAnimTime = 0.0f;
         m_valveParticleSpawnCarry = 0.0f;
         m_valveParticleCounter = 0;
-        m_valveWaterParticles.clear();
+        m_valveWater.Clear();
         m_car5EncounterActive       = false;
         m_car5ValveHintTimer        = 0.0f;
         m_encounterScriptTime     = 0.f;
@@ -3743,113 +3452,59 @@ void Train::DrawCircleLine(Shader& colorShader,
 
 // ---------------------------------------------------------------------------
 // DrawBackground – sunset sky gradient with simple horizontal parallax
-//   Called from GameplayState::DrawMainLayer before the texture-shader pass.
+//   Submitted on RenderLayer::Sky, under everything else in the world pass.
+//   train_sky.frag evaluates every band / cloud / skyline rect per pixel, so the
+//   whole sky is one quad covering the view instead of ~80 solid_color draws.
 // ---------------------------------------------------------------------------
-void Train::DrawBackground(Shader& colorShader, Math::Vec2 cameraPos, float viewHalfW) const
+void Train::DrawBackground(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const
 {
-    // Camera-visible interval (with safety margin) for dynamic repetition.
-    // This keeps the draw count low while still preventing background seams.
+    if (!m_skyShader || !m_skyVAO)
+        return;
+
+    // Cover the view with margin (camera shake / zoom); the frame is wider than tall, so halfW bounds both axes.
     viewHalfW = (viewHalfW > 300.0f) ? viewHalfW : 300.0f;
-    const float drawMargin = 1400.0f;
-    const float visibleLeft  = cameraPos.x - viewHalfW - drawMargin;
-    const float visibleRight = cameraPos.x + viewHalfW + drawMargin;
+    const float cover = (viewHalfW + 400.0f) * 2.0f;
 
     // When the camera follows the player upward (car 4 stacks), shift the sky vertically with the camera
     // so the sunset bands still fill the frame instead of leaving cleared black at the top.
     const float skyAnchorY = MIN_Y + HEIGHT * 0.5f;
     const float skyLift    = cameraPos.y - skyAnchorY;
-    const auto  relY       = [&](float t) { return MIN_Y + HEIGHT * t + skyLift; };
 
-    // Sky gradient only needs to cover current visible area.
-    const float spanW = (visibleRight - visibleLeft) + 1200.0f;
+    // Base bands stay centered on the camera; clouds, skyline and poles use parallax offsets.
     const float centerX = MIN_X + m_totalTrainWidth * 0.5f;
     const float camDx = cameraPos.x - centerX;
-    // Keep base sky centered on camera so it never falls out of view.
-    // Only foreground/background objects use parallax offsets.
-    const float skyPx  = cameraPos.x;
     const float farPx  = centerX + camDx * 0.05f;
     const float midPx  = centerX + camDx * 0.16f;
     const float nearPx = centerX + camDx * 0.34f;
-
-    // Smoother sunset gradient (many soft layers instead of hard 3 bands)
-    DrawFilledQuad(colorShader, { skyPx, relY(0.90f) }, { spanW, HEIGHT * 0.22f }, 0.13f, 0.05f, 0.19f, 1.0f);
-    DrawFilledQuad(colorShader, { skyPx, relY(0.75f) }, { spanW, HEIGHT * 0.22f }, 0.22f, 0.08f, 0.20f, 0.95f);
-    DrawFilledQuad(colorShader, { skyPx, relY(0.60f) }, { spanW, HEIGHT * 0.20f }, 0.38f, 0.11f, 0.18f, 0.90f);
-    DrawFilledQuad(colorShader, { skyPx, relY(0.47f) }, { spanW, HEIGHT * 0.18f }, 0.58f, 0.17f, 0.14f, 0.88f);
-    DrawFilledQuad(colorShader, { skyPx, relY(0.36f) }, { spanW, HEIGHT * 0.16f }, 0.80f, 0.28f, 0.11f, 0.85f);
-    DrawFilledQuad(colorShader, { skyPx, relY(0.25f) }, { spanW, HEIGHT * 0.18f }, 0.53f, 0.18f, 0.10f, 0.70f);
-    DrawFilledQuad(colorShader, { skyPx, relY(0.11f) }, { spanW, HEIGHT * 0.22f }, 0.10f, 0.07f, 0.08f, 1.0f);
-
-    // Sun + glow
     // Mild parallax for sun only (0.9x): keeps stability while adding depth.
     const float sunX = centerX + camDx * 0.9f + 320.0f;
-    const float sunY = relY(0.37f);
-    DrawFilledQuad(colorShader, { sunX, sunY }, { HEIGHT * 0.34f, HEIGHT * 0.34f }, 1.00f, 0.48f, 0.18f, 0.28f);
-    DrawFilledQuad(colorShader, { sunX, sunY }, { HEIGHT * 0.18f, HEIGHT * 0.18f }, 1.00f, 0.62f, 0.24f, 0.58f);
-    DrawFilledQuad(colorShader, { sunX, sunY }, { HEIGHT * 0.09f, HEIGHT * 0.09f }, 1.00f, 0.79f, 0.35f, 0.95f);
-
-    // Repeated cloud objects (dense, multi-row, infinite-style coverage)
-    const float cloudBase = farPx;
-    const float cloudStep = 620.0f;
-    const int cloudMinI = static_cast<int>(std::floor((visibleLeft - cloudBase - 700.0f) / cloudStep));
-    const int cloudMaxI = static_cast<int>(std::ceil((visibleRight - cloudBase + 700.0f) / cloudStep));
-    for (int i = cloudMinI; i <= cloudMaxI; ++i)
-    {
-        const float x = cloudBase + i * 620.0f;
-        const float y1 = relY(0.78f - 0.02f * static_cast<float>((i + 30) % 4));
-        const float y2 = relY(0.66f - 0.02f * static_cast<float>((i + 11) % 5));
-        const float y3 = relY(0.56f - 0.015f * static_cast<float>((i + 7) % 6));
-
-        DrawFilledQuad(colorShader, { x,          y1 }, { 520.0f, 52.0f }, 0.40f, 0.17f, 0.27f, 0.26f);
-        DrawFilledQuad(colorShader, { x + 120.0f, y1 - 24.0f }, { 360.0f, 38.0f }, 0.33f, 0.13f, 0.24f, 0.20f);
-
-        DrawFilledQuad(colorShader, { x - 80.0f,  y2 }, { 430.0f, 42.0f }, 0.52f, 0.21f, 0.20f, 0.18f);
-        DrawFilledQuad(colorShader, { x + 50.0f,  y2 - 20.0f }, { 300.0f, 30.0f }, 0.45f, 0.17f, 0.18f, 0.14f);
-
-        DrawFilledQuad(colorShader, { x + 30.0f,  y3 }, { 340.0f, 28.0f }, 0.68f, 0.26f, 0.16f, 0.10f);
-    }
-
-    // Mid skyline (dynamic range from current camera visibility)
-    const float midStep = 360.0f;
-    const int midMinI = static_cast<int>(std::floor((visibleLeft - midPx - 300.0f) / midStep));
-    const int midMaxI = static_cast<int>(std::ceil((visibleRight - midPx + 300.0f) / midStep));
-    for (int i = midMinI; i <= midMaxI; ++i)
-    {
-        const float x = midPx + i * 360.0f;
-        const float h = 110.0f + static_cast<float>((i + 60) % 7) * 26.0f;
-        const float w = 130.0f + static_cast<float>((i + 60) % 4) * 22.0f;
-        DrawFilledQuad(colorShader, { x, relY(0.13f) + h * 0.5f }, { w, h }, 0.10f, 0.06f, 0.09f, 0.95f);
-    }
+    const float sunY = MIN_Y + HEIGHT * 0.37f + skyLift;
 
-    // Near dark silhouette strip (foreground city/yard)
-    const float nearStep = 210.0f;
-    const int nearMinI = static_cast<int>(std::floor((visibleLeft - nearPx - 250.0f) / nearStep));
-    const int nearMaxI = static_cast<int>(std::ceil((visibleRight - nearPx + 250.0f) / nearStep));
-    for (int i = nearMinI; i <= nearMaxI; ++i)
-    {
-        const float x = nearPx + i * 210.0f;
-        const float h = 86.0f + static_cast<float>((i + 100) % 5) * 20.0f;
-        DrawFilledQuad(colorShader, { x, relY(0.07f) + h * 0.5f }, { 150.0f, h }, 0.07f, 0.05f, 0.06f, 1.0f);
-    }
+    queue.SubmitCustom(RenderLayer::Sky,
+        [this, cameraPos, cover, skyLift, sunX, sunY, farPx, midPx, nearPx](const Math::Matrix& projection)
+        {
+            m_skyShader->use();
+            m_skyShader->setMat4("projection", projection);
+            m_skyShader->setVec4("uSkyRect", cameraPos.x, cameraPos.y, cover, cover);
+            m_skyShader->setFloat("uSkyBaseY", MIN_Y + skyLift);
+            m_skyShader->setFloat("uSkyHeight", HEIGHT);
+            m_skyShader->setVec2("uSun", sunX, sunY);
+            m_skyShader->setVec3("uParallaxX", farPx, midPx, nearPx);
 
-    // Poles / masts
-    const float poleStep = 160.0f;
-    const int poleMinI = static_cast<int>(std::floor((visibleLeft - nearPx - 120.0f) / poleStep));
-    const int poleMaxI = static_cast<int>(std::ceil((visibleRight - nearPx + 120.0f) / poleStep));
-    for (int i = poleMinI; i <= poleMaxI; ++i)
-    {
-        const float x = nearPx + i * 160.0f;
-        DrawFilledQuad(colorShader, { x, relY(0.22f) },
-                       { 10.0f, 170.0f + static_cast<float>((i + 80) % 3) * 36.0f },
-                       0.06f, 0.04f, 0.05f, 0.94f);
-    }
+            // The shader composites its layers itself and writes premultiplied colour.
+            GL::BlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            GL::BindVertexArray(m_skyVAO);
+            GL::DrawArrays(GL_TRIANGLES, 0, 6);
+            GL::BindVertexArray(0);
+            GL::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        });
 }
 
 
 // ---------------------------------------------------------------------------
 // DrawCarTransportOverlays — 시동 ON: PulseLine 스프라이트 / 시동 OFF: Start.png
 // ---------------------------------------------------------------------------
-void Train::DrawCarTransportOverlays(Shader& textureShader, Math::Vec2 cameraPos, float viewHalfW) const
+void Train::DrawCarTransportOverlays(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const
 {
     float halfW = (viewHalfW > 300.0f) ? viewHalfW : 300.0f;
     const float margin   = 900.0f;
@@ -3857,11 +3512,6 @@ void Train::DrawCarTransportOverlays(Shader& textureShader, Math::Vec2 cameraPos
     const float visRight = cameraPos.x + halfW + margin;
     const float trainLeft = MIN_X + m_trainOffset;
 
-    textureShader.use();
-    textureShader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-    textureShader.setBool("flipX", false);
-    textureShader.setFloat("alpha", 1.0f);
-
     for (int i = 0; i < kCarTransportCount; ++i)
     {
         const auto& slot = m_carTransportSlots[static_cast<size_t>(i)];
@@ -3890,7 +3540,7 @@ void Train::DrawCarTransportOverlays(Shader& textureShader, Math::Vec2 cameraPos
 
             const Math::Matrix model =
                 Math::Matrix::CreateTranslation(pulseCenter) * Math::Matrix::CreateScale(scale);
-            tex->Draw(textureShader, model);
+            tex->Draw(queue, RenderLayer::TrainPrompt, model);
         }
         else if (!slot.engineOn && m_carTransportStartTex && m_carTransportStartTex->GetWidth() > 0)
         {
@@ -3899,7 +3549,7 @@ void Train::DrawCarTransportOverlays(Shader& textureShader, Math::Vec2 cameraPos
                                  / static_cast<float>(m_carTransportStartTex->GetWidth());
             const Math::Matrix model =
                 Math::Matrix::CreateTranslation(wc) * Math::Matrix::CreateScale({ iconW, iconW * aspect });
-            m_carTransportStartTex->Draw(textureShader, model);
+            m_carTransportStartTex->Draw(queue, RenderLayer::TrainPrompt, model);
         }
     }
 }
@@ -3944,22 +3594,51 @@ void Train::DrawCarTransportVFX(Shader& colorShader, Math::Vec2 cameraPos, float
     }
 }
 
-void Train::DrawValveWaterVFX(Shader& colorShader, const Math::Matrix& worldProjection, Math::Vec2 cameraPos,
-                              float viewHalfW) const
+void Train::DrawValveWaterVFX(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const
 {
-    (void)colorShader;
-
-    if (m_valveWaterParticles.empty() && m_valvePressureT <= 0.01f)
+    if (m_valveWater.Empty())
         return;
 
-    UploadAndDrawValveWaterGpu(worldProjection, cameraPos, viewHalfW);
+    const float valveY = MIN_Y + m_valveLocalCenter.y;
+
+    const float halfW = (viewHalfW > 300.0f) ? viewHalfW : 300.0f;
+    const float visL = cameraPos.x - halfW - 900.0f;
+    const float visR = cameraPos.x + halfW + 900.0f;
+
+    // Three quads per drop, same order as before: body, bright core, dark shadow.
+    queue.SubmitInstanced(RenderLayer::TrainWater, [this, valveY, visL, visR](SpriteInstancer& instancer)
+    {
+        const ParticlePool& water = m_valveWater;
+        for (std::size_t i = 0; i < water.Span(); ++i)
+        {
+            if (!water.IsAlive(i))
+                continue;
+            const Math::Vec2 pos{ water.posX[i], water.posY[i] };
+            if (pos.x < visL || pos.x > visR)
+                continue;
+
+            const float alphaBase = water.alpha[i] * (0.35f + water.LifeT(i) * 0.65f);
+            const float stretch = 1.0f + std::min(1.8f, std::abs(water.velY[i]) / 320.0f);
+            const float depthT = std::clamp((valveY - pos.y) / 360.0f, 0.0f, 1.0f);
+
+            const float widthMul = 1.65f + depthT * 2.45f;
+            const float rightOnlyBoost = (water.velX[i] > 0.0f) ? 1.48f : 1.0f;
+            const Math::Vec2 mainSize = { water.sizeX[i] * widthMul * rightOnlyBoost, water.sizeY[i] * stretch * 1.20f };
+
+            instancer.AddQuad(pos, mainSize, 0.16f, 0.74f, 0.98f, alphaBase * 0.55f);
+            instancer.AddQuad(pos + Math::Vec2{ 3.0f, 3.0f }, { mainSize.x * 0.56f, mainSize.y * 0.76f },
+                              0.72f, 0.95f, 1.00f, alphaBase * 0.62f);
+            instancer.AddQuad(pos + Math::Vec2{ -3.6f, -2.0f }, { mainSize.x * 0.66f, mainSize.y * 0.74f },
+                              0.03f, 0.25f, 0.55f, alphaBase * 0.28f);
+        }
+    });
 }
 
 
 // ---------------------------------------------------------------------------
 // Draw – draws rail tiles and train car images
 // ---------------------------------------------------------------------------
-void Train::DrawRailTrack(Shader& shader, Math::Vec2 cameraPos, float viewHalfW) const
+void Train::DrawRailTrack(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const
 {
     if (!m_railTile || m_railTileW <= 0.0f)
         return;
@@ -3968,22 +3647,23 @@ void Train::DrawRailTrack(Shader& shader, Math::Vec2 cameraPos, float viewHalfW)
     const float railMargin = 600.0f;
     const float leftX      = cameraPos.x - safeHalfW - railMargin;
     const float rightX     = cameraPos.x + safeHalfW + railMargin;
-    const float tileLeft0  = MIN_X;
-    const int minTile = static_cast<int>(std::floor((leftX - tileLeft0) / m_railTileW)) - 1;
-    const int maxTile = static_cast<int>(std::ceil((rightX - tileLeft0) / m_railTileW)) + 1;
-    const float cy = MIN_Y + m_railTileH * 0.5f;
+    const float spanW      = rightX - leftX;
 
-    for (int i = minTile; i <= maxTile; ++i)
-    {
-        float cx = MIN_X + i * m_railTileW + m_railTileW * 0.5f;
-        Math::Matrix model =
-            Math::Matrix::CreateTranslation({ cx, cy }) *
-            Math::Matrix::CreateScale({ m_railTileW, m_railTileH });
-        m_railTile->Draw(shader, model);
-    }
+    // One quad over the visible span; rail.png is loaded with GL_REPEAT, so U runs past 1 and the
+    // tiles stay anchored to MIN_X (fract keeps U small for precision far from the origin).
+    const float tilesFromOrigin = (leftX - MIN_X) / m_railTileW;
+    const float u0 = tilesFromOrigin - std::floor(tilesFromOrigin);
+    // V is inset half a texel so linear filtering never wraps the top row into the bottom one.
+    const float texelV = 1.0f / std::max(m_railTileH, 1.0f);
+    const SpriteUVRect uv{ u0, texelV * 0.5f, spanW / m_railTileW, 1.0f - texelV };
+
+    const Math::Matrix model =
+        Math::Matrix::CreateTranslation({ leftX + spanW * 0.5f, MIN_Y + m_railTileH * 0.5f }) *
+        Math::Matrix::CreateScale({ spanW, m_railTileH });
+    queue.SubmitSprite(RenderLayer::Rail, m_railTile->GetTextureID(), model, uv);
 }
 
-void Train::Draw(Shader& shader, Math::Vec2 cameraPos, float viewHalfW) const
+void Train::Draw(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const
 {
     // ── Train car images (move with trainOffset) ───────────────────────────
     const float trainLeft = MIN_X + m_trainOffset;
@@ -3995,7 +3675,7 @@ void Train::Draw(Shader& shader, Math::Vec2 cameraPos, float viewHalfW) const
         Math::Matrix model =
             Math::Matrix::CreateTranslation({ cx, cy }) *
             Math::Matrix::CreateScale({ m_car1Width, HEIGHT });
-        m_firstTrain->Draw(shader, model);
+        m_firstTrain->Draw(queue, RenderLayer::TrainCar, model);
     }
 
     if (m_secondTrain)
@@ -4005,7 +3685,7 @@ void Train::Draw(Shader& shader, Math::Vec2 cameraPos, float viewHalfW) const
         Math::Matrix model =
             Math::Matrix::CreateTranslation({ cx, cy }) *
             Math::Matrix::CreateScale({ m_car2Width, HEIGHT });
-        m_secondTrain->Draw(shader, model);
+        m_secondTrain->Draw(queue, RenderLayer::TrainCar, model);
     }
 
     if (m_thirdTrain)
@@ -4015,7 +3695,7 @@ void Train::Draw(Shader& shader, Math::Vec2 cameraPos, float viewHalfW) const
         Math::Matrix model =
             Math::Matrix::CreateTranslation({ cx, cy }) *
             Math::Matrix::CreateScale({ m_car3Width, HEIGHT });
-        m_thirdTrain->Draw(shader, model);
+        m_thirdTrain->Draw(queue, RenderLayer::TrainCar, model);
     }
 
     if (m_thirdThirdTrain)
@@ -4025,7 +3705,7 @@ void Train::Draw(Shader& shader, Math::Vec2 cameraPos, float viewHalfW) const
         Math::Matrix model =
             Math::Matrix::CreateTranslation({ cx, cy }) *
             Math::Matrix::CreateScale({ m_car4Width, HEIGHT });
-        m_thirdThirdTrain->Draw(shader, model);
+        m_thirdThirdTrain->Draw(queue, RenderLayer::TrainCar, model);
     }
 
     if (m_fourthTrain)
@@ -4035,7 +3715,7 @@ void Train::Draw(Shader& shader, Math::Vec2 cameraPos, float viewHalfW) const
         Math::Matrix model =
             Math::Matrix::CreateTranslation({ cx, cy }) *
             Math::Matrix::CreateScale({ m_car5Width, HEIGHT });
-        m_fourthTrain->Draw(shader, model);
+        m_fourthTrain->Draw(queue, RenderLayer::TrainCar, model);
     }
 
     if (m_valveSprite && m_valveSprite->GetWidth() > 0)
@@ -4046,14 +3726,14 @@ void Train::Draw(Shader& shader, Math::Vec2 cameraPos, float viewHalfW) const
             Math::Matrix::CreateTranslation(valveWorld) *
             Math::Matrix::CreateRotation(cwDeg) *
             Math::Matrix::CreateScale(m_valveVisualSize);
-        m_valveSprite->Draw(shader, model);
+        m_valveSprite->Draw(queue, RenderLayer::TrainProp, model);
     }
 
     // ── Robots (none currently, kept for future use) ─────────────────────
     for (const auto& robot : m_robots)
     {
         if (!robot.IsDead())
-            robot.Draw(shader);
+            robot.Draw(queue, RenderLayer::TrainActor);
     }
 }
 
@@ -4061,14 +3741,14 @@ void Train::Draw(Shader& shader, Math::Vec2 cameraPos, float viewHalfW) const
 // ---------------------------------------------------------------------------
 // DrawDrones / DrawRadars / DrawGauges
 // ---------------------------------------------------------------------------
-void Train::DrawDrones(Shader& shader) const
+void Train::DrawDrones(SpriteInstancer& instancer) const
 {
     if (m_droneManager)
-        m_droneManager->Draw(shader);
+        m_droneManager->Draw(instancer);
     if (m_carTransportDroneManager)
-        m_carTransportDroneManager->Draw(shader);
+        m_carTransportDroneManager->Draw(instancer);
     if (m_sirenDroneManager)
-        m_sirenDroneManager->Draw(shader);
+        m_sirenDroneManager->Draw(instancer);
 }
 
 void Train::DrawRadars(const Shader& colorShader, DebugRenderer& debugRenderer) const
@@ -4153,8 +3833,7 @@ void Train::Shutdown()
 {
     m_trainStartSound.Stop();
     m_trainRunLoopSound.Stop();
-    m_valveWaterParticles.clear();
-    ShutdownValveWaterGpu();
+    m_valveWater.Clear();
 
     if (m_firstTrain)      m_firstTrain->Shutdown();
     if (m_secondTrain)     m_secondTrain->Shutdown();
@@ -4166,6 +3845,7 @@ void Train::Shutdown()
 
     if (m_skyVAO) { GL::DeleteVertexArrays(1, &m_skyVAO); m_skyVAO = 0; }
     if (m_skyVBO) { GL::DeleteBuffers(1, &m_skyVBO);      m_skyVBO = 0; }
+    m_skyShader.reset();
 
     for (auto& source : m_pulseSources) source.Shutdown();
 
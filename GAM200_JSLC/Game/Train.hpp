@@ -5,6 +5,7 @@
 #include "PulseSource.hpp"
 #include "DroneManager.hpp"
 #include "Robot.hpp"
+#include "../Engine/ParticlePool.hpp"
 #include "../Engine/Sound.hpp"
 #include "../Engine/Vec2.hpp"
 #include <cstdint>
@@ -16,6 +17,8 @@
 namespace Math { class Matrix; }
 
 class Shader;
+class RenderQueue;
+class SpriteInstancer;
 class Player;
 class DebugRenderer;
 struct TrainObjectConfig;
@@ -32,6 +35,9 @@ enum class TrainState { Stationary, Starting, Moving };
 class Train
 {
 public:
+    Train() = default;
+    ~Train(); // m_skyShader: Shader is only complete in Train.cpp
+
     // Map boundaries (WIDTH is sum of loaded car image widths — use GetMapWidth() at runtime)
     static constexpr float HEIGHT = 1080.0f;
     static constexpr float MIN_X  = 24180.0f;
@@ -104,30 +110,29 @@ public:
     // Returns UI text for the departure countdown (empty string when not needed)
     std::string GetDepartureAnnouncementText() const;
 
-    // textureShader: draws train car images + robots (레일 타일은 DrawRailTrack)
+    // Submits train car images, the valve and robots (레일 타일은 DrawRailTrack)
     // viewHalfW: half of currently visible world width (zoom-aware)
-    void Draw(Shader& textureShader, Math::Vec2 cameraPos, float viewHalfW) const;
+    void Draw(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const;
 
-    /// rail.png 타일만 그림. 하늘(DrawBackground) 직후 호출해 다른 맵·차량보다 아래 레이어에 두는 용도.
-    void DrawRailTrack(Shader& textureShader, Math::Vec2 cameraPos, float viewHalfW) const;
+    /// rail.png 타일만 그림. RenderLayer::Rail — 하늘 바로 위, 다른 맵·차량보다 아래 레이어.
+    void DrawRailTrack(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const;
 
-    // Draws sunset sky gradient bands (call before Draw, with colorShader active)
+    // Submits the sunset sky (bands, sun, clouds, skyline) as one full-view quad on RenderLayer::Sky
     // viewHalfW: half of currently visible world width (zoom-aware)
-    void DrawBackground(Shader& colorShader, Math::Vec2 cameraPos, float viewHalfW) const;
+    void DrawBackground(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const;
 
     // 시동된 차량 펄스 라이트(플레이스홀더). 열차 스프라이트 위에 그림.
     void DrawCarTransportVFX(Shader& colorShader, Math::Vec2 cameraPos, float viewHalfW) const;
     // PulseLine / Start 아이콘 (텍스처). 열차 스프라이트에 이미 펄스가 있는 슬롯은 skipPulseLineOverlay로 스킵.
-    void DrawCarTransportOverlays(Shader& textureShader, Math::Vec2 cameraPos, float viewHalfW) const;
-    void DrawValveWaterVFX(Shader& colorShader, const Math::Matrix& worldProjection, Math::Vec2 cameraPos,
-                           float viewHalfW) const;
+    void DrawCarTransportOverlays(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const;
+    void DrawValveWaterVFX(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const;
 
-    void DrawDrones(Shader& shader) const;
+    void DrawDrones(SpriteInstancer& instancer) const;
     void DrawRadars(const Shader& colorShader, DebugRenderer& debugRenderer) const;
     void DrawGauges(Shader& colorShader, DebugRenderer& debugRenderer) const;
     void DrawDebug(Shader& colorShader, DebugRenderer& debugRenderer) const;
     /// SecondTrain 보라 컨테이너 Enter / Leave 프롬프트 (월드 스페이스)
-    void DrawCar2EnterLeavePrompt(Shader& textureShader, Math::Vec2 cameraPos, float viewHalfW) const;
+    void DrawCar2EnterLeavePrompt(RenderQueue& queue, Math::Vec2 cameraPos, float viewHalfW) const;
     /// ThirdTrain 사이렌 파동 (solid_color)
     void DrawCar3SirenWaves(Shader& colorShader, Math::Vec2 cameraPos, float viewHalfW) const;
     /// ThirdTrain 사이렌 펄스 차단 진행 — Room 충전소 남은 양 바와 같은 스타일, 사이렌 옆 월드 좌표 (solid_color)
@@ -291,9 +296,10 @@ private:
     // Hiding spots (move with train, same local-space as TrainHitbox)
     std::vector<HidingSpot> m_hidingSpots;
 
-    // Sky gradient geometry (filled quads via solid_color shader)
+    // Unit quad for DrawFilledQuad (solid_color) and the sky pass (train_sky)
     unsigned int m_skyVAO = 0;
     unsigned int m_skyVBO = 0;
+    std::unique_ptr<Shader> m_skyShader;
 
     // Config-driven obstacles / pulse sources (retain for JSON hot-reload)
     std::unique_ptr<DroneManager>  m_droneManager;
@@ -313,9 +319,6 @@ private:
                         float thickness,
                         float r, float g, float b, float a = 1.0f) const;
 
-    void InitValveWaterGpu();
-    void ShutdownValveWaterGpu();
-    void UploadAndDrawValveWaterGpu(const Math::Matrix& projection, Math::Vec2 cameraPos, float viewHalfW) const;
     void ApplyValveWaterDamageToEnemies(float dt);
 
     void ApplyTrainMotionToDronesAndRobots(float deltaTrainX);
@@ -391,39 +394,11 @@ private:
     float      m_valveParticleSpawnCarry = 0.0f;
     std::uint32_t m_valveParticleCounter = 0;
 
-    struct ValveWaterParticle
-    {
-        Math::Vec2 pos{};
-        Math::Vec2 vel{};
-        Math::Vec2 size{};
-        float life = 0.0f;
-        float maxLife = 0.0f;
-        float alpha = 0.0f;
-    };
-    std::vector<ValveWaterParticle> m_valveWaterParticles;
-    /// 스플래시 스폰용(프레임마다 vector 재할당 방지)
-    std::vector<ValveWaterParticle> m_valveSplashScratch;
     static constexpr std::size_t kMaxValveWaterParticles = 720;
-
-    // GPU-instanced valve water rendering (single draw call; avoids CPU quad loops)
-    struct ValveWaterGpuInstance
-    {
-        Math::Vec2 center{};
-        Math::Vec2 halfSize{};
-        float alpha = 0.0f;
-        float layer = 0.0f; // 0 body, 1 core, 2 shadow
-        float pad0 = 0.0f;
-        float pad1 = 0.0f;
-    };
-
-    bool          m_valveWaterGpuReady = false;
-    unsigned int  m_valveWaterProg = 0;
-    int           m_valveWaterLocProjection = -1;
-    unsigned int  m_valveWaterVAO = 0;
-    unsigned int  m_valveWaterQuadVBO = 0;
-    unsigned int  m_valveWaterInstVBO = 0;
-    mutable std::uint32_t m_valveWaterInstPoolBytes = 0;
-    mutable std::vector<ValveWaterGpuInstance> m_valveWaterGpuScratch;
+    /// 밸브 물줄기 파티클 (SoA 링 버퍼 — 가득 차면 가장 오래된 슬롯 재사용)
+    ParticlePool m_valveWater{ kMaxValveWaterParticles };
+    /// 스플래시 스폰용(프레임마다 vector 재할당 방지)
+    std::vector<ParticlePool::Spawn> m_valveSplashScratch;
 
     // FourthTrain (Car5 tank car): scripted drones / robots — idle until player steps on deck
     TrainHitbox       m_car5DeckHb{};
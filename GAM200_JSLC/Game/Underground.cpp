@@ -7,8 +7,10 @@
 #include "../OpenGL/Shader.hpp"
 #include "../Engine/Matrix.hpp"
 #include "../Engine/DebugRenderer.hpp"
+#include "../Engine/RenderQueue.hpp"
 #include "../Engine/Collision.hpp"
 #include "MapObjectConfig.hpp"
+#include "RenderLayers.hpp"
 #include <algorithm>
 #include <cmath>
 #include <unordered_map>
@@ -236,6 +238,24 @@ void Underground::ApplyConfig(const UndergroundObjectConfig& cfg)
         float cy = MIN_Y + (HEIGHT - r.topLeft.y) - r.size.y * 0.5f;
         m_ramps.push_back({ {cx, cy}, r.size, true });
     }
+
+    RebuildStaticLayer();
+}
+
+void Underground::RebuildStaticLayer()
+{
+    m_staticLayer.Clear();
+    m_staticLayer.Add(m_background.get(), Math::Matrix::CreateTranslation(m_position) * Math::Matrix::CreateScale(m_size));
+    for (const auto& lit : m_lights)
+    {
+        if (lit.sprite)
+            m_staticLayer.Add(lit.sprite.get(), Math::Matrix::CreateTranslation(lit.pos) * Math::Matrix::CreateScale(lit.size));
+    }
+    for (const auto& obs : m_obstacles)
+    {
+        if (obs.sprite)
+            m_staticLayer.Add(obs.sprite.get(), Math::Matrix::CreateTranslation(obs.pos) * Math::Matrix::CreateScale(obs.size));
+    }
 }
 
 void Underground::Update(double dt, Player& player, Math::Vec2 playerHitboxSize)
@@ -429,47 +449,27 @@ void Underground::Update(double dt, Player& player, Math::Vec2 playerHitboxSize)
     }
 }
 
-void Underground::Draw(Shader& shader) const
+void Underground::Draw(RenderQueue& queue) const
 {
-    // Draw background
-    Math::Matrix model = Math::Matrix::CreateTranslation(m_position) * Math::Matrix::CreateScale(m_size);
-    shader.setMat4("model", model);
-    m_background->Draw(shader, model);
-
-    shader.setVec4("spriteRect", 0.0f, 0.0f, 1.0f, 1.0f);
-    shader.setBool("flipX", false);
-    for (const auto& lit : m_lights)
-    {
-        if (!lit.sprite) continue;
-        Math::Matrix lightModel = Math::Matrix::CreateTranslation(lit.pos) * Math::Matrix::CreateScale(lit.size);
-        shader.setMat4("model", lightModel);
-        lit.sprite->Draw(shader, lightModel);
-    }
-
-    for (const auto& obs : m_obstacles)
-    {
-        if (!obs.sprite) continue;
-        Math::Matrix obsModel = Math::Matrix::CreateTranslation(obs.pos) * Math::Matrix::CreateScale(obs.size);
-        shader.setMat4("model", obsModel);
-        obs.sprite->Draw(shader, obsModel);
-    }
+    // Background, lights and obstacles (pre-composited)
+    m_staticLayer.Draw(queue, RenderLayer::MapBackground);
 
     for (const auto& source : m_pulseSources)
     {
         if (source.HasSprite())
-            source.DrawSprite(shader);
+            source.DrawSprite(queue, RenderLayer::MapProp);
     }
 
     // Draw enemies
     for (const auto& robot : m_robots)
     {
-        robot.Draw(shader);
+        robot.Draw(queue, RenderLayer::MapActor);
     }
 }
 
-void Underground::DrawDrones(Shader& shader) const
+void Underground::DrawDrones(SpriteInstancer& instancer) const
 {
-    m_droneManager->Draw(shader);
+    m_droneManager->Draw(instancer);
 }
 
 void Underground::DrawRadars(const Shader& colorShader, DebugRenderer& debugRenderer) const
@@ -586,6 +586,7 @@ void Underground::RefillPulseSourcesAfterCheckpointRespawn()
 
 void Underground::Shutdown()
 {
+    m_staticLayer.Shutdown();
     if (m_background) m_background->Shutdown();
     if (m_droneManager) m_droneManager->Shutdown();
 
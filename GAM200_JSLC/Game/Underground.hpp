@@ -5,9 +5,12 @@
 #include "../Game/PulseSource.hpp"
 #include "Background.hpp"
 #include "Robot.hpp"
+#include "StaticLayerCache.hpp"
 #include <memory>
 #include <vector>
 class Shader;
+class RenderQueue;
+class SpriteInstancer;
 class Player;
 class DroneManager;
 class Drone;
@@ -48,8 +51,8 @@ public:
     void ReapplyEntryTracerDroneAfterLiveState();
     void ApplyConfig(const UndergroundObjectConfig& cfg);
     void Update(double dt, Player& player, Math::Vec2 playerHitboxSize);
-    void Draw(Shader& shader) const;
-    void DrawDrones(Shader& shader) const;
+    void Draw(RenderQueue& queue) const;
+    void DrawDrones(SpriteInstancer& instancer) const;
     void DrawRadars(const Shader& colorShader, DebugRenderer& debugRenderer) const;
     void DrawGauges(Shader& colorShader, DebugRenderer& debugRenderer) const;
     void DrawDebug(Shader& colorShader, DebugRenderer& debugRenderer) const;
@@ -74,7 +77,11 @@ public:
     bool IsPointOverConfiguredGeometry(Math::Vec2 worldPos, Math::Vec2 cursorHitboxSize) const;
 
 private:
+    /// Background, light overlays and obstacle sprites, composited once per config load.
+    void RebuildStaticLayer();
+
     std::unique_ptr<Background> m_background;
+    mutable StaticLayerCache m_staticLayer; // tiles are baked lazily from Draw
     Math::Vec2 m_position;
     Math::Vec2 m_size;
     std::unique_ptr<DroneManager> m_droneManager;
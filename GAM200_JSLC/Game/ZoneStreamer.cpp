@@ -0,0 +1,106 @@
+//ZoneStreamer.cpp
+
+#include "ZoneStreamer.hpp"
+#include "Background.hpp"
+#include "../Engine/Logger.hpp"
+#include <algorithm>
+
+ZoneStreamer& ZoneStreamer::Instance()
+{
+    static ZoneStreamer instance;
+    return instance;
+}
+
+void ZoneStreamer::Reset(unsigned int residentMask)
+{
+    for (int i = 0; i < MAX_ZONES; ++i)
+    {
+        m_zones[i].sprites.clear();
+        m_zones[i].resident = (residentMask & (1u << i)) != 0;
+    }
+    m_captureZone = -1;
+    m_loads = 0;
+    m_evictions = 0;
+}
+
+void ZoneStreamer::BeginCapture(int zone)
+{
+    if (zone < 0 || zone >= MAX_ZONES)
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "ZoneStreamer: invalid capture zone %d", zone);
+        return;
+    }
+    m_captureZone = zone;
+}
+
+void ZoneStreamer::EndCapture()
+{
+    m_captureZone = -1;
+}
+
+void ZoneStreamer::SetResident(int zone, bool resident)
+{
+    if (zone < 0 || zone >= MAX_ZONES)
+        return;
+
+    Zone& z = m_zones[zone];
+    if (z.resident == resident)
+        return;
+    z.resident = resident;
+
+    for (Background* sprite : z.sprites)
+    {
+        if (resident)
+            sprite->AcquireStreamedTexture();
+        else
+            sprite->ReleaseStreamedTexture();
+    }
+
+    if (resident)
+        ++m_loads;
+    else
+        ++m_evictions;
+    Logger::Instance().Log(Logger::Severity::Info, "ZoneStreamer: zone %d %s (%d sprites)",
+        zone, resident ? "streamed in" : "evicted", static_cast<int>(z.sprites.size()));
+}
+
+bool ZoneStreamer::IsResident(int zone) const
+{
+    if (zone < 0 || zone >= MAX_ZONES)
+        return true;
+    return m_zones[zone].resident;
+}
+
+void ZoneStreamer::Register(Background* sprite, int zone)
+{
+    if (zone < 0 || zone >= MAX_ZONES)
+        return;
+    m_zones[zone].sprites.push_back(sprite);
+}
+
+void ZoneStreamer::Unregister(Background* sprite, int zone)
+{
+    if (zone < 0 || zone >= MAX_ZONES)
+        return;
+    auto& sprites = m_zones[zone].sprites;
+    sprites.erase(std::remove(sprites.begin(), sprites.end(), sprite), sprites.end());
+}
+
+ZoneStreamer::Stats ZoneStreamer::GetStats() const
+{
+    Stats stats;
+    for (const Zone& z : m_zones)
+    {
+        if (z.resident && !z.sprites.empty())
+            ++stats.residentZones;
+        stats.sprites += static_cast<int>(z.sprites.size());
+        for (const Background* sprite : z.sprites)
+        {
+            if (sprite->GetTextureID() != 0)
+                ++stats.residentSprites;
+        }
+    }
+    stats.loads = m_loads;
+    stats.evictions = m_evictions;
+    return stats;
+}
@@ -0,0 +1,66 @@
+//ZoneStreamer.hpp
+
+#pragma once
+#include <array>
+#include <vector>
+
+class Background;
+
+/**
+ * @brief Keeps only the map textures of zones near the player resident.
+ *
+ * Every Background initialized between BeginCapture(zone) and EndCapture() is tagged with that
+ * zone. SetResident(zone, false) releases the group's textures while sizes, layout, collision and
+ * AI stay untouched; SetResident(zone, true) re-acquires them through AssetCache. Sprites created
+ * while their zone is not resident only read the PNG header, so far zones cost nothing at startup.
+ */
+class ZoneStreamer
+{
+public:
+    static constexpr int MAX_ZONES = 8;
+
+    struct Stats
+    {
+        int residentZones = 0;
+        int sprites = 0;
+        int residentSprites = 0;
+        int loads = 0;     // zone stream-in events since Reset
+        int evictions = 0; // zone stream-out events since Reset
+    };
+
+    static ZoneStreamer& Instance();
+
+    /// Forgets every sprite; zones whose bit is set in residentMask start resident.
+    void Reset(unsigned int residentMask);
+
+    void BeginCapture(int zone);
+    void EndCapture();
+    /// Zone currently capturing new sprites, or -1.
+    int GetCaptureZone() const { return m_captureZone; }
+
+    void SetResident(int zone, bool resident);
+    bool IsResident(int zone) const;
+
+    // Background bookkeeping
+    void Register(Background* sprite, int zone);
+    void Unregister(Background* sprite, int zone);
+
+    Stats GetStats() const;
+
+    ZoneStreamer(const ZoneStreamer&) = delete;
+    void operator=(const ZoneStreamer&) = delete;
+
+private:
+    ZoneStreamer() = default;
+
+    struct Zone
+    {
+        std::vector<Background*> sprites;
+        bool resident = true;
+    };
+
+    std::array<Zone, MAX_ZONES> m_zones;
+    int m_captureZone = -1;
+    int m_loads = 0;
+    int m_evictions = 0;
+};
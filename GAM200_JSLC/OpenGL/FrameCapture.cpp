@@ -0,0 +1,306 @@
+//FrameCapture.cpp
+
+#include "FrameCapture.hpp"
+#include "GLWrapper.hpp"
+#include "../Engine/Logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <utility>
+
+#pragma warning(push, 0)
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+#pragma warning(pop)
+
+#if defined(_WIN32)
+#define popen _popen
+#define pclose _pclose
+#endif
+
+namespace
+{
+    // A fence PBO_COUNT frames old is long done; the timeout only guards against a lost context.
+    constexpr GLuint64 FENCE_WAIT_TIMEOUT_NS = 1000000000ull;
+}
+
+bool FrameCapture::Start(const FrameCaptureSettings& settings)
+{
+#if defined(__EMSCRIPTEN__)
+    (void)settings;
+    Logger::Instance().Log(Logger::Severity::Error, "FrameCapture: not available in the web build");
+    return false;
+#else
+    if (m_active)
+        return true;
+
+    m_settings = settings;
+    m_settings.stride = std::max(m_settings.stride, 1);
+
+    if (!m_settings.pipeCommand.empty())
+    {
+#if defined(_WIN32)
+        m_pipe = popen(m_settings.pipeCommand.c_str(), "wb");
+#else
+        m_pipe = popen(m_settings.pipeCommand.c_str(), "w");
+#endif
+        if (!m_pipe)
+        {
+            Logger::Instance().Log(Logger::Severity::Error, "FrameCapture: could not run '%s'", m_settings.pipeCommand.c_str());
+            return false;
+        }
+        m_pipeWidth = 0;
+        m_pipeHeight = 0;
+    }
+    else
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(m_settings.directory, ec);
+        if (ec)
+        {
+            Logger::Instance().Log(Logger::Severity::Error, "FrameCapture: could not create %s (%s)",
+                m_settings.directory.c_str(), ec.message().c_str());
+            return false;
+        }
+    }
+
+    for (Slot& slot : m_slots)
+    {
+        slot = Slot{};
+        GL::GenBuffers(1, &slot.pbo);
+    }
+    m_nextSlot = 0;
+    m_frameCounter = 0;
+    m_nameIndex = 0;
+    m_paused = false;
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stats = Stats{};
+        m_stopWriter = false;
+    }
+    m_writer = std::thread(&FrameCapture::WriterThreadMain, this);
+    m_active = true;
+
+    if (m_pipe)
+        Logger::Instance().Log(Logger::Severity::Info, "FrameCapture: piping every %d frame(s) to '%s'", m_settings.stride, m_settings.pipeCommand.c_str());
+    else
+        Logger::Instance().Log(Logger::Severity::Info, "FrameCapture: writing every %d frame(s) to %s", m_settings.stride, m_settings.directory.c_str());
+    return true;
+#endif
+}
+
+void FrameCapture::Stop()
+{
+    if (!m_active)
+        return;
+
+    // Oldest first, so the writer receives them in capture order.
+    for (int i = 0; i < PBO_COUNT; ++i)
+    {
+        Slot& slot = m_slots[(m_nextSlot + i) % PBO_COUNT];
+        if (slot.pending)
+            Resolve(slot);
+    }
+    for (Slot& slot : m_slots)
+    {
+        GL::DeleteBuffers(1, &slot.pbo);
+        slot = Slot{};
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stopWriter = true;
+    }
+    m_jobReady.notify_all();
+    if (m_writer.joinable())
+        m_writer.join();
+
+    if (m_pipe)
+    {
+        pclose(m_pipe);
+        m_pipe = nullptr;
+    }
+    m_freeBuffers.clear();
+    m_active = false;
+
+    const Stats stats = GetStats();
+    Logger::Instance().Log(Logger::Severity::Event,
+        "FrameCapture: %d captured, %d written, %d dropped, %d failed (main thread peak %.2f ms)",
+        stats.captured, stats.written, stats.dropped, stats.failed, stats.peakMainMs);
+}
+
+void FrameCapture::SetNamePrefix(const std::string& prefix)
+{
+    m_namePrefix = prefix;
+    m_nameIndex = 0;
+}
+
+void FrameCapture::Capture(int x, int y, int width, int height)
+{
+    if (!m_active || m_paused || width <= 0 || height <= 0)
+        return;
+
+    const auto start = std::chrono::steady_clock::now();
+    PollSlots();
+
+    const long long frame = m_frameCounter++;
+    const int nameIndex = m_nameIndex++;
+    if (frame % m_settings.stride == 0)
+    {
+        Slot& slot = m_slots[m_nextSlot];
+        if (slot.pending)
+            Resolve(slot); // ring wrapped before the fence signalled: this is the only place Capture waits
+
+        const size_t bytes = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+        GL::BindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+        if (slot.capacity != bytes)
+        {
+            GL::BufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(bytes), nullptr, GL_STREAM_READ);
+            slot.capacity = bytes;
+        }
+        // With a pack buffer bound the last argument is an offset; the call returns without waiting.
+        GL::ReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        GL::BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot.fence = GL::FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot.width = width;
+        slot.height = height;
+        slot.pending = true;
+
+        char name[96];
+        std::snprintf(name, sizeof(name), "%s_%06d", m_namePrefix.c_str(), nameIndex);
+        slot.name = name;
+
+        m_nextSlot = (m_nextSlot + 1) % PBO_COUNT;
+    }
+
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    m_stats.lastMainMs = ms;
+    m_stats.peakMainMs = std::max(m_stats.peakMainMs, ms);
+}
+
+FrameCapture::Stats FrameCapture::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    return m_stats;
+}
+
+void FrameCapture::PollSlots()
+{
+    // Oldest first; stop at the first unfinished fence so frames reach the writer in order.
+    for (int i = 0; i < PBO_COUNT; ++i)
+    {
+        Slot& slot = m_slots[(m_nextSlot + i) % PBO_COUNT];
+        if (!slot.pending)
+            continue;
+        const GLenum status = GL::ClientWaitSync(static_cast<GLsync>(slot.fence), 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            break;
+        Resolve(slot);
+    }
+}
+
+void FrameCapture::Resolve(Slot& slot)
+{
+    if (slot.fence)
+    {
+        GL::ClientWaitSync(static_cast<GLsync>(slot.fence), GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_WAIT_TIMEOUT_NS);
+        GL::DeleteSync(static_cast<GLsync>(slot.fence));
+        slot.fence = nullptr;
+    }
+    slot.pending = false;
+
+    const size_t bytes = static_cast<size_t>(slot.width) * static_cast<size_t>(slot.height) * 4;
+    Job job;
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        ++m_stats.captured;
+        if (static_cast<int>(m_jobs.size()) >= MAX_QUEUED_FRAMES)
+        {
+            ++m_stats.dropped;
+            return;
+        }
+        if (!m_freeBuffers.empty())
+        {
+            job.pixels = std::move(m_freeBuffers.back());
+            m_freeBuffers.pop_back();
+        }
+    }
+    job.pixels.resize(bytes);
+    job.width = slot.width;
+    job.height = slot.height;
+    job.name = std::move(slot.name);
+
+    GL::BindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+    const void* mapped = GL::MapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(bytes), GL_MAP_READ_BIT);
+    if (mapped)
+    {
+        std::memcpy(job.pixels.data(), mapped, bytes);
+        GL::UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    GL::BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    if (!mapped)
+    {
+        ++m_stats.failed;
+        m_freeBuffers.push_back(std::move(job.pixels));
+        return;
+    }
+    m_jobs.push_back(std::move(job));
+    m_jobReady.notify_one();
+}
+
+void FrameCapture::WriterThreadMain()
+{
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_jobReady.wait(lock, [this] { return m_stopWriter || !m_jobs.empty(); });
+            if (m_jobs.empty())
+                return; // stopping, and the queue is drained
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        const bool sizeMismatch = m_pipe && m_pipeWidth != 0 && (job.width != m_pipeWidth || job.height != m_pipeHeight);
+        const bool written = !sizeMismatch && WriteJob(job);
+
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        if (written)
+            ++m_stats.written;
+        else if (sizeMismatch)
+            ++m_stats.dropped;
+        else
+            ++m_stats.failed;
+        m_freeBuffers.push_back(std::move(job.pixels));
+    }
+}
+
+bool FrameCapture::WriteJob(Job& job)
+{
+    // A window ignores destination alpha; an image viewer or encoder would not.
+    for (size_t i = 3; i < job.pixels.size(); i += 4)
+        job.pixels[i] = 255;
+
+    const size_t rowBytes = static_cast<size_t>(job.width) * 4;
+    if (m_pipe)
+    {
+        m_pipeWidth = job.width;
+        m_pipeHeight = job.height;
+        // GL rows are bottom-up; raw video consumers (ffmpeg -f rawvideo) expect top-down.
+        for (int row = job.height - 1; row >= 0; --row)
+        {
+            if (std::fwrite(job.pixels.data() + static_cast<size_t>(row) * rowBytes, 1, rowBytes, m_pipe) != rowBytes)
+                return false;
+        }
+        return std::fflush(m_pipe) == 0;
+    }
+
+    const std::string path = (std::filesystem::path(m_settings.directory) / (job.name + ".png")).string();
+    stbi_flip_vertically_on_write(1);
+    return stbi_write_png(path.c_str(), job.width, job.height, 4, job.pixels.data(), static_cast<int>(rowBytes)) != 0;
+}
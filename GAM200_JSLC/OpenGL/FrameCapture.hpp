@@ -0,0 +1,114 @@
+//FrameCapture.hpp
+
+#pragma once
+#include <array>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct FrameCaptureSettings
+{
+    std::string directory = "captures"; // PNG output: <directory>/<prefix>_<index>.png
+    std::string pipeCommand;            // non-empty: raw RGBA8 frames (top row first) to this command's stdin instead
+    int stride = 1;                     // capture every Nth frame
+};
+
+/**
+ * @brief Video/screenshot capture that keeps glReadPixels off the critical path.
+ *
+ * Each captured frame is read into one of PBO_COUNT pixel-pack buffers and fenced; the buffer is
+ * mapped once its fence has signalled (normally the next frame or two) or, at the latest, when the
+ * ring comes back around to it. The mapped pixels are copied into a pooled buffer and handed to a
+ * writer thread, which does the PNG encoding or pipe write. The main thread pays for the copy only.
+ *
+ * If the writer falls MAX_QUEUED_FRAMES behind, new frames are dropped rather than queued (counted
+ * in Stats). Pipe output keeps the size of the first frame; frames of another size are dropped.
+ * Not available on the web build (no threads, and WebGL2 can't map buffers).
+ */
+class FrameCapture
+{
+public:
+    static constexpr int PBO_COUNT = 3;
+    static constexpr int MAX_QUEUED_FRAMES = 8;
+
+    struct Stats
+    {
+        int captured = 0; // read into a PBO
+        int written = 0;
+        int dropped = 0;  // writer queue full or size mismatch
+        int failed = 0;   // map or write error
+        double lastMainMs = 0.0; // main-thread cost of the last Capture()
+        double peakMainMs = 0.0;
+    };
+
+    FrameCapture() = default;
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+    ~FrameCapture() { Stop(); }
+
+    bool Start(const FrameCaptureSettings& settings);
+    /// Reads back outstanding PBOs and waits for the writer to finish the queue. Needs the GL context.
+    void Stop();
+    bool IsActive() const { return m_active; }
+
+    /// Names subsequent PNGs <prefix>_000000.png onwards.
+    void SetNamePrefix(const std::string& prefix);
+    /// Paused frames neither capture nor count towards the stride.
+    void SetPaused(bool paused) { m_paused = paused; }
+
+    /// Reads the given region of the bound read framebuffer. Call once per presented frame.
+    void Capture(int x, int y, int width, int height);
+
+    Stats GetStats() const;
+
+private:
+    struct Slot
+    {
+        unsigned int pbo = 0;
+        void* fence = nullptr; // GLsync
+        size_t capacity = 0;
+        int width = 0;
+        int height = 0;
+        std::string name;
+        bool pending = false;
+    };
+
+    struct Job
+    {
+        std::vector<unsigned char> pixels; // bottom row first, as read
+        int width = 0;
+        int height = 0;
+        std::string name;
+    };
+
+    void PollSlots();
+    void Resolve(Slot& slot);
+    void WriterThreadMain();
+    bool WriteJob(Job& job);
+
+    FrameCaptureSettings m_settings{};
+    bool m_active = false;
+    bool m_paused = false;
+    std::array<Slot, PBO_COUNT> m_slots{};
+    int m_nextSlot = 0;
+    long long m_frameCounter = 0;
+    int m_nameIndex = 0;
+    std::string m_namePrefix = "frame";
+
+    // Only the writer thread touches these after Start().
+    std::FILE* m_pipe = nullptr;
+    int m_pipeWidth = 0;
+    int m_pipeHeight = 0;
+
+    std::thread m_writer;
+    mutable std::mutex m_queueMutex;
+    std::condition_variable m_jobReady;
+    std::deque<Job> m_jobs;
+    std::vector<std::vector<unsigned char>> m_freeBuffers;
+    Stats m_stats{};
+    bool m_stopWriter = false;
+};
@@ -32,88 +32,232 @@
 
 namespace GL
 {
+    // -------------------------------------------------------------------------
+    // Null Backend
+    // Headless simulation runs without a context: every wrapper below turns into a no-op
+    // and hands back fake non-zero handles / success statuses so loading code is unchanged.
+    // -------------------------------------------------------------------------
+    inline bool& NullBackendFlag() { static bool enabled = false; return enabled; }
+    static inline void SetNullBackend(bool enabled) { NullBackendFlag() = enabled; }
+    static inline bool IsNullBackend() { return NullBackendFlag(); }
+    inline GLuint NextNullHandle() { static GLuint next = 0; return ++next; }
+    static inline void FillNullHandles(GLsizei n, GLuint* handles) { for (GLsizei i = 0; i < n; ++i) handles[i] = NextNullHandle(); }
+
+    // -------------------------------------------------------------------------
+    // Redundant State Filter
+    // Shadows the binds that sprite code re-issues every draw (program, VAO, 2D texture per unit,
+    // blend enable / func) so repeats never reach the driver. Code that changes GL state outside
+    // these wrappers (ImGui backend, context switches) must call InvalidateStateCache() afterwards.
+    // -------------------------------------------------------------------------
+    constexpr GLuint UNKNOWN_BINDING = 0xFFFFFFFFu;
+    constexpr int MAX_CACHED_TEXTURE_UNITS = 8;
+
+    struct StateStats
+    {
+        int issued = 0; // filtered calls that reached the driver
+        int elided = 0; // filtered calls skipped because the value was already set
+    };
+
+    struct StateCache
+    {
+        GLuint program = UNKNOWN_BINDING;
+        GLuint vertexArray = UNKNOWN_BINDING;
+        GLenum activeTexture = 0; // 0 = unknown
+        GLuint texture2D[MAX_CACHED_TEXTURE_UNITS] = { UNKNOWN_BINDING, UNKNOWN_BINDING, UNKNOWN_BINDING, UNKNOWN_BINDING,
+                                                       UNKNOWN_BINDING, UNKNOWN_BINDING, UNKNOWN_BINDING, UNKNOWN_BINDING };
+        int blendEnabled = -1; // -1 = unknown
+        GLenum blendSrc = 0;
+        GLenum blendDst = 0;   // 0/0 = unknown (GL_ZERO/GL_ZERO is never used here)
+        StateStats stats;
+    };
+
+    inline StateCache& GetStateCache() { static StateCache cache; return cache; }
+    static inline void InvalidateStateCache() { const StateStats stats = GetStateCache().stats; GetStateCache() = StateCache{}; GetStateCache().stats = stats; }
+    static inline const StateStats& GetStateStats() { return GetStateCache().stats; }
+    static inline void ResetStateStats() { GetStateCache().stats = {}; }
+
+    /// Returns true (and counts an elided call) if value already matches; otherwise stores it and counts an issued call.
+    template <typename T>
+    static inline bool SkipIfCached(T& cached, T value)
+    {
+        StateCache& cache = GetStateCache();
+        if (cached == value) { ++cache.stats.elided; return true; }
+        cached = value;
+        ++cache.stats.issued;
+        return false;
+    }
+
+    static inline GLuint* CachedTexture2DSlot()
+    {
+        StateCache& cache = GetStateCache();
+        if (cache.activeTexture < GL_TEXTURE0) return nullptr;
+        const GLenum unit = cache.activeTexture - GL_TEXTURE0;
+        return unit < static_cast<GLenum>(MAX_CACHED_TEXTURE_UNITS) ? &cache.texture2D[unit] : nullptr;
+    }
+
     // -------------------------------------------------------------------------
     // Buffer & Vertex Array Objects (VAO/VBO)
     // -------------------------------------------------------------------------
-    static inline void GenVertexArrays(GLsizei n, GLuint* arrays) { glGenVertexArrays(n, arrays); }
-    static inline void GenBuffers(GLsizei n, GLuint* buffers) { glGenBuffers(n, buffers); }
-    static inline void BindVertexArray(GLuint array) { glBindVertexArray(array); }
-    static inline void BindBuffer(GLenum target, GLuint buffer) { glBindBuffer(target, buffer); }
-    static inline void BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) { glBufferData(target, size, data, usage); }
-    static inline void BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) { glBufferSubData(target, offset, size, data); }
-    static inline void VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) { glVertexAttribPointer(index, size, type, normalized, stride, pointer); }
-    static inline void EnableVertexAttribArray(GLuint index) { glEnableVertexAttribArray(index); }
-    static inline void VertexAttribDivisor(GLuint index, GLuint divisor) { glVertexAttribDivisor(index, divisor); }
-    static inline void DeleteVertexArrays(GLsizei n, const GLuint* arrays) { glDeleteVertexArrays(n, arrays); }
-    static inline void DeleteBuffers(GLsizei n, const GLuint* buffers) { glDeleteBuffers(n, buffers); }
+    static inline void GenVertexArrays(GLsizei n, GLuint* arrays) { if (IsNullBackend()) { FillNullHandles(n, arrays); return; } glGenVertexArrays(n, arrays); }
+    static inline void GenBuffers(GLsizei n, GLuint* buffers) { if (IsNullBackend()) { FillNullHandles(n, buffers); return; } glGenBuffers(n, buffers); }
+    static inline void BindVertexArray(GLuint array) { if (IsNullBackend()) return; if (SkipIfCached(GetStateCache().vertexArray, array)) return; glBindVertexArray(array); }
+    static inline void BindBuffer(GLenum target, GLuint buffer) { if (IsNullBackend()) return; glBindBuffer(target, buffer); }
+    static inline void BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) { if (IsNullBackend()) return; glBufferData(target, size, data, usage); }
+    static inline void BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) { if (IsNullBackend()) return; glBufferSubData(target, offset, size, data); }
+    static inline void VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) { if (IsNullBackend()) return; glVertexAttribPointer(index, size, type, normalized, stride, pointer); }
+    static inline void EnableVertexAttribArray(GLuint index) { if (IsNullBackend()) return; glEnableVertexAttribArray(index); }
+    static inline void VertexAttribDivisor(GLuint index, GLuint divisor) { if (IsNullBackend()) return; glVertexAttribDivisor(index, divisor); }
+    static inline void DeleteVertexArrays(GLsizei n, const GLuint* arrays)
+    {
+        if (IsNullBackend()) return;
+        // Deleting the bound VAO reverts the binding to 0; the name may be handed out again.
+        for (GLsizei i = 0; i < n; ++i)
+            if (GetStateCache().vertexArray == arrays[i]) GetStateCache().vertexArray = 0;
+        glDeleteVertexArrays(n, arrays);
+    }
+    static inline void DeleteBuffers(GLsizei n, const GLuint* buffers) { if (IsNullBackend()) return; glDeleteBuffers(n, buffers); }
+    // Null backend has no storage to map: callers must handle nullptr.
+    static inline void* MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { if (IsNullBackend()) return nullptr; return glMapBufferRange(target, offset, length, access); }
+    static inline GLboolean UnmapBuffer(GLenum target) { if (IsNullBackend()) return GL_TRUE; return glUnmapBuffer(target); }
 
     // -------------------------------------------------------------------------
     // Drawing Commands
     // -------------------------------------------------------------------------
-    static inline void DrawArrays(GLenum mode, GLint first, GLsizei count) { glDrawArrays(mode, first, count); }
-    static inline void DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { glDrawArraysInstanced(mode, first, count, instancecount); }
-    static inline void DrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) { glDrawElements(mode, count, type, indices); }
+    static inline void DrawArrays(GLenum mode, GLint first, GLsizei count) { if (IsNullBackend()) return; glDrawArrays(mode, first, count); }
+    static inline void DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { if (IsNullBackend()) return; glDrawArraysInstanced(mode, first, count, instancecount); }
+    static inline void DrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) { if (IsNullBackend()) return; glDrawElements(mode, count, type, indices); }
 
     // -------------------------------------------------------------------------
     // Global State & Context
     // -------------------------------------------------------------------------
-    static inline void Enable(GLenum cap) { glEnable(cap); }
-    static inline void Disable(GLenum cap) { glDisable(cap); }
-    static inline void BlendFunc(GLenum sfactor, GLenum dfactor) { glBlendFunc(sfactor, dfactor); }
-    static inline void ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { glClearColor(red, green, blue, alpha); }
-    static inline void Clear(GLbitfield mask) { glClear(mask); }
-    static inline const GLubyte* GetString(GLenum name) { return glGetString(name); }
-    static inline void Viewport(GLint x, GLint y, GLsizei width, GLsizei height) { glViewport(x, y, width, height); }
+    static inline void Enable(GLenum cap) { if (IsNullBackend()) return; if (cap == GL_BLEND && SkipIfCached(GetStateCache().blendEnabled, 1)) return; glEnable(cap); }
+    static inline void Disable(GLenum cap) { if (IsNullBackend()) return; if (cap == GL_BLEND && SkipIfCached(GetStateCache().blendEnabled, 0)) return; glDisable(cap); }
+    static inline void BlendFunc(GLenum sfactor, GLenum dfactor)
+    {
+        if (IsNullBackend()) return;
+        StateCache& cache = GetStateCache();
+        if (cache.blendSrc == sfactor && cache.blendDst == dfactor) { ++cache.stats.elided; return; }
+        cache.blendSrc = sfactor;
+        cache.blendDst = dfactor;
+        ++cache.stats.issued;
+        glBlendFunc(sfactor, dfactor);
+    }
+    // The cache only tracks a single src/dst pair, so a split func leaves it unknown.
+    static inline void BlendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+    {
+        if (IsNullBackend()) return;
+        StateCache& cache = GetStateCache();
+        cache.blendSrc = 0;
+        cache.blendDst = 0;
+        ++cache.stats.issued;
+        glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+    }
+    static inline void ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { if (IsNullBackend()) return; glClearColor(red, green, blue, alpha); }
+    static inline void Clear(GLbitfield mask) { if (IsNullBackend()) return; glClear(mask); }
+    static inline const GLubyte* GetString(GLenum name) { if (IsNullBackend()) return reinterpret_cast<const GLubyte*>("null backend"); return glGetString(name); }
+    static inline void Viewport(GLint x, GLint y, GLsizei width, GLsizei height) { if (IsNullBackend()) return; glViewport(x, y, width, height); }
+    // Null backend leaves params as the caller initialised them.
+    static inline void GetIntegerv(GLenum pname, GLint* params) { if (IsNullBackend()) return; glGetIntegerv(pname, params); }
 
     // -------------------------------------------------------------------------
     // Texture Management
     // -------------------------------------------------------------------------
-    static inline void GenTextures(GLsizei n, GLuint* textures) { glGenTextures(n, textures); }
-    static inline void BindTexture(GLenum target, GLuint texture) { glBindTexture(target, texture); }
-    static inline void TexParameteri(GLenum target, GLenum pname, GLint param) { glTexParameteri(target, pname, param); }
-    static inline void TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels) { glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels); }
-    static inline void GenerateMipmap(GLenum target) { glGenerateMipmap(target); }
-    static inline void ActiveTexture(GLenum texture) { glActiveTexture(texture); }
-    static inline void DeleteTextures(GLsizei n, const GLuint* textures) { glDeleteTextures(n, textures); }
+    static inline void GenTextures(GLsizei n, GLuint* textures) { if (IsNullBackend()) { FillNullHandles(n, textures); return; } glGenTextures(n, textures); }
+    static inline void BindTexture(GLenum target, GLuint texture)
+    {
+        if (IsNullBackend()) return;
+        if (target == GL_TEXTURE_2D)
+        {
+            if (GLuint* slot = CachedTexture2DSlot())
+            {
+                if (SkipIfCached(*slot, texture)) return;
+            }
+        }
+        glBindTexture(target, texture);
+    }
+    static inline void TexParameteri(GLenum target, GLenum pname, GLint param) { if (IsNullBackend()) return; glTexParameteri(target, pname, param); }
+    static inline void TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels) { if (IsNullBackend()) return; glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels); }
+    static inline void GenerateMipmap(GLenum target) { if (IsNullBackend()) return; glGenerateMipmap(target); }
+    static inline void PixelStorei(GLenum pname, GLint param) { if (IsNullBackend()) return; glPixelStorei(pname, param); }
+    static inline void ActiveTexture(GLenum texture) { if (IsNullBackend()) return; if (SkipIfCached(GetStateCache().activeTexture, texture)) return; glActiveTexture(texture); }
+    static inline void DeleteTextures(GLsizei n, const GLuint* textures)
+    {
+        if (IsNullBackend()) return;
+        // Deleted textures are unbound from every unit; GenTextures may reuse the name right away.
+        for (GLsizei i = 0; i < n; ++i)
+            for (GLuint& bound : GetStateCache().texture2D)
+                if (bound == textures[i]) bound = 0;
+        glDeleteTextures(n, textures);
+    }
 
     // -------------------------------------------------------------------------
     // Framebuffers (FBO)
     // -------------------------------------------------------------------------
-    static inline void GenFramebuffers(GLsizei n, GLuint* framebuffers) { glGenFramebuffers(n, framebuffers); }
-    static inline void BindFramebuffer(GLenum target, GLuint framebuffer) { glBindFramebuffer(target, framebuffer); }
-    static inline void FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { glFramebufferTexture2D(target, attachment, textarget, texture, level); }
-    static inline GLenum CheckFramebufferStatus(GLenum target) { return glCheckFramebufferStatus(target); }
-    static inline void DeleteFramebuffers(GLsizei n, const GLuint* framebuffers) { glDeleteFramebuffers(n, framebuffers); }
-    static inline void GenRenderbuffers(GLsizei n, GLuint* renderbuffers) { glGenRenderbuffers(n, renderbuffers); }
-    static inline void BindRenderbuffer(GLenum target, GLuint renderbuffer) { glBindRenderbuffer(target, renderbuffer); }
-    static inline void RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { glRenderbufferStorage(target, internalformat, width, height); }
-    static inline void FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer); }
+    static inline void GenFramebuffers(GLsizei n, GLuint* framebuffers) { if (IsNullBackend()) { FillNullHandles(n, framebuffers); return; } glGenFramebuffers(n, framebuffers); }
+    // A surfaceless (offscreen) context has no window framebuffer: the offscreen backend registers an FBO
+    // here and every bind of 0, i.e. "the screen", lands on it instead.
+    inline GLuint& DefaultFramebufferSlot() { static GLuint framebuffer = 0; return framebuffer; }
+    static inline void SetDefaultFramebuffer(GLuint framebuffer) { DefaultFramebufferSlot() = framebuffer; }
+    static inline void BindFramebuffer(GLenum target, GLuint framebuffer) { if (IsNullBackend()) return; glBindFramebuffer(target, framebuffer != 0 ? framebuffer : DefaultFramebufferSlot()); }
+    static inline void FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { if (IsNullBackend()) return; glFramebufferTexture2D(target, attachment, textarget, texture, level); }
+    static inline void BlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { if (IsNullBackend()) return; glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); }
+    static inline GLenum CheckFramebufferStatus(GLenum target) { if (IsNullBackend()) return GL_FRAMEBUFFER_COMPLETE; return glCheckFramebufferStatus(target); }
+    static inline void DeleteFramebuffers(GLsizei n, const GLuint* framebuffers) { if (IsNullBackend()) return; glDeleteFramebuffers(n, framebuffers); }
+    static inline void GenRenderbuffers(GLsizei n, GLuint* renderbuffers) { if (IsNullBackend()) { FillNullHandles(n, renderbuffers); return; } glGenRenderbuffers(n, renderbuffers); }
+    static inline void BindRenderbuffer(GLenum target, GLuint renderbuffer) { if (IsNullBackend()) return; glBindRenderbuffer(target, renderbuffer); }
+    static inline void RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { if (IsNullBackend()) return; glRenderbufferStorage(target, internalformat, width, height); }
+    static inline void FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { if (IsNullBackend()) return; glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer); }
     static inline void DeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
     {
+        if (IsNullBackend()) return;
         glDeleteRenderbuffers(n, renderbuffers);
     }
+    // Rows come back bottom-up, as GL stores them.
+    static inline void ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels) { if (IsNullBackend()) return; glReadPixels(x, y, width, height, format, type, pixels); }
+
+    // -------------------------------------------------------------------------
+    // Queries
+    // -------------------------------------------------------------------------
+    static inline void GenQueries(GLsizei n, GLuint* ids) { if (IsNullBackend()) { FillNullHandles(n, ids); return; } glGenQueries(n, ids); }
+    static inline void DeleteQueries(GLsizei n, const GLuint* ids) { if (IsNullBackend()) return; glDeleteQueries(n, ids); }
+    static inline void BeginQuery(GLenum target, GLuint id) { if (IsNullBackend()) return; glBeginQuery(target, id); }
+    static inline void EndQuery(GLenum target) { if (IsNullBackend()) return; glEndQuery(target); }
+    // Null backend reports every query as finished.
+    static inline void GetQueryObjectuiv(GLuint id, GLenum pname, GLuint* params) { if (IsNullBackend()) { *params = (pname == GL_QUERY_RESULT_AVAILABLE) ? GL_TRUE : 0; return; } glGetQueryObjectuiv(id, pname, params); }
+
+    // -------------------------------------------------------------------------
+    // Sync Objects
+    // -------------------------------------------------------------------------
+    static inline GLsync FenceSync(GLenum condition, GLbitfield flags) { if (IsNullBackend()) return nullptr; return glFenceSync(condition, flags); }
+    static inline GLenum ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { if (IsNullBackend() || !sync) return GL_ALREADY_SIGNALED; return glClientWaitSync(sync, flags, timeout); }
+    static inline void DeleteSync(GLsync sync) { if (IsNullBackend() || !sync) return; glDeleteSync(sync); }
+#if !defined(__EMSCRIPTEN__)
+    // GL_TIME_ELAPSED results (ns); WebGL2 only exposes timer queries through an extension.
+    static inline void GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64* params) { if (IsNullBackend()) { *params = 0; return; } glGetQueryObjectui64v(id, pname, params); }
+#endif
 
     // -------------------------------------------------------------------------
     // Shaders & Shader Programs
     // -------------------------------------------------------------------------
-    static inline GLuint CreateShader(GLenum type) { return glCreateShader(type); }
-    static inline void ShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length) { glShaderSource(shader, count, string, length); }
-    static inline void CompileShader(GLuint shader) { glCompileShader(shader); }
-    static inline void GetShaderiv(GLuint shader, GLenum pname, GLint* params) { glGetShaderiv(shader, pname, params); }
-    static inline void GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog) { glGetShaderInfoLog(shader, bufSize, length, infoLog); }
-    static inline GLuint CreateProgram() { return glCreateProgram(); }
-    static inline void AttachShader(GLuint program, GLuint shader) { glAttachShader(program, shader); }
-    static inline void LinkProgram(GLuint program) { glLinkProgram(program); }
-    static inline void GetProgramiv(GLuint program, GLenum pname, GLint* params) { glGetProgramiv(program, pname, params); }
-    static inline void GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog) { glGetProgramInfoLog(program, bufSize, length, infoLog); }
-    static inline void DeleteShader(GLuint shader) { glDeleteShader(shader); }
-    static inline void DeleteProgram(GLuint program) { glDeleteProgram(program); }
-    static inline void UseProgram(GLuint program) { glUseProgram(program); }
-    static inline GLint GetUniformLocation(GLuint program, const GLchar* name) { return glGetUniformLocation(program, name); }
-    static inline void Uniform1i(GLint location, GLint v0) { glUniform1i(location, v0); }
-    static inline void Uniform2f(GLint location, GLfloat v0, GLfloat v1) { glUniform2f(location, v0, v1); }
-    static inline void Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { glUniform3f(location, v0, v1, v2); }
-    static inline void UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) { glUniformMatrix4fv(location, count, transpose, value); }
-    static inline void Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { glUniform4f(location, v0, v1, v2, v3); }
-    static inline void Uniform1f(GLint location, GLfloat v0) { glUniform1f(location, v0); }
+    static inline GLuint CreateShader(GLenum type) { if (IsNullBackend()) return NextNullHandle(); return glCreateShader(type); }
+    static inline void ShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length) { if (IsNullBackend()) return; glShaderSource(shader, count, string, length); }
+    static inline void CompileShader(GLuint shader) { if (IsNullBackend()) return; glCompileShader(shader); }
+    static inline void GetShaderiv(GLuint shader, GLenum pname, GLint* params) { if (IsNullBackend()) { *params = GL_TRUE; return; } glGetShaderiv(shader, pname, params); }
+    static inline void GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog) { if (IsNullBackend()) { if (length) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; return; } glGetShaderInfoLog(shader, bufSize, length, infoLog); }
+    static inline GLuint CreateProgram() { if (IsNullBackend()) return NextNullHandle(); return glCreateProgram(); }
+    static inline void AttachShader(GLuint program, GLuint shader) { if (IsNullBackend()) return; glAttachShader(program, shader); }
+    static inline void LinkProgram(GLuint program) { if (IsNullBackend()) return; glLinkProgram(program); }
+    static inline void GetProgramiv(GLuint program, GLenum pname, GLint* params) { if (IsNullBackend()) { *params = (pname == GL_LINK_STATUS) ? GL_TRUE : 0; return; } glGetProgramiv(program, pname, params); }
+    static inline void GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog) { if (IsNullBackend()) { if (length) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; return; } glGetProgramInfoLog(program, bufSize, length, infoLog); }
+    static inline void DeleteShader(GLuint shader) { if (IsNullBackend()) return; glDeleteShader(shader); }
+    static inline void DeleteProgram(GLuint program) { if (IsNullBackend()) return; if (GetStateCache().program == program) GetStateCache().program = UNKNOWN_BINDING; glDeleteProgram(program); }
+    static inline void UseProgram(GLuint program) { if (IsNullBackend()) return; if (SkipIfCached(GetStateCache().program, program)) return; glUseProgram(program); }
+    static inline void GetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name) { if (IsNullBackend()) { if (length) *length = 0; if (bufSize > 0) name[0] = '\0'; return; } glGetActiveUniform(program, index, bufSize, length, size, type, name); }
+    static inline GLint GetUniformLocation(GLuint program, const GLchar* name) { if (IsNullBackend()) return -1; return glGetUniformLocation(program, name); }
+    static inline void Uniform1i(GLint location, GLint v0) { if (IsNullBackend()) return; glUniform1i(location, v0); }
+    static inline void Uniform2f(GLint location, GLfloat v0, GLfloat v1) { if (IsNullBackend()) return; glUniform2f(location, v0, v1); }
+    static inline void Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { if (IsNullBackend()) return; glUniform3f(location, v0, v1, v2); }
+    static inline void UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) { if (IsNullBackend()) return; glUniformMatrix4fv(location, count, transpose, value); }
+    static inline void Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { if (IsNullBackend()) return; glUniform4f(location, v0, v1, v2, v3); }
+    static inline void Uniform1f(GLint location, GLfloat v0) { if (IsNullBackend()) return; glUniform1f(location, v0); }
 }
\ No newline at end of file
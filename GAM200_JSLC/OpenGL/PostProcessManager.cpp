@@ -6,16 +6,26 @@
 #endif
 #include "../OpenGL/GLWrapper.hpp"
 #include "../Engine/Logger.hpp"
+#include "../Engine/TextureTracker.hpp"
 #ifndef GLFW_INCLUDE_NONE
 #define GLFW_INCLUDE_NONE
 #endif
 #include <GLFW/glfw3.h>
-#ifdef __APPLE__
+#include <algorithm>
 #include <cmath>
-#endif
 
 namespace {
 
+// Dynamic resolution: scale steps down fast (fill cost goes with scale^2) and creeps back up,
+// with a cooldown so the smoothed frame time can settle before the next FBO resize.
+constexpr float MIN_RENDER_SCALE = 0.5f;
+constexpr float SCALE_STEP_DOWN = 0.1f;
+constexpr float SCALE_STEP_UP = 0.05f;
+constexpr double FRAME_TIME_SMOOTHING = 0.1;
+constexpr double DOWNSCALE_THRESHOLD = 0.9;  // of the frame budget
+constexpr double UPSCALE_THRESHOLD = 0.6;
+constexpr int SCALE_CHANGE_COOLDOWN_FRAMES = 30;
+
 // After macOS Space / fullscreen transitions, glfwGetFramebufferSize can lag the real backing store
 // for a frame while window size × content scale already matches Cocoa. That mismatch skews post.frag
 // letterboxing (uFramebufferSize vs actual viewport pixels).
@@ -60,11 +70,13 @@ static void DestroySceneTargets(GLuint& fbo, GLuint& colorTex, GLuint& depthRbo)
     if (depthRbo)
     {
         GL::DeleteRenderbuffers(1, &depthRbo);
+        TextureTracker::Instance().UntrackRenderbuffer(depthRbo);
         depthRbo = 0;
     }
     if (colorTex)
     {
         GL::DeleteTextures(1, &colorTex);
+        TextureTracker::Instance().Untrack(colorTex);
         colorTex = 0;
     }
     if (fbo)
@@ -80,30 +92,78 @@ void PostProcessManager::Initialize(int width, int height)
     m_height = height;
     m_displayWidth = width;
     m_displayHeight = height;
+    m_sceneScale = m_renderScale;
+    m_sceneWidth = std::max(1, static_cast<int>(std::lround(width * m_sceneScale)));
+    m_sceneHeight = std::max(1, static_cast<int>(std::lround(height * m_sceneScale)));
 
     CreateFullscreenQuad();
     CreateSceneFBO();
 
-    m_postShader = std::make_unique<Shader>(
-        "OpenGL/Shaders/post.vert",
-        "OpenGL/Shaders/post.frag"
-    );
+    // Blitting into a multisampled default framebuffer is an error (GLES3 / WebGL2 and some drivers).
+    GLint sampleBuffers = 0;
+    GL::GetIntegerv(GL_SAMPLE_BUFFERS, &sampleBuffers);
+    m_canBlitToScreen = (sampleBuffers == 0);
 
-    m_postShader->use();
-    m_postShader->setInt("uSceneTex", 0);
-    m_postShader->setInt("uLightOverlayTex", 1);
-    m_postShader->setFloat("uExposure", m_settings.exposure);
-    m_postShader->setBool("uUseLightOverlay", m_settings.useLightOverlay);
-    m_postShader->setFloat("uLightOverlayStrength", m_settings.lightOverlayStrength);
-    m_postShader->setVec2("uFramebufferSize", static_cast<float>(m_width), static_cast<float>(m_height));
+    m_copyShader = std::make_unique<Shader>("OpenGL/Shaders/post.vert", "OpenGL/Shaders/post_copy.frag");
+    m_copyShader->use();
+    m_copyShader->setInt("uSceneTex", 0);
 
     m_lightOverlay = std::make_unique<Background>();
     m_lightOverlay->Initialize("Asset/Hallway_Light.png");
+
+    AddGradePass();
+}
+
+void PostProcessManager::AddGradePass()
+{
+    // Exposure + hallway light overlay. Neutral settings leave pixels untouched, so skip it then.
+    Pass grade;
+    grade.name = "grade";
+    grade.shader = std::make_unique<Shader>("OpenGL/Shaders/post.vert", "OpenGL/Shaders/post.frag");
+    grade.shader->use();
+    grade.shader->setInt("uLightOverlayTex", 1);
+    grade.isActive = [this] { return m_settings.exposure != 1.0f || m_settings.useLightOverlay; };
+    grade.bindUniforms = [this](Shader& shader) {
+        shader.setFloat("uExposure", m_settings.exposure);
+        shader.setBool("uUseLightOverlay", m_settings.useLightOverlay);
+        shader.setFloat("uLightOverlayStrength", m_settings.lightOverlayStrength);
+        shader.setVec2("uCameraPos", m_settings.cameraPos.x, m_settings.cameraPos.y);
+        shader.setVec2("uGameSize", static_cast<float>(m_width), static_cast<float>(m_height));
+        shader.setVec2("uHallwayMin", 1920.0f, 0.0f);
+        shader.setVec2("uHallwaySize", 5940.0f, 1080.0f);
+
+        GL::ActiveTexture(GL_TEXTURE1);
+        GL::BindTexture(GL_TEXTURE_2D, m_lightOverlay ? m_lightOverlay->GetTextureID() : 0);
+        GL::ActiveTexture(GL_TEXTURE0);
+    };
+    AddPass(std::move(grade));
+}
+
+void PostProcessManager::AddPass(Pass pass)
+{
+    if (!pass.shader)
+    {
+        Logger::Instance().Log(Logger::Severity::Error, "PostProcess: pass '%s' has no shader", pass.name.c_str());
+        return;
+    }
+    pass.shader->use();
+    pass.shader->setInt("uSceneTex", 0);
+    m_passes.push_back(std::move(pass));
+}
+
+void PostProcessManager::SetPassEnabled(const std::string& name, bool enabled)
+{
+    for (Pass& pass : m_passes)
+    {
+        if (pass.name == name)
+            pass.enabled = enabled;
+    }
 }
 
 void PostProcessManager::Shutdown()
 {
     m_presentationWindow = nullptr;
+    m_capture.Stop();
 
     if (m_lightOverlay)
     {
@@ -111,8 +171,11 @@ void PostProcessManager::Shutdown()
         m_lightOverlay.reset();
     }
 
-    if (m_postShader)
-        m_postShader.reset();
+    m_activePasses.clear();
+    m_passes.clear();
+    m_copyShader.reset();
+    for (RenderTarget& target : m_pingPong)
+        DestroyRenderTarget(target);
 
     if (m_quadVAO)
     {
@@ -138,15 +201,74 @@ void PostProcessManager::Resize(int width, int height)
 
     m_width = width;
     m_height = height;
+    m_sceneWidth = std::max(1, static_cast<int>(std::lround(width * m_sceneScale)));
+    m_sceneHeight = std::max(1, static_cast<int>(std::lround(height * m_sceneScale)));
 
     DestroySceneTargets(m_sceneFBO, m_sceneColorTex, m_sceneDepthRBO);
     CreateSceneFBO();
 }
 
+void PostProcessManager::SetRenderScale(float scale)
+{
+    m_renderScale = std::clamp(scale, MIN_RENDER_SCALE, 1.0f);
+    if (!m_dynamicResolution || m_sceneScale > m_renderScale)
+        ApplySceneScale(m_renderScale);
+}
+
+void PostProcessManager::SetDynamicResolution(bool enabled)
+{
+    m_dynamicResolution = enabled;
+    m_smoothedFrameMs = 0.0;
+    m_framesSinceScaleChange = 0;
+    if (!enabled)
+        ApplySceneScale(m_renderScale);
+}
+
+void PostProcessManager::UpdateDynamicResolution(double frameMs, double targetMs)
+{
+    if (!m_dynamicResolution || targetMs <= 0.0)
+        return;
+
+    m_smoothedFrameMs = (m_smoothedFrameMs <= 0.0)
+        ? frameMs
+        : m_smoothedFrameMs + (frameMs - m_smoothedFrameMs) * FRAME_TIME_SMOOTHING;
+    if (++m_framesSinceScaleChange < SCALE_CHANGE_COOLDOWN_FRAMES)
+        return;
+
+    float next = m_sceneScale;
+    if (m_smoothedFrameMs > targetMs * DOWNSCALE_THRESHOLD)
+        next = std::max(MIN_RENDER_SCALE, m_sceneScale - SCALE_STEP_DOWN);
+    else if (m_smoothedFrameMs < targetMs * UPSCALE_THRESHOLD)
+        next = std::min(m_renderScale, m_sceneScale + SCALE_STEP_UP);
+
+    if (next != m_sceneScale)
+    {
+        ApplySceneScale(next);
+        m_framesSinceScaleChange = 0;
+    }
+}
+
+void PostProcessManager::ApplySceneScale(float scale)
+{
+    m_sceneScale = scale;
+    const int sceneW = std::max(1, static_cast<int>(std::lround(m_width * scale)));
+    const int sceneH = std::max(1, static_cast<int>(std::lround(m_height * scale)));
+    if (sceneW == m_sceneWidth && sceneH == m_sceneHeight)
+        return;
+
+    m_sceneWidth = sceneW;
+    m_sceneHeight = sceneH;
+    // Not initialized yet (or headless before Initialize): Initialize creates it at this size.
+    if (!m_sceneFBO)
+        return;
+    CreateSceneFBO();
+    Logger::Instance().Log(Logger::Severity::Info, "PostProcess: scene %dx%d (scale %.2f)", sceneW, sceneH, scale);
+}
+
 void PostProcessManager::BeginScene()
 {
     GL::BindFramebuffer(GL_FRAMEBUFFER, m_sceneFBO);
-    GL::Viewport(0, 0, m_width, m_height);
+    GL::Viewport(0, 0, m_sceneWidth, m_sceneHeight);
 
     GL::Disable(GL_DEPTH_TEST);
     GL::Disable(GL_SCISSOR_TEST);
@@ -181,6 +303,20 @@ void PostProcessManager::GetLetterboxViewport(int& outX, int& outY, int& outW, i
     ComputeLetterboxViewport(m_displayWidth, m_displayHeight, outX, outY, outW, outH);
 }
 
+void PostProcessManager::CaptureFrame()
+{
+    if (!m_capture.IsActive())
+        return;
+    // The scene FBO lacks everything DrawForegroundAfterPostProcess adds, so read what was presented.
+    int vpX = 0;
+    int vpY = 0;
+    int vpW = 0;
+    int vpH = 0;
+    ComputeLetterboxViewport(m_displayWidth, m_displayHeight, vpX, vpY, vpW, vpH);
+    GL::BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    m_capture.Capture(vpX, vpY, vpW, vpH);
+}
+
 void PostProcessManager::ApplyAndPresent()
 {
     GL::Disable(GL_DEPTH_TEST);
@@ -219,35 +355,123 @@ void PostProcessManager::ApplyAndPresent()
     ComputeLetterboxViewport(fbW, fbH, vpX, vpY, vpW, vpH);
     GL::Viewport(vpX, vpY, vpW, vpH);
 
-    m_postShader->use();
-    m_postShader->setFloat("uExposure", m_passthrough ? 1.0f : m_settings.exposure);
-    m_postShader->setBool("uUseLightOverlay", !m_passthrough && m_settings.useLightOverlay);
-    m_postShader->setFloat("uLightOverlayStrength", m_settings.lightOverlayStrength);
+    // Passthrough (UI overlays) skips every effect.
+    m_activePasses.clear();
+    if (!m_passthrough)
+    {
+        for (Pass& pass : m_passes)
+        {
+            if (pass.enabled && (!pass.isActive || pass.isActive()))
+                m_activePasses.push_back(&pass);
+        }
+    }
+    m_lastPassCount = static_cast<int>(m_activePasses.size());
 
-    m_postShader->setVec2("uCameraPos", m_settings.cameraPos.x, m_settings.cameraPos.y);
-    m_postShader->setVec2("uGameSize", static_cast<float>(m_width), static_cast<float>(m_height));
-    m_postShader->setVec2("uFramebufferSize", static_cast<float>(vpW), static_cast<float>(vpH));
+    if (m_activePasses.empty())
+    {
+        PresentScene(vpX, vpY, vpW, vpH);
+        return;
+    }
 
-    m_postShader->setVec2("uHallwayMin", 1920.0f, 0.0f);
-    m_postShader->setVec2("uHallwaySize", 5940.0f, 1080.0f);
+    GL::BindVertexArray(m_quadVAO);
+    unsigned int source = m_sceneColorTex;
+    for (size_t i = 0; i < m_activePasses.size(); ++i)
+    {
+        Pass& pass = *m_activePasses[i];
+        const bool last = (i + 1 == m_activePasses.size());
+        if (last)
+        {
+            GL::BindFramebuffer(GL_FRAMEBUFFER, 0);
+            GL::Viewport(vpX, vpY, vpW, vpH);
+        }
+        else
+        {
+            RenderTarget& target = m_pingPong[i % m_pingPong.size()];
+            EnsureRenderTarget(target, m_sceneWidth, m_sceneHeight);
+            GL::BindFramebuffer(GL_FRAMEBUFFER, target.fbo);
+            GL::Viewport(0, 0, target.width, target.height);
+        }
+
+        pass.shader->use();
+        pass.shader->setVec2("uFramebufferSize", static_cast<float>(last ? vpW : m_sceneWidth),
+                             static_cast<float>(last ? vpH : m_sceneHeight));
+        if (pass.bindUniforms)
+            pass.bindUniforms(*pass.shader);
+
+        GL::ActiveTexture(GL_TEXTURE0);
+        GL::BindTexture(GL_TEXTURE_2D, source);
+        GL::DrawArrays(GL_TRIANGLES, 0, 6);
+
+        if (!last)
+            source = m_pingPong[i % m_pingPong.size()].colorTex;
+    }
+    GL::BindVertexArray(0);
+
+    GL::ActiveTexture(GL_TEXTURE1);
+    GL::BindTexture(GL_TEXTURE_2D, 0);
 
     GL::ActiveTexture(GL_TEXTURE0);
-    GL::BindTexture(GL_TEXTURE_2D, m_sceneColorTex);
+    GL::BindTexture(GL_TEXTURE_2D, 0);
+}
 
-    GL::ActiveTexture(GL_TEXTURE1);
-    if (m_lightOverlay)
-        GL::BindTexture(GL_TEXTURE_2D, m_lightOverlay->GetTextureID());
-    else
-        GL::BindTexture(GL_TEXTURE_2D, 0);
+void PostProcessManager::PresentScene(int vpX, int vpY, int vpW, int vpH)
+{
+    if (m_canBlitToScreen)
+    {
+        // Same filtering choice as the scene texture (see CreateSceneFBO).
+        const GLenum filter = (m_sceneWidth < m_width) ? GL_LINEAR : GL_NEAREST;
+        GL::BindFramebuffer(GL_READ_FRAMEBUFFER, m_sceneFBO);
+        GL::BindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+        GL::BlitFramebuffer(0, 0, m_sceneWidth, m_sceneHeight, vpX, vpY, vpX + vpW, vpY + vpH,
+                            GL_COLOR_BUFFER_BIT, filter);
+        GL::BindFramebuffer(GL_FRAMEBUFFER, 0);
+        return;
+    }
 
+    m_copyShader->use();
+    GL::ActiveTexture(GL_TEXTURE0);
+    GL::BindTexture(GL_TEXTURE_2D, m_sceneColorTex);
     GL::BindVertexArray(m_quadVAO);
     GL::DrawArrays(GL_TRIANGLES, 0, 6);
     GL::BindVertexArray(0);
-
-    GL::ActiveTexture(GL_TEXTURE1);
     GL::BindTexture(GL_TEXTURE_2D, 0);
+}
 
-    GL::ActiveTexture(GL_TEXTURE0);
+void PostProcessManager::DestroyRenderTarget(RenderTarget& target)
+{
+    if (target.colorTex)
+    {
+        GL::DeleteTextures(1, &target.colorTex);
+        TextureTracker::Instance().Untrack(target.colorTex);
+    }
+    if (target.fbo)
+        GL::DeleteFramebuffers(1, &target.fbo);
+    target = RenderTarget{};
+}
+
+void PostProcessManager::EnsureRenderTarget(RenderTarget& target, int width, int height)
+{
+    if (target.fbo && target.width == width && target.height == height)
+        return;
+    DestroyRenderTarget(target);
+
+    target.width = width;
+    target.height = height;
+    GL::GenTextures(1, &target.colorTex);
+    GL::BindTexture(GL_TEXTURE_2D, target.colorTex);
+    GL::TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    TextureTracker::Instance().Track(target.colorTex, 0, width, height, GL_RGBA8, "PostProcess");
+    // Intermediate passes are sampled 1:1, so nearest is exact.
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    GL::GenFramebuffers(1, &target.fbo);
+    GL::BindFramebuffer(GL_FRAMEBUFFER, target.fbo);
+    GL::FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target.colorTex, 0);
+    if (GL::CheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        Logger::Instance().Log(Logger::Severity::Error, "PostProcess ping-pong target incomplete (%dx%d)", width, height);
     GL::BindTexture(GL_TEXTURE_2D, 0);
 }
 
@@ -296,19 +520,22 @@ void PostProcessManager::CreateSceneFBO()
         GL_TEXTURE_2D,
         0,
         GL_RGBA8,
-        m_width,
-        m_height,
+        m_sceneWidth,
+        m_sceneHeight,
         0,
         GL_RGBA,
         GL_UNSIGNED_BYTE,
         nullptr
     );
+    TextureTracker::Instance().Track(m_sceneColorTex, 0, m_sceneWidth, m_sceneHeight, GL_RGBA8, "PostProcess");
 
     // Present the scene FBO without cross-row filtering. On QHD fullscreen,
     // linear filtering while scaling 1920x1080 -> 2560x1440 can blend against
     // cleared rows on some drivers and show as a fast-moving black horizontal line.
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    // A reduced render scale is the exception: nearest upscaling would double uneven rows/columns.
+    const GLint filter = (m_sceneWidth < m_width) ? GL_LINEAR : GL_NEAREST;
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+    GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
     GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     GL::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
@@ -319,7 +546,8 @@ void PostProcessManager::CreateSceneFBO()
     // -------------------------
     GL::GenRenderbuffers(1, &m_sceneDepthRBO);
     GL::BindRenderbuffer(GL_RENDERBUFFER, m_sceneDepthRBO);
-    GL::RenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, m_width, m_height);
+    GL::RenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, m_sceneWidth, m_sceneHeight);
+    TextureTracker::Instance().TrackRenderbuffer(m_sceneDepthRBO, m_sceneWidth, m_sceneHeight, GL_DEPTH24_STENCIL8, "PostProcess");
     GL::FramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_sceneDepthRBO);
 
     // ------------------------
@@ -332,8 +560,8 @@ void PostProcessManager::CreateSceneFBO()
             Logger::Severity::Error,
             "PostProcess FBO incomplete (status=%u) size=%dx%d",
             status,
-            m_width,
-            m_height
+            m_sceneWidth,
+            m_sceneHeight
         );
     }
 
@@ -1,5 +1,10 @@
 #pragma once
+#include <array>
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
+#include "FrameCapture.hpp"
 #include "Shader.hpp"
 #include "../Game/Background.hpp"
 #include "../Engine/Vec2.hpp"
@@ -18,6 +23,19 @@ struct PostProcessSettings
 
 class PostProcessManager {
 public:
+	// Full-screen effect between the scene FBO and the screen. Active passes run in the order they
+	// were added; each samples the previous result as uSceneTex (unit 0). The last one writes the
+	// letterboxed screen and the others ping-pong between two pooled scene-sized targets. With no
+	// active pass (or in passthrough) the scene is blitted straight to the screen.
+	struct Pass
+	{
+		std::string name;
+		std::unique_ptr<Shader> shader;             // drawn with post.vert's full-screen quad
+		std::function<bool()> isActive;             // per-frame skip test; null means always
+		std::function<void(Shader&)> bindUniforms;  // shader is already in use
+		bool enabled = true;
+	};
+
 	void Initialize(int width, int height);
 	void Shutdown(); 
 
@@ -39,15 +57,55 @@ public:
 	// When enabled, ApplyAndPresent uses exposure=1.0 (no darkening) - used for UI overlays
 	void SetPassthrough(bool enabled) { m_passthrough = enabled; }
 
+	void AddPass(Pass pass);
+	void SetPassEnabled(const std::string& name, bool enabled);
+	// Passes run by the last ApplyAndPresent; 0 means the scene was blitted or copied.
+	int GetLastPassCount() const { return m_lastPassCount; }
+
 	// Viewport used when presenting the scene (letterboxed on the default framebuffer).
 	void GetLetterboxViewport(int& outX, int& outY, int& outW, int& outH) const;
 
+	// Scene FBO resolution relative to the virtual size; ApplyAndPresent upscales it to the letterbox.
+	// With dynamic resolution on this is the ceiling the controller works under.
+	void SetRenderScale(float scale);
+	float GetRenderScale() const { return m_renderScale; }
+	void SetDynamicResolution(bool enabled);
+	bool IsDynamicResolution() const { return m_dynamicResolution; }
+	// One frame's busy time against the frame budget; lowers the scene scale while frames run long
+	// and raises it back once there is headroom. No-op while dynamic resolution is off.
+	void UpdateDynamicResolution(double frameMs, double targetMs);
+
+	// Scale and pixel size the scene FBO is rendering at right now (BeginScene's viewport).
+	float GetSceneScale() const { return m_sceneScale; }
+	void GetSceneSize(int& outW, int& outH) const { outW = m_sceneWidth; outH = m_sceneHeight; }
+
+	// Frame capture grabs the presented frame (letterbox region of the default framebuffer, after the
+	// foreground pass and before ImGui) through FrameCapture's PBO ring. CaptureFrame is a no-op when idle.
+	bool StartCapture(const FrameCaptureSettings& settings) { return m_capture.Start(settings); }
+	void StopCapture() { m_capture.Stop(); }
+	bool IsCapturing() const { return m_capture.IsActive(); }
+	FrameCapture& GetCapture() { return m_capture; }
+	void CaptureFrame();
+
 	PostProcessSettings& Settings() { return m_settings; }
 	const PostProcessSettings& Settings() const { return m_settings; }
 
 
 private:
+	struct RenderTarget
+	{
+		unsigned int fbo = 0;
+		unsigned int colorTex = 0;
+		int width = 0;
+		int height = 0;
+	};
+
 	void CreateSceneFBO();
+	void ApplySceneScale(float scale);
+	void AddGradePass();
+	static void DestroyRenderTarget(RenderTarget& target);
+	void EnsureRenderTarget(RenderTarget& target, int width, int height);
+	void PresentScene(int vpX, int vpY, int vpW, int vpH);
 	void CreateFullscreenQuad();
 	void ComputeLetterboxViewport(int dispW, int dispH, int& outX, int& outY, int& outW, int& outH) const;
 
@@ -67,6 +125,22 @@ private:
 	int m_displayHeight = 0;
 	bool m_passthrough = false;
 
-	std::unique_ptr<Shader> m_postShader;
+	int m_sceneWidth = 0;
+	int m_sceneHeight = 0;
+	float m_renderScale = 1.0f;
+	float m_sceneScale = 1.0f;
+	bool m_dynamicResolution = false;
+	double m_smoothedFrameMs = 0.0;
+	int m_framesSinceScaleChange = 0;
+
+	std::vector<Pass> m_passes;
+	std::vector<Pass*> m_activePasses;
+	std::array<RenderTarget, 2> m_pingPong{};
+	std::unique_ptr<Shader> m_copyShader;
+	bool m_canBlitToScreen = true;
+	int m_lastPassCount = 0;
+
 	std::unique_ptr<Background> m_lightOverlay;
+
+	FrameCapture m_capture;
 };
\ No newline at end of file
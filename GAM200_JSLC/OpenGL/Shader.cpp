@@ -123,6 +123,49 @@ Shader::Shader(const char* vertexPath, const char* fragmentPath)
     // Delete the shaders as they're linked into our program now and no longer necessary
     GL::DeleteShader(vertex);
     GL::DeleteShader(fragment);
+
+    if (success)
+        ReflectUniforms();
+}
+
+void Shader::ReflectUniforms()
+{
+    m_uniforms.clear();
+    m_uniformLookup.clear();
+    m_floatValues.clear();
+
+    GLint count = 0;
+    GLint maxNameLength = 0;
+    GL::GetProgramiv(ID, GL_ACTIVE_UNIFORMS, &count);
+    GL::GetProgramiv(ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+    if (count <= 0 || maxNameLength <= 0)
+        return;
+
+    std::vector<GLchar> nameBuffer(static_cast<size_t>(maxNameLength));
+    m_uniforms.reserve(static_cast<size_t>(count));
+    for (GLint i = 0; i < count; ++i)
+    {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        GL::GetActiveUniform(ID, static_cast<GLuint>(i), maxNameLength, &length, &size, &type, nameBuffer.data());
+        if (length <= 0)
+            continue;
+
+        std::string name(nameBuffer.data(), static_cast<size_t>(length));
+        // Arrays are reported as "name[0]"; callers use the bare name
+        if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+            name.resize(name.size() - 3);
+
+        const GLint location = GL::GetUniformLocation(ID, name.c_str());
+        if (location < 0)
+            continue; // uniform block members have no location
+
+        m_uniformLookup.emplace(name, location);
+        m_uniforms.push_back({ std::move(name), location, type });
+        if (type == GL_FLOAT && static_cast<size_t>(location) >= m_floatValues.size())
+            m_floatValues.resize(static_cast<size_t>(location) + 1, 0.0f);
+    }
 }
 
 Shader::~Shader()
@@ -139,39 +182,56 @@ void Shader::use() const
 
 // --- Uniform Utilities ---
 
-void Shader::setInt(const std::string& name, int value) const
+UniformHandle Shader::GetUniform(std::string_view name) const
 {
-    GL::Uniform1i(GL::GetUniformLocation(ID, name.c_str()), value);
+    auto it = m_uniformLookup.find(name);
+    if (it == m_uniformLookup.end())
+        return {};
+    return { it->second };
 }
 
-void Shader::setVec2(const std::string& name, float v1, float v2) const
+void Shader::setInt(UniformHandle handle, int value) const
 {
-    GL::Uniform2f(GL::GetUniformLocation(ID, name.c_str()), v1, v2);
+    if (!handle.IsValid()) return;
+    GL::Uniform1i(handle.location, value);
 }
 
-void Shader::setVec3(const std::string& name, float v1, float v2, float v3) const
+void Shader::setVec2(UniformHandle handle, float v1, float v2) const
 {
-    GL::Uniform3f(GL::GetUniformLocation(ID, name.c_str()), v1, v2, v3);
+    if (!handle.IsValid()) return;
+    GL::Uniform2f(handle.location, v1, v2);
 }
 
-void Shader::setMat4(const std::string& name, const Math::Matrix& mat) const
+void Shader::setVec3(UniformHandle handle, float v1, float v2, float v3) const
 {
+    if (!handle.IsValid()) return;
+    GL::Uniform3f(handle.location, v1, v2, v3);
+}
+
+void Shader::setMat4(UniformHandle handle, const Math::Matrix& mat) const
+{
+    if (!handle.IsValid()) return;
     // Upload the 4x4 matrix data to the GPU
-    GL::UniformMatrix4fv(GL::GetUniformLocation(ID, name.c_str()), 1, GL_FALSE, mat.Ptr());
+    GL::UniformMatrix4fv(handle.location, 1, GL_FALSE, mat.Ptr());
 }
 
-void Shader::setVec4(const std::string& name, float v1, float v2, float v3, float v4) const
+void Shader::setVec4(UniformHandle handle, float v1, float v2, float v3, float v4) const
 {
-    GL::Uniform4f(GL::GetUniformLocation(ID, name.c_str()), v1, v2, v3, v4);
+    if (!handle.IsValid()) return;
+    GL::Uniform4f(handle.location, v1, v2, v3, v4);
 }
 
-void Shader::setBool(const std::string& name, bool value) const
+void Shader::setFloat(UniformHandle handle, float value) const
 {
-    // Booleans are passed to GLSL as integers (0 or 1)
-    GL::Uniform1i(GL::GetUniformLocation(ID, name.c_str()), static_cast<int>(value));
+    if (!handle.IsValid()) return;
+    if (static_cast<size_t>(handle.location) < m_floatValues.size())
+        m_floatValues[static_cast<size_t>(handle.location)] = value;
+    GL::Uniform1f(handle.location, value);
 }
 
-void Shader::setFloat(const std::string& name, float value) const
+float Shader::getFloat(UniformHandle handle) const
 {
-    GL::Uniform1f(GL::GetUniformLocation(ID, name.c_str()), value);
-}
\ No newline at end of file
+    if (!handle.IsValid() || static_cast<size_t>(handle.location) >= m_floatValues.size())
+        return 0.0f;
+    return m_floatValues[static_cast<size_t>(handle.location)];
+}
@@ -2,10 +2,20 @@
 
 #pragma once
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 // Forward declaration for the Matrix class within the Math namespace
 namespace Math { class Matrix; }
 
+/// Pre-resolved uniform location. Invalid handles (inactive / unknown uniforms) make setters no-ops.
+struct UniformHandle
+{
+    int location = -1;
+    bool IsValid() const { return location >= 0; }
+};
+
 class Shader
 {
 public:
@@ -18,30 +28,69 @@ public:
     // Activate the shader program for use
     void use() const;
 
+    // --- Uniform lookup ---
+
+    // Resolve a uniform once (e.g. at init) and reuse the handle every draw
+    UniformHandle GetUniform(std::string_view name) const;
+
+    // Active uniforms reflected after linking (name, location, GL type)
+    struct UniformInfo
+    {
+        std::string name;
+        int location = -1;
+        unsigned int type = 0;
+    };
+    const std::vector<UniformInfo>& GetActiveUniforms() const { return m_uniforms; }
+
     // --- Uniform setter functions ---
+    // Name overloads go through the reflected table: no string allocation, no driver lookup.
     
     // Set an integer value (often used for texture units/samplers)
-    void setInt(const std::string& name, int value) const;
+    void setInt(std::string_view name, int value) const { setInt(GetUniform(name), value); }
+    void setInt(UniformHandle handle, int value) const;
     
     // Set a 2-component vector
-    void setVec2(const std::string& name, float v1, float v2) const;
+    void setVec2(std::string_view name, float v1, float v2) const { setVec2(GetUniform(name), v1, v2); }
+    void setVec2(UniformHandle handle, float v1, float v2) const;
 
     // Set a 3-component vector (often used for RGB colors or 3D positions)
-    void setVec3(const std::string& name, float v1, float v2, float v3) const;
+    void setVec3(std::string_view name, float v1, float v2, float v3) const { setVec3(GetUniform(name), v1, v2, v3); }
+    void setVec3(UniformHandle handle, float v1, float v2, float v3) const;
     
     // Set a 4x4 transformation matrix (used for Model-View-Projection)
-    void setMat4(const std::string& name, const Math::Matrix& mat) const;
+    void setMat4(std::string_view name, const Math::Matrix& mat) const { setMat4(GetUniform(name), mat); }
+    void setMat4(UniformHandle handle, const Math::Matrix& mat) const;
 
     // Set a 4-component vector (often used for RGBA colors or clipping planes)
-    void setVec4(const std::string& name, float v1, float v2, float v3, float v4) const;
+    void setVec4(std::string_view name, float v1, float v2, float v3, float v4) const { setVec4(GetUniform(name), v1, v2, v3, v4); }
+    void setVec4(UniformHandle handle, float v1, float v2, float v3, float v4) const;
     
     // Set a single floating-point value
-    void setFloat(const std::string& name, float value) const;
+    void setFloat(std::string_view name, float value) const { setFloat(GetUniform(name), value); }
+    void setFloat(UniformHandle handle, float value) const;
+    // Last value set through setFloat (0 before that, like a freshly linked program). No GL query.
+    float getFloat(UniformHandle handle) const;
     
     // Set a boolean value (converted to int/float for the GPU)
-    void setBool(const std::string& name, bool value) const;
+    void setBool(std::string_view name, bool value) const { setInt(GetUniform(name), static_cast<int>(value)); }
+    void setBool(UniformHandle handle, bool value) const { setInt(handle, static_cast<int>(value)); }
 
 private:
+    // Fill m_uniforms / m_uniformLookup from the linked program
+    void ReflectUniforms();
+
+    // Transparent hash so string_view lookups never build a std::string
+    struct NameHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+    };
+
     // The program ID assigned by OpenGL
     unsigned int ID;
+
+    std::vector<UniformInfo> m_uniforms;
+    std::unordered_map<std::string, int, NameHash, std::equal_to<>> m_uniformLookup;
+    // Indexed by location; lets batched draws pick up a uniform the caller set (DebugRenderer's uAlpha)
+    mutable std::vector<float> m_floatValues;
 };
\ No newline at end of file
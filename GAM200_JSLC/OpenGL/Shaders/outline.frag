@@ -3,8 +3,10 @@ out vec4 FragColor;
 in vec2 TexCoord;
 
 uniform sampler2D ourTexture;
-uniform vec2 texelSize;
-uniform vec4 outlineColor;   
+// Built by AssetCache::BindOutlineField: squared texel distance to the nearest opaque (r) and
+// transparent (g) texel, stored as d2 / 255 (1.0 means farther than its radius of 3).
+uniform sampler2D outlineField;
+uniform vec4 outlineColor;
 
 float alphaAt(vec2 uv)
 {
@@ -13,48 +15,6 @@ float alphaAt(vec2 uv)
     return texture(ourTexture, uv).a;
 }
 
-bool hasOpaqueNeighborInRadius(vec2 uv, float radiusTexel)
-{
-    const int MAX_RADIUS = 3;
-    float r = clamp(radiusTexel, 1.0, float(MAX_RADIUS));
-    float r2 = r * r;
-
-    for (int y = -MAX_RADIUS; y <= MAX_RADIUS; ++y)
-    {
-        for (int x = -MAX_RADIUS; x <= MAX_RADIUS; ++x)
-        {
-            float d2 = float(x * x + y * y);
-            if (d2 > r2) continue;
-
-            vec2 uv2 = uv + vec2(float(x) * texelSize.x, float(y) * texelSize.y);
-            if (alphaAt(uv2) > 0.5)
-                return true;
-        }
-    }
-    return false;
-}
-
-bool hasTransparentNeighborInRadius(vec2 uv, float radiusTexel)
-{
-    const int MAX_RADIUS = 3;
-    float r = clamp(radiusTexel, 1.0, float(MAX_RADIUS));
-    float r2 = r * r;
-
-    for (int y = -MAX_RADIUS; y <= MAX_RADIUS; ++y)
-    {
-        for (int x = -MAX_RADIUS; x <= MAX_RADIUS; ++x)
-        {
-            float d2 = float(x * x + y * y);
-            if (d2 > r2) continue;
-
-            vec2 uv2 = uv + vec2(float(x) * texelSize.x, float(y) * texelSize.y);
-            if (alphaAt(uv2) <= 0.1)
-                return true;
-        }
-    }
-    return false;
-}
-
 void main()
 {
     const float outlineWidthTexels = 2.0;
@@ -66,10 +26,11 @@ void main()
 
     float a = alphaAt(TexCoord);
     float r = clamp(outlineWidthTexels, 1.0, 3.0);
+    vec2 d2 = texture(outlineField, TexCoord).rg * 255.0;
 
     bool inside    = (a > 0.1);
-    bool edgeOuter = (a <= 0.1) && hasOpaqueNeighborInRadius(TexCoord, r);
-    bool edgeInner = (a > 0.1)  && hasTransparentNeighborInRadius(TexCoord, r);
+    bool edgeOuter = (a <= 0.1) && (d2.r <= r * r + 0.5);
+    bool edgeInner = (a > 0.1)  && (d2.g <= r * r + 0.5);
 
     if (!inside && !edgeOuter)
         discard;
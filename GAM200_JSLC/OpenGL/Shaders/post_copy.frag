@@ -0,0 +1,12 @@
+#version 330 core
+in vec2 vUV;
+out vec4 FragColor;
+
+// Plain present for when no post pass is active but glBlitFramebuffer can't be used
+// (multisampled default framebuffer).
+uniform sampler2D uSceneTex;
+
+void main()
+{
+    FragColor = vec4(texture(uSceneTex, vUV).rgb, 1.0);
+}
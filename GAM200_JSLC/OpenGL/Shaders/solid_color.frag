@@ -3,10 +3,13 @@
 #version 330 core
 out vec4 FragColor;
 
+in vec4 vColor;
+
 uniform vec3 objectColor;
 uniform float uAlpha;
+uniform bool uVertexColor; // set by DebugRenderer::Flush
 
 void main()
 {
-    FragColor = vec4(objectColor, uAlpha);
-}
\ No newline at end of file
+    FragColor = uVertexColor ? vColor : vec4(objectColor, uAlpha);
+}
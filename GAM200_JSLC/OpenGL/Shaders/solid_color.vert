@@ -2,11 +2,15 @@
 
 #version 330 core
 layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec4 aColor; // DebugRenderer batches only
 
 uniform mat4 projection;
 uniform mat4 model;
 
+out vec4 vColor;
+
 void main()
 {
     gl_Position = projection * model * vec4(aPos, 0.0, 1.0);
-}
\ No newline at end of file
+    vColor = aColor;
+}
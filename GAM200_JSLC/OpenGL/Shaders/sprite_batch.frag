@@ -0,0 +1,16 @@
+//sprite_batch.frag
+
+#version 330 core
+out vec4 FragColor;
+in vec2 TexCoord;
+in vec4 Tint;
+in float Alpha;
+
+uniform sampler2D ourTexture;
+
+void main()
+{
+    vec4 texColor = texture(ourTexture, TexCoord);
+    vec3 tinted = mix(texColor.rgb, Tint.rgb, Tint.a);
+    FragColor = vec4(tinted, texColor.a * Alpha);
+}
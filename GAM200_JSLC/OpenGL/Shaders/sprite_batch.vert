@@ -0,0 +1,21 @@
+//sprite_batch.vert
+
+#version 330 core
+layout (location = 0) in vec2 aPos;       // world position (model already applied on the CPU)
+layout (location = 1) in vec2 aTexCoord;  // final UV (sprite rect + flip baked in)
+layout (location = 2) in vec4 aTint;      // rgb = tint colour, a = tint strength
+layout (location = 3) in float aAlpha;
+
+out vec2 TexCoord;
+out vec4 Tint;
+out float Alpha;
+
+uniform mat4 projection;
+
+void main()
+{
+    gl_Position = projection * vec4(aPos, 0.0, 1.0);
+    TexCoord = aTexCoord;
+    Tint = aTint;
+    Alpha = aAlpha;
+}
@@ -0,0 +1,28 @@
+//sprite_instanced.frag
+
+#version 330 core
+out vec4 FragColor;
+in vec2 TexCoord;
+in vec2 Local;
+in vec4 Tint;
+in float Alpha;
+in float RingWidth;
+
+uniform sampler2D ourTexture;
+
+void main()
+{
+    vec4 texColor = texture(ourTexture, TexCoord);
+    vec3 tinted = mix(texColor.rgb, Tint.rgb, Tint.a);
+    float alpha = texColor.a * Alpha;
+
+    if (RingWidth > 0.0)
+    {
+        // Outline band between radius (1 - RingWidth) and 1, anti-aliased over one pixel.
+        float d = length(Local);
+        float aa = fwidth(d);
+        alpha *= smoothstep(1.0 - RingWidth - aa, 1.0 - RingWidth, d) * (1.0 - smoothstep(1.0 - aa, 1.0, d));
+    }
+
+    FragColor = vec4(tinted, alpha);
+}
@@ -0,0 +1,30 @@
+//sprite_instanced.vert
+
+#version 330 core
+layout (location = 0) in vec2 aCorner;    // unit quad corner, -0.5..0.5
+layout (location = 1) in vec4 aTransform; // per instance: world-space centre (xy), size (zw)
+layout (location = 2) in vec4 aParams;    // per instance: cos, sin, alpha, ring width
+layout (location = 3) in vec4 aUVRect;    // per instance: x, y, w, h (negative w mirrors)
+layout (location = 4) in vec4 aTint;      // per instance: rgb = tint colour, a = tint strength
+
+out vec2 TexCoord;
+out vec2 Local;
+out vec4 Tint;
+out float Alpha;
+out float RingWidth;
+
+uniform mat4 projection;
+
+void main()
+{
+    vec2 local = aCorner * aTransform.zw;
+    vec2 world = vec2(aParams.x * local.x - aParams.y * local.y,
+                      aParams.y * local.x + aParams.x * local.y) + aTransform.xy;
+    gl_Position = projection * vec4(world, 0.0, 1.0);
+
+    TexCoord = aUVRect.xy + (aCorner + 0.5) * aUVRect.zw;
+    Local = aCorner * 2.0;
+    Tint = aTint;
+    Alpha = aParams.z;
+    RingWidth = aParams.w;
+}
@@ -0,0 +1,90 @@
+//train_sky.frag
+//
+// Train sunset sky in one pass: gradient bands, sun glow, clouds, skyline, yard strip and poles.
+// Layers are composited back to front exactly like the old per-quad draws (same rects, colours and
+// alphas), so the output is premultiplied and must be blended with (ONE, ONE_MINUS_SRC_ALPHA).
+
+#version 330 core
+in vec2 vWorld;
+out vec4 FragColor;
+
+uniform float uSkyBaseY; // world y of sky height fraction 0 (camera-lifted)
+uniform float uSkyHeight;
+uniform vec2  uSun;
+uniform vec3  uParallaxX; // x = far (clouds), y = mid skyline, z = near strip + poles
+
+vec4 acc = vec4(0.0);
+
+float RelY(float t) { return uSkyBaseY + uSkyHeight * t; }
+
+// C++ '%' on ints (truncates toward zero, so negative indices match the old loops).
+float IMod(float a, float b) { return a - b * trunc(a / b); }
+
+// Nearest repeat index for a rect that sits at base + offset + i * step.
+float Cell(float base, float offset, float step) { return floor((vWorld.x - base - offset) / step + 0.5); }
+
+void Layer(vec2 center, vec2 size, vec4 color)
+{
+    vec2 d = abs(vWorld - center) - size * 0.5;
+    if (d.x <= 0.0 && d.y <= 0.0)
+        acc = vec4(color.rgb * color.a, color.a) + acc * (1.0 - color.a);
+}
+
+void Band(float t, float h, vec4 color)
+{
+    Layer(vec2(vWorld.x, RelY(t)), vec2(1.0, uSkyHeight * h), color);
+}
+
+void main()
+{
+    Band(0.90, 0.22, vec4(0.13, 0.05, 0.19, 1.00));
+    Band(0.75, 0.22, vec4(0.22, 0.08, 0.20, 0.95));
+    Band(0.60, 0.20, vec4(0.38, 0.11, 0.18, 0.90));
+    Band(0.47, 0.18, vec4(0.58, 0.17, 0.14, 0.88));
+    Band(0.36, 0.16, vec4(0.80, 0.28, 0.11, 0.85));
+    Band(0.25, 0.18, vec4(0.53, 0.18, 0.10, 0.70));
+    Band(0.11, 0.22, vec4(0.10, 0.07, 0.08, 1.00));
+
+    // Sun + glow
+    Layer(uSun, vec2(uSkyHeight * 0.34), vec4(1.00, 0.48, 0.18, 0.28));
+    Layer(uSun, vec2(uSkyHeight * 0.18), vec4(1.00, 0.62, 0.24, 0.58));
+    Layer(uSun, vec2(uSkyHeight * 0.09), vec4(1.00, 0.79, 0.35, 0.95));
+
+    // Clouds: every rect is narrower than its 620 step, so only the nearest cell can cover this pixel.
+    float farX = uParallaxX.x;
+    float i = Cell(farX, 0.0, 620.0);
+    Layer(vec2(farX + i * 620.0, RelY(0.78 - 0.02 * IMod(i + 30.0, 4.0))), vec2(520.0, 52.0),
+          vec4(0.40, 0.17, 0.27, 0.26));
+    i = Cell(farX, 120.0, 620.0);
+    Layer(vec2(farX + i * 620.0 + 120.0, RelY(0.78 - 0.02 * IMod(i + 30.0, 4.0)) - 24.0), vec2(360.0, 38.0),
+          vec4(0.33, 0.13, 0.24, 0.20));
+    i = Cell(farX, -80.0, 620.0);
+    Layer(vec2(farX + i * 620.0 - 80.0, RelY(0.66 - 0.02 * IMod(i + 11.0, 5.0))), vec2(430.0, 42.0),
+          vec4(0.52, 0.21, 0.20, 0.18));
+    i = Cell(farX, 50.0, 620.0);
+    Layer(vec2(farX + i * 620.0 + 50.0, RelY(0.66 - 0.02 * IMod(i + 11.0, 5.0)) - 20.0), vec2(300.0, 30.0),
+          vec4(0.45, 0.17, 0.18, 0.14));
+    i = Cell(farX, 30.0, 620.0);
+    Layer(vec2(farX + i * 620.0 + 30.0, RelY(0.56 - 0.015 * IMod(i + 7.0, 6.0))), vec2(340.0, 28.0),
+          vec4(0.68, 0.26, 0.16, 0.10));
+
+    // Mid skyline
+    float midX = uParallaxX.y;
+    i = Cell(midX, 0.0, 360.0);
+    float h = 110.0 + IMod(i + 60.0, 7.0) * 26.0;
+    float w = 130.0 + IMod(i + 60.0, 4.0) * 22.0;
+    Layer(vec2(midX + i * 360.0, RelY(0.13) + h * 0.5), vec2(w, h), vec4(0.10, 0.06, 0.09, 0.95));
+
+    // Near dark silhouette strip (foreground city/yard)
+    float nearX = uParallaxX.z;
+    i = Cell(nearX, 0.0, 210.0);
+    h = 86.0 + IMod(i + 100.0, 5.0) * 20.0;
+    Layer(vec2(nearX + i * 210.0, RelY(0.07) + h * 0.5), vec2(150.0, h), vec4(0.07, 0.05, 0.06, 1.00));
+
+    // Poles / masts
+    i = Cell(nearX, 0.0, 160.0);
+    Layer(vec2(nearX + i * 160.0, RelY(0.22)), vec2(10.0, 170.0 + IMod(i + 80.0, 3.0) * 36.0),
+          vec4(0.06, 0.04, 0.05, 0.94));
+
+    FragColor = acc;
+}
@@ -0,0 +1,15 @@
+//train_sky.vert
+
+#version 330 core
+layout (location = 0) in vec2 aPos; // Train sky VAO: centred unit quad
+
+uniform mat4 projection;
+uniform vec4 uSkyRect; // xy = world centre, zw = world size (covers the view)
+
+out vec2 vWorld;
+
+void main()
+{
+    vWorld = uSkyRect.xy + aPos * uSkyRect.zw;
+    gl_Position = projection * vec4(vWorld, 0.0, 1.0);
+}
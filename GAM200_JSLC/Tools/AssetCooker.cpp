@@ -0,0 +1,207 @@
+//AssetCooker.cpp
+//
+// Offline texture cooker: converts every PNG under an asset folder into a sibling .ctex
+// (see Engine/CookedTexture.hpp) and reports how long the runtime spends decoding each form on
+// the CPU. Built by the `cook` CMake target:
+//
+//   cmake --build <build dir> --target cook
+//   AssetCooker <asset dir> [--raw] [--force]
+//
+//   --raw    store uncompressed levels (largest files, zero decode cost) instead of QOI
+//   --force  re-cook even when the .ctex already matches the PNG
+
+#include "../Engine/CookedTexture.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#pragma warning(push, 0)
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#pragma warning(pop)
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double MillisecondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    struct CookResult
+    {
+        std::string name;
+        double pngMs = 0.0;    // inflate + flip
+        double cookedMs = 0.0; // PNG stat + read + QOI decode of every level
+        uintmax_t pngBytes = 0;
+        uintmax_t cookedBytes = 0;
+    };
+
+    bool CookOne(const fs::path& png, const fs::path& out, const CookedTexture::SourceStamp& source,
+                 CookedTexture::Payload payload, CookResult& result)
+    {
+        // Runtime PNG path: inflate + flip at the file's own channel count. Its mips come from
+        // glGenerateMipmap, which needs a GL context, so both columns are CPU decode only.
+        const Clock::time_point pngStart = Clock::now();
+        stbi_set_flip_vertically_on_load(true);
+        int width = 0;
+        int height = 0;
+        int fileChannels = 0;
+        unsigned char* data = stbi_load(png.string().c_str(), &width, &height, &fileChannels, 0);
+        result.pngMs = MillisecondsSince(pngStart);
+        if (!data)
+        {
+            std::fprintf(stderr, "  skip %s: %s\n", png.string().c_str(), stbi_failure_reason());
+            return false;
+        }
+
+        // The runtime uploads what the file holds (RGB stays RGB); grey only comes as RGB or RGBA.
+        int channels = fileChannels;
+        if (fileChannels == 1 || fileChannels == 2)
+        {
+            stbi_image_free(data);
+            channels = fileChannels + 2;
+            data = stbi_load(png.string().c_str(), &width, &height, &fileChannels, channels);
+            if (!data)
+            {
+                std::fprintf(stderr, "  skip %s: %s\n", png.string().c_str(), stbi_failure_reason());
+                return false;
+            }
+        }
+
+        CookedTexture::Image image;
+        image.width = width;
+        image.height = height;
+        image.channels = channels;
+        image.source = source;
+        image.levels.resize(1);
+        image.levels[0].width = width;
+        image.levels[0].height = height;
+        image.levels[0].pixels.assign(data, data + static_cast<size_t>(width) * height * channels);
+        stbi_image_free(data);
+        CookedTexture::BuildMipChain(image);
+
+        if (!CookedTexture::Write(out.string(), image, payload))
+        {
+            std::fprintf(stderr, "  failed to write %s\n", out.string().c_str());
+            return false;
+        }
+
+        // Runtime cooked path: stat the PNG for the stamp check, then read + (QOI) decode every level.
+        const Clock::time_point cookedStart = Clock::now();
+        CookedTexture::SourceStamp current;
+        CookedTexture::Image reloaded;
+        if (!CookedTexture::StatSource(png.string(), current) || !CookedTexture::Load(out.string(), reloaded))
+        {
+            std::fprintf(stderr, "  failed to read back %s\n", out.string().c_str());
+            return false;
+        }
+        result.cookedMs = MillisecondsSince(cookedStart);
+
+        result.pngBytes = fs::file_size(png);
+        result.cookedBytes = fs::file_size(out);
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: AssetCooker <asset dir> [--raw] [--force]\n");
+        return 1;
+    }
+
+    const fs::path root = argv[1];
+    CookedTexture::Payload payload = CookedTexture::Payload::Qoi;
+    bool force = false;
+    for (int i = 2; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--raw") == 0)
+            payload = CookedTexture::Payload::Raw;
+        else if (std::strcmp(argv[i], "--force") == 0)
+            force = true;
+    }
+
+    if (!fs::is_directory(root))
+    {
+        std::fprintf(stderr, "AssetCooker: '%s' is not a directory\n", root.string().c_str());
+        return 1;
+    }
+
+    std::vector<CookResult> results;
+    int upToDate = 0;
+    int failed = 0;
+    for (const fs::directory_entry& file : fs::recursive_directory_iterator(root))
+    {
+        if (!file.is_regular_file() || file.path().extension() != ".png")
+            continue;
+
+        // Content decides whether to re-cook; a PNG that was only touched (checkout, copy) just gets
+        // a fresh size + mtime stamp, which is all the runtime compares.
+        const fs::path out = CookedTexture::PathFor(file.path().string());
+        CookedTexture::SourceStamp source;
+        if (!CookedTexture::StatSource(file.path().string(), source)
+            || !CookedTexture::HashSource(file.path().string(), source.hash))
+        {
+            std::fprintf(stderr, "  skip %s: unreadable\n", file.path().string().c_str());
+            ++failed;
+            continue;
+        }
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        CookedTexture::SourceStamp cookedFrom;
+        if (!force && CookedTexture::ReadInfo(out.string(), width, height, channels, &cookedFrom)
+            && cookedFrom.size == source.size && cookedFrom.hash == source.hash)
+        {
+            if (!cookedFrom.Matches(source) && !CookedTexture::Restamp(out.string(), source))
+            {
+                std::fprintf(stderr, "  failed to restamp %s\n", out.string().c_str());
+                ++failed;
+                continue;
+            }
+            ++upToDate;
+            continue;
+        }
+
+        CookResult result;
+        result.name = fs::relative(file.path(), root).generic_string();
+        if (CookOne(file.path(), out, source, payload, result))
+            results.push_back(result);
+        else
+            ++failed;
+    }
+
+    double pngTotal = 0.0;
+    double cookedTotal = 0.0;
+    uintmax_t pngBytes = 0;
+    uintmax_t cookedBytes = 0;
+    std::printf("%-40s %10s %10s %10s %10s\n", "texture", "png ms", "ctex ms", "png KB", "ctex KB");
+    for (const CookResult& r : results)
+    {
+        std::printf("%-40s %10.2f %10.2f %10ju %10ju\n", r.name.c_str(), r.pngMs, r.cookedMs,
+            r.pngBytes / 1024, r.cookedBytes / 1024);
+        pngTotal += r.pngMs;
+        cookedTotal += r.cookedMs;
+        pngBytes += r.pngBytes;
+        cookedBytes += r.cookedBytes;
+    }
+
+    std::printf("\ncooked %zu (%s), %d up to date, %d failed\n", results.size(),
+        payload == CookedTexture::Payload::Qoi ? "qoi" : "raw", upToDate, failed);
+    if (!results.empty())
+    {
+        std::printf("cpu decode: png %.1f ms -> cooked %.1f ms (%.1fx); the png path also pays glGenerateMipmap\n",
+            pngTotal, cookedTotal, cookedTotal > 0.0 ? pngTotal / cookedTotal : 0.0);
+        std::printf("disk: %ju KB -> %ju KB\n", pngBytes / 1024, cookedBytes / 1024);
+    }
+    return failed == 0 ? 0 : 1;
+}
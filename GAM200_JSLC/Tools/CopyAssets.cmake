@@ -0,0 +1,11 @@
+# CopyAssets.cmake
+#
+# Post-build Asset copy: cmake -DSRC=<dir> -DDST=<dir> -P CopyAssets.cmake
+# file(COPY) keeps timestamps (cmake -E copy_directory does not), and each .ctex's stamp
+# holds its PNG's mtime, so a plain copy would make every cooked texture look stale.
+
+if(NOT SRC OR NOT DST)
+    message(FATAL_ERROR "CopyAssets.cmake: SRC and DST are required")
+endif()
+
+file(COPY "${SRC}/" DESTINATION "${DST}")
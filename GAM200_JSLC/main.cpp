@@ -15,8 +15,10 @@
 
 #include "Engine/Engine.hpp"
 #include "Engine/Logger.hpp"
+#include <cstdlib>
+#include <cstring>
 
-int main(void)
+int main(int argc, char** argv)
 {
 #if !defined(__EMSCRIPTEN__)
 #if defined(__linux__)
@@ -47,6 +49,8 @@ int main(void)
     Logger::Instance().Initialize(Logger::Severity::Debug, true);
 
 #ifdef __EMSCRIPTEN__
+    (void)argc;
+    (void)argv;
     // 웹 빌드: Engine을 힙에 할당해서 main()이 반환된 후에도 살아있게 한다.
     // simulate_infinite_loop=1로 stack unwind 시 dangling pointer 방지.
     static Engine s_engine;
@@ -58,12 +62,97 @@ int main(void)
     s_engine.GameLoop();
     return 0;
 #else
+    // `--headless [seconds]`: simulate gameplay without a window and report ticks/sec.
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--headless") != 0)
+            continue;
+
+        double seconds = 60.0;
+        if (i + 1 < argc)
+        {
+            const double parsed = std::atof(argv[i + 1]);
+            if (parsed > 0.0)
+                seconds = parsed;
+        }
+
+        Engine engine;
+        if (!engine.InitializeHeadless())
+        {
+            Logger::Instance().Log(Logger::Severity::Error, "Headless engine initialization failed!");
+            return -1;
+        }
+        engine.RunHeadless(seconds);
+        engine.Shutdown();
+        return 0;
+    }
+
+    // `--flythrough [seconds-per-zone] [--frames <dir> [stride]] [--report <path>]`: offscreen camera pan through
+    // every zone (EGL surfaceless, no display needed); writes per-frame CPU/GPU times and optionally PNG frames.
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--flythrough") != 0)
+            continue;
+
+        FlythroughOptions options;
+        if (i + 1 < argc && argv[i + 1][0] != '-')
+        {
+            const double parsed = std::atof(argv[i + 1]);
+            if (parsed > 0.0)
+                options.secondsPerZone = parsed;
+        }
+        for (int j = 1; j < argc; ++j)
+        {
+            if (std::strcmp(argv[j], "--frames") == 0 && j + 1 < argc)
+            {
+                options.frameDirectory = argv[j + 1];
+                if (j + 2 < argc && argv[j + 2][0] != '-' && std::atoi(argv[j + 2]) > 0)
+                    options.frameStride = std::atoi(argv[j + 2]);
+            }
+            else if (std::strcmp(argv[j], "--report") == 0 && j + 1 < argc)
+            {
+                options.reportPath = argv[j + 1];
+            }
+        }
+
+        Engine engine;
+        if (!engine.InitializeOffscreen())
+        {
+            Logger::Instance().Log(Logger::Severity::Error, "Offscreen engine initialization failed!");
+            return -1;
+        }
+        engine.RunFlythrough(options);
+        engine.Shutdown();
+        return 0;
+    }
+
     Engine engine;
     if (!engine.Initialize("Project P"))
     {
         Logger::Instance().Log(Logger::Severity::Error, "Engine initialization failed!");
         return -1;
     }
+    // `--capture [dir]` writes every frame as PNG; `--capture-pipe "<command>"` streams raw RGBA frames to it
+    // (e.g. "ffmpeg -f rawvideo -pix_fmt rgba -s 1920x1080 -r 60 -i - out.mp4" with the window's letterbox size).
+    for (int i = 1; i < argc; ++i)
+    {
+        FrameCaptureSettings capture;
+        if (std::strcmp(argv[i], "--capture") == 0)
+        {
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+                capture.directory = argv[i + 1];
+        }
+        else if (std::strcmp(argv[i], "--capture-pipe") == 0 && i + 1 < argc)
+        {
+            capture.pipeCommand = argv[i + 1];
+        }
+        else
+        {
+            continue;
+        }
+        engine.GetPostProcess().StartCapture(capture);
+        break;
+    }
     engine.GameLoop();
     engine.Shutdown();
     return 0;